@@ -0,0 +1,93 @@
+/*
+  NetLight.cpp - header decoding of DDP, E1.31 (sACN) and Art-Net pixel packets
+
+  Copyright (C) 2021  Theo Arends
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "NetLight.h"
+#include <string.h>
+
+uint32_t NetLightHeaderMore(uint32_t protocol, const uint8_t *header, uint32_t read) {
+  uint32_t size;
+  switch (protocol) {
+    case NETLIGHT_DDP:
+      size = NETLIGHT_DDP_HEADER;
+      if ((read >= NETLIGHT_DDP_HEADER) && (header[0] & 0x10)) {   // Timecode
+        size += NETLIGHT_DDP_TIMECODE;
+      }
+      break;
+    case NETLIGHT_E131:
+      size = NETLIGHT_E131_HEADER;
+      break;
+    case NETLIGHT_ARTNET:
+      size = NETLIGHT_ARTNET_HEADER;
+      break;
+    default:
+      return 0;
+  }
+  return (size > read) ? size - read : 0;
+}
+
+bool NetLightDecode(NETLIGHT *state, uint32_t protocol, const uint8_t *header, uint32_t frame_size,
+                    uint32_t universe, uint32_t available, NetLightData *data) {
+  data->push = false;
+
+  if (NETLIGHT_DDP == protocol) {
+    // 0: flags VV-TSRQP, 1: sequence, 2: data type, 3: destination, 4..7: data offset, 8..9: data length, [10..13: timecode]
+    if ((header[0] & 0xC0) != 0x40) { return false; }      // Version 1 only
+    if (header[0] & 0x06) { return false; }                 // Query or reply
+    if (header[3] >= 246) { return false; }                 // Control, config and status destinations
+    uint32_t sequence = header[1] & 0x0F;
+    if (sequence && state->sequence && (sequence != (state->sequence % 15) +1u)) {
+      state->drops += (sequence + 15 - state->sequence -1) % 15;
+    }
+    state->sequence = sequence;
+    data->channels = (3 == ((header[2] >> 3) & 0x07)) ? 4 : 3;   // RGBW or RGB/undefined
+    data->offset = (header[4] << 24) | (header[5] << 16) | (header[6] << 8) | header[7];
+    data->length = (header[8] << 8) | header[9];
+    data->push = header[0] & 0x01;
+    if (data->push) { state->push_seen = true; }
+  }
+  else if (NETLIGHT_E131 == protocol) {
+    if (memcmp(header + 4, "ASC-E1.17", 9)) { return false; }
+    if ((header[21] != 0x04) || (header[43] != 0x02) || (header[117] != 0x02)) { return false; }  // Data packet
+    if (header[125] != 0) { return false; }                // DMX start code
+    uint32_t number = (header[113] << 8) | header[114];
+    if (number < universe) { return false; }
+    data->offset = (number - universe) * ((512 / data->channels) * data->channels);
+    data->length = ((header[123] << 8) | header[124]) -1;  // Property count includes the start code
+  }
+  else if (NETLIGHT_ARTNET == protocol) {
+    // 0..7: "Art-Net", 8..9: OpDmx, 10..11: version, 12: sequence, 13: physical, 14..15: port address, 16..17: length
+    if (memcmp(header, "Art-Net", 8)) { return false; }
+    if ((header[8] != 0x00) || (header[9] != 0x50)) { return false; }   // OpDmx
+    uint32_t number = header[14] | ((header[15] & 0x7F) << 8);
+    if (number < universe) { return false; }
+    data->offset = (number - universe) * ((512 / data->channels) * data->channels);
+    data->length = (header[16] << 8) | header[17];
+  }
+  else {
+    return false;
+  }
+
+  if (data->length > available) { data->length = available; }
+  if ((protocol != NETLIGHT_DDP) && (data->offset + data->length >= frame_size)) {
+    data->push = true;                                       // Last universe of the frame
+    state->push_seen = true;
+  }
+  state->packets++;
+  return true;
+}
@@ -0,0 +1,59 @@
+/*
+  NetLight.h - header decoding of DDP, E1.31 (sACN) and Art-Net pixel packets
+
+  Copyright (C) 2021  Theo Arends
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __NETLIGHT_H__
+#define __NETLIGHT_H__
+
+#include <stdint.h>
+
+enum NetLightProtocols { NETLIGHT_DDP, NETLIGHT_E131, NETLIGHT_ARTNET };
+
+const uint32_t NETLIGHT_DDP_HEADER = 10;          // Followed by 4 bytes timecode if flagged
+const uint32_t NETLIGHT_DDP_TIMECODE = 4;
+const uint32_t NETLIGHT_E131_HEADER = 126;        // Root, framing and DMP layer up to the DMX start code
+const uint32_t NETLIGHT_ARTNET_HEADER = 18;
+const uint32_t NETLIGHT_HEADER_MAX = 126;
+
+struct NETLIGHT {
+  uint32_t packets = 0;                           // Packets with pixel data
+  uint32_t frames = 0;                            // Frames shown
+  uint32_t frames_last = 0;                       // Frames shown up to previous second
+  uint32_t drops = 0;                             // Packets missing from DDP sequence numbers
+  uint16_t fps = 0;                               // Frames shown during last second
+  uint8_t sequence = 0;                           // Last DDP sequence number, 0 = not used
+  bool push_seen = false;                         // Sender marks frame ends with DDP PUSH or complete DMX frames
+};
+
+typedef struct {
+  uint32_t offset;                                // Byte offset of the pixel data in the frame
+  uint32_t length;                                // Bytes of pixel data in this packet
+  uint32_t channels;                              // Bytes per pixel, input for DMX and set from the DDP data type
+  bool push;                                      // Packet ends a frame
+} NetLightData;
+
+// Header bytes to read before NetLightDecode() given the bytes read so far, 0 when complete
+uint32_t NetLightHeaderMore(uint32_t protocol, const uint8_t *header, uint32_t read);
+
+// Decodes a complete header and updates the receiver statistics
+// frame_size: bytes of a full frame, universe: first DMX universe, available: bytes left in the packet
+// Returns false if the packet carries no pixel data for us
+bool NetLightDecode(NETLIGHT *state, uint32_t protocol, const uint8_t *header, uint32_t frame_size,
+                    uint32_t universe, uint32_t available, NetLightData *data);
+
+#endif  // __NETLIGHT_H__
@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+"""Writes the packet streams replayed by test-replay.cpp
+
+Capture format, a sequence of records:
+  1 byte  kind: 0 = DDP, 1 = E1.31, 2 = Art-Net, 255 = receiver tick
+  2 bytes length, big endian
+  length bytes: packet as received on the socket, or for a tick the frame number expected
+  to be shown by the tick (empty if none)
+
+Packets between two ticks are queued on the socket when the receiver runs.
+"""
+
+import struct
+
+DDP, E131, ARTNET, TICK = 0, 1, 2, 255
+
+
+def image(frame, size):
+    return bytes(((frame * 31) + (i * 7)) & 0xFF for i in range(size))
+
+
+def record(kind, data):
+    return struct.pack(">BH", kind, len(data)) + data
+
+
+def tick(frame=None):
+    return record(TICK, b"" if frame is None else bytes([frame]))
+
+
+class Ddp:
+    def __init__(self):
+        self.sequence = 0
+
+    def packet(self, offset, data, push=False, timecode=False, query=False, destination=1, rgbw=False):
+        if query or (destination >= 246):
+            sequence = 0                                 # Not part of the pixel stream
+        else:
+            self.sequence = self.sequence % 15 + 1
+            sequence = self.sequence
+        flags = 0x40 | (0x01 if push else 0) | (0x10 if timecode else 0) | (0x02 if query else 0)
+        data_type = 0x1B if rgbw else 0x0B               # 8 bit RGBW or RGB pixels
+        header = struct.pack(">BBBBIH", flags, sequence, data_type, destination, offset, len(data))
+        if timecode:
+            header += struct.pack(">I", 0x12345678)
+        return record(DDP, header + data)
+
+    def frame(self, frame, size, chunk):
+        # Sent like xLights: fixed size chunks, PUSH on the last one
+        data = image(frame, size)
+        out = b""
+        for offset in range(0, size, chunk):
+            part = data[offset:offset + chunk]
+            out += self.packet(offset, part, push=(offset + chunk >= size), timecode=(offset == 0))
+        return out
+
+
+def e131(universe, data):
+    root = struct.pack(">HH12sH4s16s", 0x0010, 0x0000, b"ASC-E1.17\0\0\0", 0x7000 | (110 + len(data)), b"\0\0\0\x04", bytes(16))
+    framing = struct.pack(">HI64sBHBBH", 0x7000 | (88 + len(data)), 0x00000002, b"Tasmota", 100, 0, 1, 0, universe)
+    dmp = struct.pack(">HBBHHH", 0x7000 | (11 + len(data)), 0x02, 0xA1, 0x0000, 0x0001, len(data) + 1) + b"\0"
+    return record(E131, root + framing + dmp + data)
+
+
+def artnet(universe, data, sequence):
+    header = b"Art-Net\0" + struct.pack("<H", 0x5000) + struct.pack(">HBB", 14, sequence, 0)
+    header += struct.pack("<H", universe) + struct.pack(">H", len(data))
+    return record(ARTNET, header + data)
+
+
+def universes(frame, size, channels):
+    data = image(frame, size)
+    per_universe = (512 // channels) * channels
+    return [(1 + n, data[offset:offset + per_universe]) for n, offset in enumerate(range(0, size, per_universe))]
+
+
+def ddp_xlights():
+    # 600 RGB pixels in 1440 byte packets: one frame per tick, a backlog of two frames, a frame split
+    # over ticks, non pixel packets and a complete frame followed by the start of the next one
+    ddp = Ddp()
+    size = 600 * 3
+    out = ddp.frame(1, size, 1440) + tick(1)
+    out += ddp.frame(2, size, 1440) + ddp.frame(3, size, 1440) + tick(3)
+    frame4 = ddp.frame(4, size, 1440)
+    first = 3 + 10 + 4 + 1440                           # record header, DDP header, timecode, data
+    out += frame4[:first] + tick()
+    out += frame4[first:] + tick(4)
+    out += ddp.packet(0, b"", query=True) + ddp.packet(0, b"{}", destination=251) + tick()
+    frame5 = ddp.frame(5, size, 1440)
+    frame6 = ddp.frame(6, size, 1440)
+    out += frame5 + frame6[:first] + tick()
+    out += frame6[first:] + tick(6)
+    return out
+
+
+def ddp_nopush():
+    # 60 RGB pixels in a single packet without PUSH, every update is shown
+    out = b""
+    for frame in range(1, 4):
+        out += record(DDP, struct.pack(">BBBBIH", 0x40, 0, 0x0B, 1, 0, 180) + image(frame, 180)) + tick(frame)
+    return out
+
+
+def ddp_gap():
+    # 30 RGB pixels with sequence numbers 14, 15, 3: two packets to another device lost
+    ddp = Ddp()
+    data = image(1, 90)
+    ddp.sequence = 13
+    out = ddp.packet(0, data[0:30]) + ddp.packet(30, data[30:60])
+    ddp.sequence = 2
+    out += ddp.packet(60, data[60:90], push=True)
+    return out + tick(1)
+
+
+def e131_stream():
+    # 300 RGB pixels on universes 1 and 2, frame complete on universe 2, a foreign universe 0
+    out = b""
+    for frame in range(1, 3):
+        for universe, data in universes(frame, 900, 3):
+            out += e131(universe, data)
+        out += tick(frame)
+    out += e131(0, image(9, 510)) + tick()
+    return out
+
+
+def artnet_stream():
+    # 300 RGB pixels on universes 1 and 2, two frames queued per tick
+    out = b""
+    sequence = 0
+    for frame in range(1, 5):
+        for universe, data in universes(frame, 900, 3):
+            sequence += 1
+            out += artnet(universe, data, sequence)
+        if frame % 2 == 0:
+            out += tick(frame)
+    return out
+
+
+captures = {
+    "ddp-xlights.cap": ddp_xlights(),
+    "ddp-nopush.cap": ddp_nopush(),
+    "ddp-gap.cap": ddp_gap(),
+    "e131.cap": e131_stream(),
+    "artnet.cap": artnet_stream(),
+}
+
+for name, data in captures.items():
+    with open(name, "wb") as f:
+        f.write(data)
@@ -0,0 +1,125 @@
+// Host replay of recorded network light packet streams through the NetLight header decoder
+//
+// Each capture holds the packets queued on the socket between two receiver runs (see make-captures.py).
+// A run follows Ws2812DDP(): all queued packets are drained into the strip buffer and the strip is
+// shown only if the last packet completed a frame, or on any update if the sender never marks frames.
+// The shown strip must match the frame the capture expects for that run.
+//
+// python3 make-captures.py
+// g++ -O1 -I../src test-replay.cpp ../src/NetLight.cpp -o test-replay && ./test-replay
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include "NetLight.h"
+
+static uint32_t checks = 0;
+static uint32_t failures = 0;
+
+#define CHECK(cond) do { checks++; if (!(cond)) { failures++; printf("  FAIL %s:%d %s\n", __FILE__, __LINE__, #cond); } } while (0)
+
+const uint8_t CAPTURE_TICK = 255;
+
+struct Packet {
+  uint8_t kind;
+  std::vector<uint8_t> data;
+};
+
+static bool load(const char *name, std::vector<Packet> *packets) {
+  FILE *f = fopen(name, "rb");
+  if (!f) { return false; }
+  uint8_t record[3];
+  while (fread(record, 1, 3, f) == 3) {
+    Packet packet;
+    packet.kind = record[0];
+    packet.data.resize((record[1] << 8) | record[2]);
+    if (packet.data.size() && (fread(packet.data.data(), 1, packet.data.size(), f) != packet.data.size())) { break; }
+    packets->push_back(packet);
+  }
+  fclose(f);
+  return true;
+}
+
+static void image(uint32_t frame, uint8_t *data, uint32_t size) {
+  for (uint32_t i = 0; i < size; i++) { data[i] = ((frame * 31) + (i * 7)) & 0xFF; }
+}
+
+// Follows NetLightHeader() and Ws2812NetLightData() reading a packet from the socket
+static bool receive(NETLIGHT *state, const Packet &packet, std::vector<uint8_t> *strip, uint32_t channels, bool *push) {
+  uint8_t header[NETLIGHT_HEADER_MAX];
+  uint32_t read = 0;
+  uint32_t more;
+  while ((more = NetLightHeaderMore(packet.kind, header, read))) {
+    if (read + more > packet.data.size()) { return false; }          // Runt packet
+    memcpy(header + read, packet.data.data() + read, more);
+    read += more;
+  }
+  NetLightData data;
+  data.channels = channels;
+  if (!NetLightDecode(state, packet.kind, header, strip->size(), 1, packet.data.size() - read, &data)) { return false; }
+  if (data.offset < strip->size()) {
+    uint32_t length = data.length;
+    if (data.offset + length > strip->size()) { length = strip->size() - data.offset; }
+    memcpy(strip->data() + data.offset, packet.data.data() + read, length);
+  }
+  *push = data.push;
+  return true;
+}
+
+static void replay(const char *name, uint32_t pixels, uint32_t shows, uint32_t drops, uint32_t ignored) {
+  printf("%s\n", name);
+  std::vector<Packet> packets;
+  CHECK(load(name, &packets));
+  if (packets.empty()) { return; }
+
+  NETLIGHT state;
+  std::vector<uint8_t> strip(pixels * 3);
+  std::vector<uint8_t> expected(strip.size());
+  uint32_t shown = 0;
+  uint32_t rejected = 0;
+  uint32_t pixel_packets = 0;
+  bool received = false;
+  bool complete = false;
+  for (const Packet &packet : packets) {
+    if (CAPTURE_TICK != packet.kind) {
+      bool push;
+      if (!receive(&state, packet, &strip, 3, &push)) {
+        rejected++;
+        continue;
+      }
+      pixel_packets++;
+      received = true;
+      complete = push;
+      continue;
+    }
+    bool show = complete || (received && !state.push_seen);
+    CHECK(show == !packet.data.empty());
+    if (show && !packet.data.empty()) {
+      image(packet.data[0], expected.data(), expected.size());
+      CHECK(0 == memcmp(strip.data(), expected.data(), strip.size()));
+    }
+    if (show) {
+      shown++;
+      state.frames++;
+    }
+    received = false;
+    complete = false;
+  }
+  CHECK(shown == shows);
+  CHECK(state.drops == drops);
+  CHECK(rejected == ignored);
+  CHECK(state.packets == pixel_packets);
+  printf("  %u packets, %u ignored, %u frames shown, %u dropped\n", state.packets, rejected, shown, state.drops);
+}
+
+int main(int argc, char* argv[]) {
+  //     capture            pixels shows drops ignored
+  replay("ddp-xlights.cap", 600,   4,    0,    2);
+  replay("ddp-nopush.cap",  60,    3,    0,    0);
+  replay("ddp-gap.cap",     30,    1,    2,    0);
+  replay("e131.cap",        300,   2,    0,    1);
+  replay("artnet.cap",      300,   2,    0,    0);
+  printf("%u checks, %u failures\n", checks, failures);
+  return failures ? 1 : 0;
+}
@@ -73,6 +73,7 @@ TasmotaSerial::TasmotaSerial(int receive_pin, int transmit_pin, int hardware_fal
       // Use getCycleCount() loop to get as exact timing as possible
       m_bit_time = ESP.getCpuFreqMHz() * 1000000 / TM_SERIAL_BAUDRATE;
       m_bit_start_time = m_bit_time + m_bit_time/3 - 500; // pre-compute first wait
+      m_decoder.begin(m_bit_time);
       pinMode(m_rx_pin, INPUT);
       tms_obj_list[m_rx_pin] = this;
       attachInterruptArg(m_rx_pin, callRxRead, this, (m_nwmode) ? CHANGE : FALLING);
@@ -174,6 +175,9 @@ bool TasmotaSerial::begin(uint32_t speed, uint32_t config) {
       }
     }
     TSerial->begin(speed, config, m_rx_pin, m_tx_pin);
+    if (m_overrun_stats) {
+      enableOverrunStats();
+    }
     // For low bit rate, below 9600, set the Full RX threshold at 10 bytes instead of the default 120
     if (speed <= 9600) {
       // At 9600, 10 chars are ~10ms
@@ -210,12 +214,27 @@ bool TasmotaSerial::begin(uint32_t speed, uint32_t config) {
     // Use getCycleCount() loop to get as exact timing as possible
     m_bit_time = ESP.getCpuFreqMHz() * 1000000 / speed;
     m_bit_start_time = m_bit_time + m_bit_time/3 - (ESP.getCpuFreqMHz() > 120 ? 700 : 500); // pre-compute first wait
+    m_decoder.begin(m_bit_time);
     m_high_speed = (speed >= 9600);
     m_very_high_speed = (speed >= 50000);
   }
   return m_valid;
 }
 
+#ifdef ESP32
+void TasmotaSerial::enableOverrunStats(void) {
+  // Error events need the uart event task, only install it for ports that report overruns
+  m_overrun_stats = true;
+  if ((TSerial != nullptr) && m_hardserial) {
+    TSerial->onReceiveError([this](hardwareSerial_error_t error) {
+      if ((UART_BUFFER_FULL_ERROR == error) || (UART_FIFO_OVF_ERROR == error)) {
+        m_overruns++;
+      }
+    });
+  }
+}
+#endif  // ESP32
+
 bool TasmotaSerial::hardwareSerial(void) {
 #ifdef ESP8266
   return m_hardserial;
@@ -248,6 +267,7 @@ int TasmotaSerial::peek(void) {
     return TSerial->peek();
 #endif  // ESP32
   } else {
+    rxIdle();
     if ((-1 == m_rx_pin) || (m_in_pos == m_out_pos)) return -1;
     return m_buffer[m_out_pos];
   }
@@ -256,15 +276,18 @@ int TasmotaSerial::peek(void) {
 int TasmotaSerial::read(void) {
   if (m_hardserial) {
 #ifdef ESP8266
-    return Serial.read();
+    int ch = Serial.read();
 #endif  // ESP8266
 #ifdef ESP32
-    return TSerial->read();
+    int ch = TSerial->read();
 #endif  // ESP32
+    if (ch >= 0) { m_rx_bytes++; }
+    return ch;
   } else {
+    rxIdle();
     if ((-1 == m_rx_pin) || (m_in_pos == m_out_pos)) return -1;
     uint32_t ch = m_buffer[m_out_pos];
-    m_out_pos = (m_out_pos +1) % serial_buffer_size;
+    m_out_pos = (m_out_pos +1 < serial_buffer_size) ? m_out_pos +1 : 0;
     return ch;
   }
 }
@@ -272,17 +295,20 @@ int TasmotaSerial::read(void) {
 size_t TasmotaSerial::read(char* buffer, size_t size) {
   if (m_hardserial) {
 #ifdef ESP8266
-    return Serial.read(buffer, size);
+    size_t count = Serial.read(buffer, size);
 #endif  // ESP8266
 #ifdef ESP32
-    return TSerial->read(buffer, size);
+    size_t count = TSerial->read(buffer, size);
 #endif  // ESP32
+    m_rx_bytes += count;
+    return count;
   } else {
+    rxIdle();
     if ((-1 == m_rx_pin) || (m_in_pos == m_out_pos)) { return 0; }
     size_t count = 0;
-    for( ; size && (m_in_pos == m_out_pos) ; --size, ++count) {
+    for( ; size && (m_in_pos != m_out_pos) ; --size, ++count) {
       *buffer++ = m_buffer[m_out_pos];
-      m_out_pos = (m_out_pos +1) % serial_buffer_size;
+      m_out_pos = (m_out_pos +1 < serial_buffer_size) ? m_out_pos +1 : 0;
     }
     return count;
   }
@@ -291,12 +317,16 @@ size_t TasmotaSerial::read(char* buffer, size_t size) {
 int TasmotaSerial::available(void) {
   if (m_hardserial) {
 #ifdef ESP8266
+    if (Serial.hasOverrun()) {     // Reading clears the flag
+      m_overruns++;
+    }
     return Serial.available();
 #endif  // ESP8266
 #ifdef ESP32
     return TSerial->available();
 #endif  // ESP32
   } else {
+    rxIdle();
     int avail = m_in_pos - m_out_pos;
     if (avail < 0) avail += serial_buffer_size;
     return avail;
@@ -378,12 +408,7 @@ void IRAM_ATTR TasmotaSerial::rxRead(void) {
         rec >>= 1;
         if (digitalRead(m_rx_pin)) rec |= 0x80;
       }
-      // Store the received value in the buffer unless we have an overflow
-      uint32_t next = (m_in_pos+1) % serial_buffer_size;
-      if (next != (int)m_out_pos) {
-        m_buffer[m_in_pos] = rec;
-        m_in_pos = next;
-      }
+      rxStore(rec);
 
       TM_SERIAL_WAIT_RCV_LOOP;    // wait for stop bit
       if (2 == m_stop_bits) {
@@ -415,62 +440,36 @@ void IRAM_ATTR TasmotaSerial::rxRead(void) {
     // it gets set even when interrupts are disabled
     GPIO_REG_WRITE(GPIO_STATUS_W1TC_ADDRESS, 1 << m_rx_pin);
   } else {
-    uint32_t diff;
-    uint32_t level;
-
-    #define LASTBIT 9
-
+    // Edge capture, place the bits by time and return without waiting for the rest of the character
     GPIO_REG_WRITE(GPIO_STATUS_W1TC_ADDRESS, 1 << m_rx_pin);
+    int32_t data = m_decoder.edge(ESP.getCycleCount(), digitalRead(m_rx_pin));
+    if (data >= 0) {
+      rxStore(data);
+    }
+  }
+}
 
-    level = digitalRead(m_rx_pin);
-
-    if (!level && !ss_index) {
-      // start condition
-      ss_bstart = ESP.getCycleCount() - (m_bit_time / 4);
-      ss_byte = 0;
-      ss_index++;
-      //digitalWrite(1, LOW);
-    } else {
-      // now any bit changes go here
-      // calc bit number
-      diff = (ESP.getCycleCount() - ss_bstart) / m_bit_time;
-      //digitalWrite(1, level);
-
-      if (!level && diff > LASTBIT) {
-        // start bit of next byte, store  and restart
-        // leave irq at change
-        for (uint32_t i = ss_index; i <= LASTBIT; i++) {
-          ss_byte |= (1 << i);
-        }
-        //stobyte(0,ssp->ss_byte>>1);
-        uint32_t next = (m_in_pos + 1) % serial_buffer_size;
-        if (next != (uint32_t)m_out_pos) {
-          m_buffer[m_in_pos] = ss_byte >> 1;
-          m_in_pos = next;
-        }
+void IRAM_ATTR TasmotaSerial::rxStore(uint32_t data) {
+  // Store the received value in the buffer unless we have an overflow
+  uint32_t next = (m_in_pos +1 < serial_buffer_size) ? m_in_pos +1 : 0;  // Avoid division in interrupt
+  if (next != m_out_pos) {
+    m_buffer[m_in_pos] = data;
+    m_in_pos = next;
+    m_rx_bytes++;
+  } else {
+    m_overruns++;
+  }
+}
 
-        ss_bstart = ESP.getCycleCount() - (m_bit_time / 4);
-        ss_byte = 0;
-        ss_index = 1;
-        return;
-      }
-      if (diff >= LASTBIT) {
-        // bit zero was 0,
-        //stobyte(0,ssp->ss_byte>>1);
-        uint32_t next = (m_in_pos + 1) % serial_buffer_size;
-        if (next != (uint32_t)m_out_pos) {
-          m_buffer[m_in_pos] = ss_byte >> 1;
-          m_in_pos = next;
-        }
-        ss_byte = 0;
-        ss_index = 0;
-      } else {
-        // shift in
-        for (uint32_t i = ss_index; i < diff; i++) {
-          if (!level) ss_byte |= (1 << i);
-        }
-        ss_index = diff;
-      }
-    }
+void TasmotaSerial::rxIdle(void) {
+#ifdef ESP8266
+  // The last character of a burst ends without an edge, complete it once its stop bit has passed
+  if (!m_nwmode || (-1 == m_rx_pin) || !m_decoder.active()) { return; }
+  uint32_t savedPS = xt_rsil(15);  // Keep rxRead() out while the decoder state changes
+  int32_t data = m_decoder.idle(ESP.getCycleCount());
+  if (data >= 0) {
+    rxStore(data);
   }
+  xt_wsr_ps(savedPS);
+#endif  // ESP8266
 }
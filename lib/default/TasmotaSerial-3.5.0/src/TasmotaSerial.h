@@ -26,10 +26,13 @@
 \*********************************************************************************************/
 
 #define TM_SERIAL_BAUDRATE           9600   // Default baudrate
+#ifndef TM_SERIAL_BUFFER_SIZE
 #define TM_SERIAL_BUFFER_SIZE        64     // Receive buffer size
+#endif
 
 #include <inttypes.h>
 #include <Stream.h>
+#include "TasmotaSerialDecoder.h"
 
 #ifdef ESP32
 #include <HardwareSerial.h>
@@ -54,8 +57,12 @@ class TasmotaSerial : public Stream {
     void rxRead(void);
 
     uint32_t getLoopReadMetric(void) const { return m_bit_follow_metric; }
+    uint32_t getRxBytes(void) const { return m_rx_bytes; }          // Bytes received since start or resetStats()
+    uint32_t getOverruns(void) const { return m_overruns; }         // Receive buffer or fifo overruns since start or resetStats(), ESP32 needs enableOverrunStats()
+    void resetStats(void) { m_rx_bytes = 0; m_overruns = 0; }
 #ifdef ESP32
     uint32_t getUart(void) const { return m_uart; }
+    void enableOverrunStats(void);                                  // Count overruns from the uart event task
 #endif
     bool isValid() { return m_valid; }
 
@@ -67,17 +74,18 @@ class TasmotaSerial : public Stream {
     bool freeUart(void);
 #endif
     size_t txWrite(uint8_t byte);
+    void rxStore(uint32_t data);
+    void rxIdle(void);
 
     // Member variables
     int m_rx_pin;
     int m_tx_pin;
     uint32_t m_stop_bits;
-    uint32_t ss_byte;
-    uint32_t ss_bstart;
-    uint32_t ss_index;
     uint32_t m_bit_time;
     uint32_t m_bit_start_time;
     uint32_t m_bit_follow_metric = 0;
+    volatile uint32_t m_rx_bytes = 0;
+    volatile uint32_t m_overruns = 0;
     uint32_t m_in_pos;
     uint32_t m_out_pos;
     uint32_t serial_buffer_size;
@@ -88,12 +96,14 @@ class TasmotaSerial : public Stream {
     bool m_high_speed = false;
     bool m_very_high_speed = false;   // above 100000 bauds
     uint8_t *m_buffer;
+    TasmotaSerialDecoder m_decoder;   // nwmode edge capture receiver
 
     void _fast_write(uint8_t b);      // IRAM minimized version
 
 #ifdef ESP32
     HardwareSerial *TSerial;
     int m_uart = 0;
+    bool m_overrun_stats = false;
 #endif
 
 };
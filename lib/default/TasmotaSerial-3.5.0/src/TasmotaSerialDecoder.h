@@ -0,0 +1,95 @@
+/*
+  TasmotaSerialDecoder.h - Edge capture receive decoder for TasmotaSerial
+
+  Copyright (C) 2021  Theo Arends
+
+  This library is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TasmotaSerialDecoder_h
+#define TasmotaSerialDecoder_h
+/*********************************************************************************************\
+ * Edge capture receive decoder used by TasmotaSerial with nwmode
+ *
+ * The rx pin interrupts on every level change and passes the cycle count and the new line
+ * level to edge(). The bits between the previous and this edge are placed by time, so the
+ * interrupt never busy waits for a whole character while Wi-Fi interrupts are held off.
+ * A character ending in one bits leaves no edge after its stop bit. idle() completes it from
+ * the foreground once the stop bit has passed, with the rx interrupt disabled.
+ *
+ * Pure logic without Arduino dependencies, see test/test-decoder.cpp for the host simulator.
+\*********************************************************************************************/
+
+#include <stdint.h>
+
+#define TM_SERIAL_DECODER_BITS       10     // Start bit, 8 data bits and the first stop bit
+
+class TasmotaSerialDecoder {
+  public:
+    void begin(uint32_t bit_time) {
+      m_bit_time = bit_time;
+      m_active = false;
+    }
+
+    // Level change at cycle count now, level is the line level after the change
+    // Returns the character completed by this edge or -1
+    inline __attribute__((always_inline)) int32_t edge(uint32_t now, uint32_t level) {
+      int32_t data = -1;
+      if (m_active) {
+        data = advance(now);
+      }
+      if (m_active) {
+        m_level = level;
+      }
+      else if (!level) {                  // Start bit
+        m_start = now;
+        m_bits = 0;
+        m_index = 1;
+        m_level = 0;
+        m_active = true;
+      }
+      return data;
+    }
+
+    // No edge until cycle count now, returns the character completed by the idle line or -1
+    int32_t idle(uint32_t now) {
+      return (m_active) ? advance(now) : -1;
+    }
+
+    bool active(void) const { return m_active; }
+
+  private:
+    inline __attribute__((always_inline)) int32_t advance(uint32_t now) {
+      // Bits whose center lies before now still had the level of the previous edge
+      uint32_t bits = (now - m_start + (m_bit_time >> 1)) / m_bit_time;
+      if (bits > TM_SERIAL_DECODER_BITS) { bits = TM_SERIAL_DECODER_BITS; }
+      if (bits <= m_index) { return -1; }
+      if (m_level) {
+        m_bits |= ((1 << bits) -1) & ~((1 << m_index) -1);
+      }
+      m_index = bits;
+      if (bits < TM_SERIAL_DECODER_BITS) { return -1; }
+      m_active = false;
+      return (m_bits >> 1) & 0xFF;
+    }
+
+    uint32_t m_bit_time = 1;
+    uint32_t m_start = 0;                 // Cycle count of the start bit edge
+    uint32_t m_bits = 0;                  // Placed bits, the start bit is bit 0
+    uint32_t m_index = 0;                 // Next bit to place
+    uint32_t m_level = 1;                 // Line level since the previous edge
+    volatile bool m_active = false;       // Character in progress
+};
+
+#endif  // TasmotaSerialDecoder_h
@@ -0,0 +1,182 @@
+// Host bit-stream simulator for the TasmotaSerial edge capture decoder (nwmode)
+//
+// A sender with baud rate error and random gaps between characters drives the rx line. Every
+// level change reaches the decoder through a simulated interrupt with random latency, and the
+// foreground polls idle() at random moments as available() and read() do. The decoded stream
+// must equal the sent stream, including the last character of a burst that has no edge after it.
+//
+// g++ -O1 -I../src test-decoder.cpp -o test-decoder && ./test-decoder
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+#include "TasmotaSerialDecoder.h"
+
+static uint32_t checks = 0;
+static uint32_t failures = 0;
+
+#define CHECK(cond) do { checks++; if (!(cond)) { failures++; printf("  FAIL %s:%d %s\n", __FILE__, __LINE__, #cond); } } while (0)
+
+const uint32_t CPU_FREQ = 80000000;       // ESP8266 cycle counter at 80MHz
+const uint32_t CYCLE_START = 0xFFF00000;  // Let the cycle counter wrap during the test
+
+static uint32_t seed = 12345;
+
+static double random01(void) {
+  seed = seed * 1103515245 + 12345;
+  return (double)((seed >> 8) & 0xFFFF) / 0x10000;
+}
+
+struct Line {
+  std::vector<double> time;               // Seconds since the start of the stream
+  std::vector<uint32_t> level;            // Line level after the change
+};
+
+struct Result {
+  std::vector<uint8_t> data;
+  uint32_t interrupts = 0;
+  uint32_t polls = 0;
+};
+
+// Transmit data as 8N1 or 8N2 with the sender clock off by error, idle gaps in bit times
+static Line transmit(const std::vector<uint8_t> &data, uint32_t baud, double error, uint32_t stop_bits, double max_gap) {
+  Line line;
+  double bit = 1.0 / (baud * (1.0 + error));
+  double now = 10 * bit;
+  uint32_t level = 1;
+  for (uint8_t ch : data) {
+    uint32_t frame = ((uint32_t)ch << 1) | (((1 << stop_bits) -1) << 9);   // Start bit 0, data lsb first, stop bits 1
+    for (uint32_t i = 0; i < 9 + stop_bits; i++) {
+      uint32_t bit_level = (frame >> i) & 1;
+      if (bit_level != level) {
+        line.time.push_back(now);
+        line.level.push_back(bit_level);
+        level = bit_level;
+      }
+      now += bit;
+    }
+    now += max_gap * random01() * bit;
+  }
+  return line;
+}
+
+static uint32_t cycles(double time) {
+  return CYCLE_START + (uint32_t)(time * CPU_FREQ);
+}
+
+// Deliver the edges with interrupt latency between base and base + jitter (in bit times) and poll idle() in between
+static Result receive(const Line &line, uint32_t baud, double base, double jitter, double poll_rate) {
+  Result result;
+  double bit = 1.0 / baud;
+  TasmotaSerialDecoder decoder;
+  decoder.begin(CPU_FREQ / baud);
+  double previous = 0;
+  for (uint32_t i = 0; i <= line.time.size(); i++) {
+    bool last = (i == line.time.size());
+    double interrupt = (last) ? previous + 20 * bit : line.time[i] + (base + jitter * random01()) * bit;
+    // Foreground polls between the previous and this interrupt
+    double poll = previous;
+    while (true) {
+      poll += (0.2 + 3 * random01()) * bit / poll_rate;
+      if (poll >= interrupt) { break; }
+      int32_t data = decoder.idle(cycles(poll));
+      result.polls++;
+      if (data >= 0) { result.data.push_back(data); }
+    }
+    if (last) { break; }
+    int32_t data = decoder.edge(cycles(interrupt), line.level[i]);
+    result.interrupts++;
+    if (data >= 0) { result.data.push_back(data); }
+    previous = interrupt;
+  }
+  int32_t data = decoder.idle(cycles(previous + 20 * bit));
+  if (data >= 0) { result.data.push_back(data); }
+  return result;
+}
+
+static std::vector<uint8_t> stream(uint32_t size) {
+  std::vector<uint8_t> data;
+  for (uint32_t i = 0; i < 256; i++) { data.push_back(i); }
+  while (data.size() < size) { data.push_back(random01() * 256); }
+  data.push_back(0xFF);                   // Ends in one bits without an edge after the start bit
+  return data;
+}
+
+static uint32_t mismatches(const std::vector<uint8_t> &sent, const std::vector<uint8_t> &received) {
+  uint32_t count = (sent.size() > received.size()) ? sent.size() - received.size() : received.size() - sent.size();
+  for (uint32_t i = 0; (i < sent.size()) && (i < received.size()); i++) {
+    if (sent[i] != received[i]) { count++; }
+  }
+  return count;
+}
+
+static void decode(uint32_t baud, uint32_t stop_bits, double error, double jitter, double max_gap) {
+  std::vector<uint8_t> sent = stream(2048);
+  Line line = transmit(sent, baud, error, stop_bits, max_gap);
+  Result result = receive(line, baud, 0.05, jitter, 1.0);
+  uint32_t wrong = mismatches(sent, result.data);
+  CHECK(0 == wrong);
+  printf("  %6u baud 8N%u, clock %+.0f%%, latency jitter %.2f bit: %u chars, %.1f interrupts/char, %u polls, %u wrong\n",
+    baud, stop_bits, error * 100, jitter, (uint32_t)sent.size(), (double)result.interrupts / sent.size(), result.polls, wrong);
+}
+
+// The last character of a burst is completed by idle() once its stop bit has passed, and not before
+static void trailing(uint32_t baud) {
+  uint32_t bit_time = CPU_FREQ / baud;
+  TasmotaSerialDecoder decoder;
+  decoder.begin(bit_time);
+  uint32_t start = CYCLE_START;
+  CHECK(-1 == decoder.edge(start, 0));                      // Start bit of 0xFF
+  CHECK(-1 == decoder.edge(start + bit_time, 1));           // Data and stop bits all 1
+  CHECK(decoder.active());
+  uint32_t stop = start + 10 * bit_time - bit_time / 2;    // Center of the stop bit
+  CHECK(-1 == decoder.idle(start + 5 * bit_time));
+  CHECK(-1 == decoder.idle(stop - 1));
+  CHECK(0xFF == decoder.idle(stop));
+  CHECK(!decoder.active());
+  CHECK(-1 == decoder.idle(start + 20 * bit_time));
+  CHECK(-1 == decoder.edge(start + 21 * bit_time, 1));      // Rising edge on an idle line is no start bit
+  CHECK(!decoder.active());
+
+  // Next start bit completes a pending character and starts the next one
+  start += 30 * bit_time;
+  CHECK(-1 == decoder.edge(start, 0));                      // 0x7E, 0 1111110 1
+  CHECK(-1 == decoder.edge(start + 2 * bit_time, 1));
+  CHECK(-1 == decoder.edge(start + 8 * bit_time, 0));
+  CHECK(-1 == decoder.edge(start + 9 * bit_time, 1));
+  CHECK(0x7E == decoder.edge(start + 10 * bit_time, 0));    // Back to back start bit
+  CHECK(decoder.active());
+  CHECK(-1 == decoder.edge(start + 19 * bit_time, 1));      // 0x00 up to its stop bit
+  CHECK(decoder.active());
+  CHECK(0x00 == decoder.idle(start + 20 * bit_time));
+  CHECK(!decoder.active());
+}
+
+int main(int argc, char* argv[]) {
+  printf("trailing character\n");
+  trailing(9600);
+  trailing(115200);
+
+  printf("random streams\n");
+  //     baud    stop clock  jitter gap
+  decode(2400,   1,    0.00, 0.30,  2);
+  decode(9600,   1,    0.02, 0.25,  3);
+  decode(9600,   2,   -0.02, 0.25,  0);
+  decode(19200,  1,   -0.01, 0.30,  1);
+  decode(115200, 1,    0.01, 0.30,  0);
+  decode(115200, 2,    0.00, 0.40,  0.5);
+
+  printf("out of tolerance\n");
+  {
+    // Interrupt latency varying by more than half a bit must show up as errors, else the simulator proves nothing
+    std::vector<uint8_t> sent = stream(512);
+    Line line = transmit(sent, 115200, 0, 1, 0);
+    Result result = receive(line, 115200, 0.05, 0.9, 1.0);
+    uint32_t wrong = mismatches(sent, result.data);
+    CHECK(wrong > 0);
+    printf("  115200 baud 8N1, latency jitter 0.90 bit: %u chars, %u wrong\n", (uint32_t)sent.size(), wrong);
+  }
+
+  printf("%u checks, %u failures\n", checks, failures);
+  return failures ? 1 : 0;
+}
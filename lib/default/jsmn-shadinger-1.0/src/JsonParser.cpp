@@ -537,6 +537,124 @@ const char * JsonParserObject::findConstCharNull(const char * needle) const {
 //   return JsonParserToken(&token_bad);
 // }
 
+/*********************************************************************************************\
+ * Zero-copy path query
+ *
+ * Walks the raw json text and skips values without tokenizing them.
+ * Keys are compared as-is, like JSMN_KEY tokens which are not unescaped.
+\*********************************************************************************************/
+
+static const char * json_skip_ws(const char * p) {
+  while ((' ' == *p) || ('\t' == *p) || ('\r' == *p) || ('\n' == *p)) { p++; }
+  return p;
+}
+
+// p points to the opening quote, returns pointer after the closing quote or nullptr
+static const char * json_skip_string(const char * p) {
+  p++;
+  while (*p && (*p != '"')) {
+    if ('\\' == *p) {
+      p++;
+      if (0 == *p) { return nullptr; }
+    }
+    p++;
+  }
+  return (*p) ? p + 1 : nullptr;
+}
+
+// returns pointer after the value or nullptr if the json is malformed
+static const char * json_skip_value(const char * p) {
+  if ('"' == *p) { return json_skip_string(p); }
+  if (('{' == *p) || ('[' == *p)) {
+    uint32_t depth = 0;
+    while (*p) {
+      if ('"' == *p) {
+        p = json_skip_string(p);
+        if (nullptr == p) { return nullptr; }
+        continue;
+      }
+      if (('{' == *p) || ('[' == *p)) { depth++; }
+      else if (('}' == *p) || (']' == *p)) {
+        depth--;
+        if (0 == depth) { return p + 1; }
+      }
+      p++;
+    }
+    return nullptr;
+  }
+  const char * start = p;
+  while (*p && (*p != ',') && (*p != '}') && (*p != ']') && (*p != ' ') && (*p != '\t') && (*p != '\r') && (*p != '\n')) { p++; }
+  return (p != start) ? p : nullptr;
+}
+
+const char * JsonParser::findPath(const char * json_in, const char * path, char delim, size_t * len) {
+  if ((nullptr == json_in) || (nullptr == path)) { return nullptr; }
+  const char * p = json_skip_ws(json_in);
+  const char * key_needle = path;
+  while (true) {
+    const char * key_needle_end = strchr(key_needle, delim);
+    if (nullptr == key_needle_end) { key_needle_end = key_needle + strlen(key_needle); }
+    size_t needle_len = key_needle_end - key_needle;
+    bool wildcard = (1 == needle_len) && ('?' == *key_needle);
+
+    if ('{' != *p) { return nullptr; }    // only objects have keys
+    p = json_skip_ws(p + 1);
+    const char * value = nullptr;
+    while ('"' == *p) {
+      const char * key = p + 1;
+      p = json_skip_string(p);
+      if (nullptr == p) { return nullptr; }
+      size_t key_len = p - key - 1;
+      p = json_skip_ws(p);
+      if (':' != *p) { return nullptr; }
+      p = json_skip_ws(p + 1);
+      if (wildcard || ((key_len == needle_len) && (0 == strncasecmp(key, key_needle, needle_len)))) {
+        value = p;
+        break;
+      }
+      p = json_skip_value(p);
+      if (nullptr == p) { return nullptr; }
+      p = json_skip_ws(p);
+      if (',' != *p) { break; }           // end of object
+      p = json_skip_ws(p + 1);
+    }
+    if (nullptr == value) { return nullptr; }
+
+    if (0 == *key_needle_end) {            // last key, found
+      const char * value_end = json_skip_value(value);
+      if (nullptr == value_end) { return nullptr; }
+      if (len) { *len = value_end - value; }
+      return value;
+    }
+    key_needle = key_needle_end + 1;
+  }
+}
+
+const char * JsonParser::nextKey(const char * json_in, const char * key, size_t * len) {
+  if (nullptr == json_in) { return nullptr; }
+  const char * p;
+  if (nullptr == key) {
+    p = json_skip_ws(json_in);
+    if ('{' != *p) { return nullptr; }    // only objects have keys
+    p = json_skip_ws(p + 1);
+  } else {
+    p = json_skip_string(key - 1);        // back to the opening quote
+    if (nullptr == p) { return nullptr; }
+    p = json_skip_ws(p);
+    if (':' != *p) { return nullptr; }
+    p = json_skip_value(json_skip_ws(p + 1));
+    if (nullptr == p) { return nullptr; }
+    p = json_skip_ws(p);
+    if (',' != *p) { return nullptr; }    // end of object
+    p = json_skip_ws(p + 1);
+  }
+  if ('"' != *p) { return nullptr; }
+  const char * key_end = json_skip_string(p);
+  if (nullptr == key_end) { return nullptr; }
+  if (len) { *len = key_end - p - 2; }
+  return p + 1;
+}
+
 void JsonParser::free(void) {
   if (nullptr != _tokens) {
     delete[] _tokens;     // TODO
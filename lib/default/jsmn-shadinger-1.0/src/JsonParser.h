@@ -245,6 +245,18 @@ public:
   // pointer arithmetic
   // ptrdiff_t index(JsonParserToken token) const;
 
+  // Zero-copy path query, no token is allocated and the buffer is not modified
+  // Scans `json_in` for the value at `path`, a list of keys separated by `delim` (case-insensitive,
+  // '?' matches any key), and stops as soon as it is found.
+  // Returns a pointer to the value in `json_in` and sets `len` to its length, or nullptr if not found
+  // Input: `path` CANNOT be in PROGMEM
+  static const char * findPath(const char * json_in, const char * path, char delim, size_t * len);
+
+  // Zero-copy iteration over the keys of the root object
+  // Pass `key` as nullptr to get the first key, then the previous result to get the next one.
+  // Returns a pointer to the key text (without quotes) and sets `len` to its length, or nullptr when done
+  static const char * nextKey(const char * json_in, const char * key, size_t * len);
+
 protected:
   uint16_t    _size;          // size of tokens buffer
   int16_t    _token_len;      // how many tokens have been parsed
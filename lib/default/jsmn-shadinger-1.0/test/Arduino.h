@@ -0,0 +1,30 @@
+/*
+  Arduino.h - minimal host shim to build JsonParser on a PC for tests and benchmarks
+*/
+
+#ifndef __ARDUINO_HOST_SHIM__
+#define __ARDUINO_HOST_SHIM__
+
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <string>
+#include <algorithm>
+
+#define PROGMEM
+#define pgm_read_byte(x)          (*(const uint8_t*)(x))
+#define strcmp_P(x, y)            strcmp(x, y)
+#define strcasecmp_P(x, y)        strcasecmp(x, y)
+
+class __FlashStringHelper;
+
+class String : public std::string {
+public:
+  String(const char * s = "") : std::string(s ? s : "") {}
+  String(const __FlashStringHelper * s) : std::string((const char*)s) {}
+  void toLowerCase(void) { std::transform(begin(), end(), begin(), ::tolower); }
+  bool startsWith(const String & s) const { return 0 == compare(0, s.size(), s); }
+};
+
+#endif // __ARDUINO_HOST_SHIM__
@@ -0,0 +1,95 @@
+// Host benchmark of JsonParser full parsing versus JsonParser::findPath() on Tasmota payloads
+//
+// g++ -O2 -I. -I../src bench-json.cpp ../src/JsonParser.cpp ../src/jsmn.cpp -o bench-json && ./bench-json
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "../src/JsonParser.h"
+
+static const char tele_sensor[] = "{\"Time\":\"2023-04-01T12:00:00\",\"ENERGY\":{\"TotalStartTime\":\"2022-11-06T14:05:13\",\"Total\":123.456,\"Yesterday\":1.234,\"Today\":0.567,\"Period\":12,\"Power\":245,\"ApparentPower\":260,\"ReactivePower\":85,\"Factor\":0.94,\"Voltage\":231,\"Current\":1.125},\"AM2301\":{\"Temperature\":21.3,\"Humidity\":45.6,\"DewPoint\":9.1},\"TempUnit\":\"C\"}";
+static const char zb_received[] = "{\"ZbReceived\":{\"0x9C33\":{\"Device\":\"0x9C33\",\"Name\":\"Kitchen\",\"Illuminance\":42,\"Occupancy\":1,\"Endpoint\":1,\"LinkQuality\":59}}}";
+static const char tele_state[] = "{\"Time\":\"2023-04-01T12:00:00\",\"Uptime\":\"3T04:05:06\",\"UptimeSec\":273906,\"Heap\":25,\"SleepMode\":\"Dynamic\",\"Sleep\":50,\"LoadAvg\":19,\"MqttCount\":3,\"POWER1\":\"ON\",\"POWER2\":\"OFF\",\"Dimmer\":75,\"Color\":\"BF8040\",\"HSBColor\":\"30,67,75\",\"Channel\":[75,50,25],\"Scheme\":0,\"Fade\":\"OFF\",\"Speed\":1,\"LedTable\":\"ON\",\"Wifi\":{\"AP\":1,\"SSId\":\"home\",\"BSSId\":\"AA:BB:CC:DD:EE:FF\",\"Channel\":6,\"Mode\":\"11n\",\"RSSI\":72,\"Signal\":-64,\"LinkCount\":1,\"Downtime\":\"0T00:00:03\"}}";
+
+typedef struct {
+  const char * name;
+  const char * json;
+  const char * path;
+} bench_t;
+
+static const bench_t benches[] = {
+  { "SENSOR first key", tele_sensor, "ENERGY#Total" },
+  { "SENSOR last key",  tele_sensor, "AM2301#DewPoint" },
+  { "ZbReceived",       zb_received, "ZbReceived#?#Occupancy" },
+  { "STATE Wifi",       tele_state,  "Wifi#RSSI" },
+  { "STATE not found",  tele_state,  "Wifi#Missing" },
+};
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Same steps as RulesRuleMatch() before: copy, parse and walk down the keys
+static const char * full_parse(char * buf, const char * json, const char * path, char * out, size_t out_len) {
+  strcpy(buf, json);
+  JsonParser parser(buf);
+  JsonParserObject obj = parser.getRootObject();
+  char key[64];
+  const char * p = path;
+  while (true) {
+    const char * d = strchr(p, '#');
+    size_t l = d ? d - p : strlen(p);
+    memcpy(key, p, l);
+    key[l] = 0;
+    if (!d) { break; }
+    obj = obj[key].getObject();
+    p = d + 1;
+  }
+  JsonParserToken val = obj[key];
+  if (!val) { return nullptr; }
+  strncpy(out, val.getStr(), out_len);
+  return out;
+}
+
+static const char * find_path(const char * json, const char * path, char * out, size_t out_len) {
+  size_t len;
+  const char * val = JsonParser::findPath(json, path, '#', &len);
+  if (!val) { return nullptr; }
+  if (len >= out_len) { len = out_len - 1; }
+  memcpy(out, val, len);
+  out[len] = 0;
+  return out;
+}
+
+int main(int argc, char* argv[]) {
+  const uint32_t loops = 200000;
+  char buf[1024];
+  char out_full[64];
+  char out_find[64];
+
+  printf("%-18s %12s %12s %8s  value\n", "payload", "parse ns/op", "find ns/op", "speedup");
+  for (uint32_t b = 0; b < sizeof(benches) / sizeof(benches[0]); b++) {
+    const bench_t & bench = benches[b];
+
+    const char * r_full = full_parse(buf, bench.json, bench.path, out_full, sizeof(out_full));
+    const char * r_find = find_path(bench.json, bench.path, out_find, sizeof(out_find));
+    if ((nullptr == r_full) != (nullptr == r_find) || (r_full && strcmp(r_full, r_find))) {
+      printf("%-18s MISMATCH '%s' != '%s'\n", bench.name, r_full ? r_full : "null", r_find ? r_find : "null");
+      return 1;
+    }
+
+    double t0 = now_ns();
+    for (uint32_t i = 0; i < loops; i++) { full_parse(buf, bench.json, bench.path, out_full, sizeof(out_full)); }
+    double t1 = now_ns();
+    for (uint32_t i = 0; i < loops; i++) { find_path(bench.json, bench.path, out_find, sizeof(out_find)); }
+    double t2 = now_ns();
+
+    double full_ns = (t1 - t0) / loops;
+    double find_ns = (t2 - t1) / loops;
+    printf("%-18s %12.1f %12.1f %7.1fx  %s\n", bench.name, full_ns, find_ns, full_ns / find_ns, r_find ? r_find : "(not found)");
+  }
+  return 0;
+}
@@ -0,0 +1,195 @@
+// Host benchmark of the Tasmota rule engine steps per event, text rescan versus compiled trigger table
+//
+// Both engines follow RuleSetProcess() with std::string in place of Arduino String:
+// - text:     rule text is copied, upper-cased and scanned for " DO "/" ENDON" on every event, every trigger
+//             looks up its path and matched commands go through all variable substitutions
+// - compiled: the trigger table is built once, only triggers whose first key is a root key of the event
+//             look up their path and matched commands only substitute the variables they reference
+//
+// g++ -O2 -I. -I../src bench-rules.cpp ../src/JsonParser.cpp ../src/jsmn.cpp -o bench-rules && ./bench-rules
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "../src/JsonParser.h"
+
+static const char rule_set[] =
+  "on Power1#State=1 do Backlog Dimmer 50;Color %var1% endon "
+  "on Switch1#State do Power2 %value% endon "
+  "on ENERGY#Power>2000 do Publish stat/%topic%/alarm %value% endon "
+  "on tele-AM2301#Temperature>25 do Power3 on endon "
+  "on Time#Minute|5 do Var2 %uptime% endon "
+  "on Event#Check do Backlog Var1 %mem1%;Event Done=%var1% endon "
+  "on Mqtt#Connected do Publish stat/%topic%/ip %macaddr% endon "
+  "on System#Boot do RuleTimer1 60 endon";
+
+static const char * const events[] = {
+  "{\"TIME\":\"2023-04-01T12:00:00\",\"ENERGY\":{\"TOTALSTARTTIME\":\"2022-11-06T14:05:13\",\"TOTAL\":123.456,\"YESTERDAY\":1.234,\"TODAY\":0.567,\"PERIOD\":12,\"POWER\":245,\"APPARENTPOWER\":260,\"REACTIVEPOWER\":85,\"FACTOR\":0.94,\"VOLTAGE\":231,\"CURRENT\":1.125},\"AM2301\":{\"TEMPERATURE\":21.3,\"HUMIDITY\":45.6,\"DEWPOINT\":9.1},\"TEMPUNIT\":\"C\"}",
+  "{\"TIME\":{\"MINUTE\":725}}",
+  "{\"POWER1\":{\"STATE\":1}}",
+  "{\"SWITCH1\":{\"STATE\":0}}",
+};
+
+static const char * const variables[] = {
+  "%VALUE%", "%VAR1%", "%VAR2%", "%VAR3%", "%VAR4%", "%VAR5%", "%MEM1%", "%MEM2%", "%MEM3%", "%MEM4%", "%MEM5%",
+  "%TIME%", "%UTCTIME%", "%UPTIME%", "%TIMESTAMP%", "%TOPIC%", "%DEVICEID%", "%MACADDR%",
+  "%TIMER1%", "%TIMER2%", "%TIMER3%", "%TIMER4%", "%SUNRISE%", "%SUNSET%", "%COLOR%"
+};
+static const uint32_t variables_count = sizeof(variables) / sizeof(variables[0]);
+
+static volatile uint32_t sink;               // keeps results alive
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static std::string upper(const std::string & s) {
+  std::string u = s;
+  std::transform(u.begin(), u.end(), u.begin(), ::toupper);
+  return u;
+}
+
+static std::string trim(const std::string & s) {
+  size_t b = s.find_first_not_of(' ');
+  if (std::string::npos == b) { return ""; }
+  return s.substr(b, s.find_last_not_of(' ') - b + 1);
+}
+
+// Same steps as RulesVarReplace(): case-insensitive search on an upper-cased copy
+static void var_replace(std::string & commands, const char * find, const char * replace) {
+  std::string ucommands = upper(commands);
+  size_t pos = 0;
+  while ((pos = ucommands.find(find, pos)) != std::string::npos) {
+    commands.replace(pos, strlen(find), replace);
+    ucommands.replace(pos, strlen(find), replace);
+    pos += strlen(replace);
+  }
+}
+
+// First key and value lookup of RulesRuleMatch(), the comparison itself is the same for both engines
+static bool trigger_match(const char * event, const std::string & trigger) {
+  std::string name = trigger.substr(0, trigger.find_first_of("=<>|!$^"));
+  if (0 == name.compare(0, 5, "TELE-")) { name = name.substr(5); }
+  size_t len;
+  return (nullptr != JsonParser::findPath(event, name.c_str(), '#', &len));
+}
+
+static uint32_t run_text(const char * event) {
+  uint32_t executed = 0;
+  std::string rules = rule_set;
+  size_t plen = 0;
+  while (true) {
+    rules = trim(rules.substr(std::min(plen, rules.length())));
+    if (rules.empty()) { break; }
+    std::string rule = upper(rules);
+    if (rule.compare(0, 3, "ON ")) { break; }
+    size_t pevt = rule.find(" DO ");
+    if (std::string::npos == pevt) { break; }
+    std::string event_trigger = trim(rule.substr(3, pevt - 3));
+    plen = rule.find(" ENDON");
+    if (std::string::npos == plen) { break; }
+    std::string commands = rules.substr(pevt + 4, plen - pevt - 4);
+    std::string event_copy = event;
+    if (trigger_match(event_copy.c_str(), event_trigger)) {
+      commands = trim(commands);
+      for (uint32_t i = 0; i < variables_count; i++) { var_replace(commands, variables[i], "1"); }
+      executed += commands.length();
+    }
+    plen += 6;
+  }
+  return executed;
+}
+
+typedef struct {
+  std::string trigger;
+  std::string commands;
+  std::string key;
+  uint32_t refs;
+} trigger_t;
+
+static std::vector<trigger_t> compile(void) {
+  std::vector<trigger_t> table;
+  std::string rules = rule_set;
+  size_t plen = 0;
+  while (true) {
+    rules = trim(rules.substr(std::min(plen, rules.length())));
+    if (rules.empty()) { break; }
+    std::string rule = upper(rules);
+    size_t pevt = rule.find(" DO ");
+    plen = rule.find(" ENDON");
+    if ((std::string::npos == pevt) || (std::string::npos == plen)) { break; }
+    trigger_t t;
+    t.trigger = trim(rule.substr(3, pevt - 3));
+    t.commands = trim(rules.substr(pevt + 4, plen - pevt - 4));
+    std::string name = t.trigger.substr(0, t.trigger.find_first_of("#=<>|!$^"));
+    t.key = (0 == name.compare(0, 5, "TELE-")) ? name.substr(5) : name;
+    t.refs = 0;
+    std::string ucommands = upper(t.commands);
+    for (uint32_t i = 0; i < variables_count; i++) {
+      if (ucommands.find(variables[i]) != std::string::npos) { t.refs |= 1 << i; }
+    }
+    table.push_back(t);
+    plen += 6;
+  }
+  return table;
+}
+
+static uint32_t run_compiled(const std::vector<trigger_t> & table, const char * event) {
+  uint32_t executed = 0;
+  const char * keys[24];
+  size_t keys_len[24];
+  uint32_t key_count = 0;
+  size_t len;
+  for (const char * key = JsonParser::nextKey(event, nullptr, &len); key && (key_count < 24); key = JsonParser::nextKey(event, key, &len)) {
+    keys[key_count] = key;
+    keys_len[key_count++] = len;
+  }
+  for (const trigger_t & t : table) {
+    uint32_t i = 0;
+    while ((i < key_count) && ((keys_len[i] != t.key.length()) || strncasecmp(keys[i], t.key.c_str(), keys_len[i]))) { i++; }
+    if (i == key_count) { continue; }
+    if (trigger_match(event, t.trigger)) {
+      std::string commands = t.commands;
+      for (uint32_t v = 0; v < variables_count; v++) {
+        if (t.refs & (1 << v)) { var_replace(commands, variables[v], "1"); }
+      }
+      executed += commands.length();
+    }
+  }
+  return executed;
+}
+
+int main(int argc, char* argv[]) {
+  const uint32_t loops = 20000;
+  const uint32_t events_count = sizeof(events) / sizeof(events[0]);
+
+  double t0 = now_ns();
+  std::vector<trigger_t> table = compile();
+  double compile_ns = now_ns() - t0;
+  printf("compiled %u triggers in %.1f us\n", (uint32_t)table.size(), compile_ns / 1000);
+
+  printf("%-8s %12s %12s %8s\n", "event", "text ns/op", "table ns/op", "speedup");
+  for (uint32_t e = 0; e < events_count; e++) {
+    if (run_text(events[e]) != run_compiled(table, events[e])) {
+      printf("event %u MISMATCH\n", e);
+      return 1;
+    }
+    double t1 = now_ns();
+    for (uint32_t i = 0; i < loops; i++) { sink += run_text(events[e]); }
+    double t2 = now_ns();
+    for (uint32_t i = 0; i < loops; i++) { sink += run_compiled(table, events[e]); }
+    double t3 = now_ns();
+
+    double text_ns = (t2 - t1) / loops;
+    double table_ns = (t3 - t2) / loops;
+    printf("%-8u %12.1f %12.1f %7.1fx\n", e, text_ns, table_ns, text_ns / table_ns);
+  }
+  return 0;
+}
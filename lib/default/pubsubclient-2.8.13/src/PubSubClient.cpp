@@ -338,6 +338,26 @@ boolean PubSubClient::readByte(uint8_t * result, uint16_t * index){
   return false;
 }
 
+// Start Tasmota patch
+// reads up to size bytes into result, waiting for at least one
+// returns the number of bytes read or 0 on timeout
+uint16_t PubSubClient::readBytes(uint8_t * result, uint16_t size) {
+  if (!size || !readByte(result)) {
+    return 0;
+  }
+  uint16_t count = 1;
+  int available = _client->available();
+  if ((available > 0) && (count < size)) {
+    uint16_t wanted = (available < size - count) ? available : size - count;
+    int received = _client->read(result + count, wanted);
+    if (received > 0) {
+      count += received;
+    }
+  }
+  return count;
+}
+// End Tasmota patch
+
 uint32_t PubSubClient::readPacket(uint8_t* lengthLength) {
     uint16_t len = 0;
     if(!readByte(this->buffer, &len)) return 0;
@@ -378,9 +398,77 @@ uint32_t PubSubClient::readPacket(uint8_t* lengthLength) {
             // skip message id
             skip += 2;
         }
+
+// Start Tasmota patch
+        this->streamed = false;
+        if (this->streamCallback && !this->stream && (len + skip + 1 < this->bufferSize) && (length >= start + skip)) {
+            // Read topic and message id so the stream callback can decide on the topic
+            for (uint16_t i = 0; i < skip; ) {
+                uint16_t received = readBytes(this->buffer + len + i, skip - i);
+                if (!received) return 0;
+                i += received;
+            }
+            len += skip;
+            start += skip;
+            uint8_t llen = *lengthLength;
+            uint16_t tl = (this->buffer[0]&MQTTQOS1) ? skip - 2 : skip;
+            uint32_t total = length - start;
+            memmove(this->buffer+llen+2,this->buffer+llen+3,tl); /* move topic inside buffer 1 byte to front */
+            this->buffer[llen+2+tl] = 0; /* end the topic as a 'C' string with \x00 */
+            char *topic = (char*) this->buffer+llen+2;
+            if (this->streamCallback(topic, nullptr, 0, 0, total)) {
+                // The callback may publish, which reuses the buffer, so keep header, topic and message id apart
+                uint8_t header = this->buffer[0];
+                char *stream_topic = (char*)malloc(tl + 1);
+                if (!stream_topic) return 0;
+                memcpy(stream_topic, topic, tl + 1);
+                this->streamMsgId = (this->buffer[0]&MQTTQOS1) ? (this->buffer[llen+3+tl]<<8)+this->buffer[llen+3+tl+1] : 0;
+                // Pass the payload in chunks using the free buffer space after topic and message id
+                uint8_t *chunk = this->buffer + len;
+                uint16_t chunk_size = this->bufferSize - len - 1;  // Room for string terminator
+                bool wanted = true;
+                for (uint32_t index = 0; index < total; ) {
+                    uint32_t size = total - index;
+                    if (size > chunk_size) { size = chunk_size; }
+                    uint16_t received = readBytes(chunk, size);
+                    if (!received) {
+                        free(stream_topic);
+                        return 0;
+                    }
+                    chunk[received] = 0;
+                    if (wanted) {
+                        wanted = this->streamCallback(stream_topic, chunk, received, index, total);  // Skip remainder on false
+                    }
+                    index += received;
+                }
+                free(stream_topic);
+                this->buffer[0] = header;
+                this->streamed = true;
+                return len;
+            }
+            memmove(this->buffer+llen+3,this->buffer+llen+2,tl); /* declined so restore topic and its length */
+            this->buffer[llen+2] = tl & 0xFF;
+        }
+// End Tasmota patch
+
     }
     uint32_t idx = len;
 
+// Start Tasmota patch
+    if (!this->stream) {
+        // Read the payload in bulk straight into the buffer
+        while ((start < length) && (len < this->bufferSize)) {
+            uint32_t size = length - start;
+            if (size > (uint32_t)(this->bufferSize - len)) { size = this->bufferSize - len; }
+            uint16_t received = readBytes(this->buffer + len, size);
+            if (!received) return 0;
+            len += received;
+            idx += received;
+            start += received;
+        }
+    }
+// End Tasmota patch
+
     for (uint32_t i = start;i<length;i++) {
         if(!readByte(&digit)) return 0;
         if (this->stream) {
@@ -437,6 +525,24 @@ boolean PubSubClient::loop() {
                 lastInActivity = t;
                 uint8_t type = this->buffer[0]&0xF0;
                 if (type == MQTTPUBLISH) {
+
+// Start Tasmota patch
+                    if (this->streamed) {
+                        // Payload already passed to the stream callback by readPacket
+                        this->streamed = false;
+                        if ((this->buffer[0]&0x06) == MQTTQOS1) {
+                            msgId = this->streamMsgId;
+                            this->buffer[0] = MQTTPUBACK;
+                            this->buffer[1] = 2;
+                            this->buffer[2] = (msgId >> 8);
+                            this->buffer[3] = (msgId & 0xFF);
+                            if (_client->write(this->buffer,4) != 0) {
+                              lastOutActivity = t;
+                            }
+                        }
+                    } else
+// End Tasmota patch
+
                     if (callback) {
                         uint16_t tl = (this->buffer[llen+1]<<8)+this->buffer[llen+2]; /* topic length in bytes */
 
@@ -859,6 +965,13 @@ PubSubClient& PubSubClient::setCallback(MQTT_CALLBACK_SIGNATURE) {
     return *this;
 }
 
+// Start Tasmota patch
+PubSubClient& PubSubClient::setStreamCallback(MQTT_STREAM_CALLBACK_SIGNATURE) {
+    this->streamCallback = streamCallback;
+    return *this;
+}
+// End Tasmota patch
+
 PubSubClient& PubSubClient::setClient(Client& client){
     this->_client = &client;
     return *this;
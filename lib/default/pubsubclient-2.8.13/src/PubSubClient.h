@@ -84,6 +84,18 @@
 #define MQTT_CALLBACK_SIGNATURE void (*callback)(char*, uint8_t*, unsigned int)
 #endif
 
+// Start Tasmota patch
+// Streaming receive: (topic, chunk, chunk length, payload offset of chunk, total payload length)
+// First called once with chunk == nullptr to ask if the topic wants the payload streamed
+// Chunks are terminated with \x00 beyond their length
+// The topic stays valid while streaming; a chunk is only valid until the callback publishes
+#if defined(ESP8266) || defined(ESP32)
+#define MQTT_STREAM_CALLBACK_SIGNATURE std::function<bool(char*, uint8_t*, unsigned int, unsigned int, unsigned int)> streamCallback
+#else
+#define MQTT_STREAM_CALLBACK_SIGNATURE bool (*streamCallback)(char*, uint8_t*, unsigned int, unsigned int, unsigned int)
+#endif
+// End Tasmota patch
+
 #define CHECK_STRING_LENGTH(l,s) if (l+2+strnlen(s, this->bufferSize) > this->bufferSize) {_client->stop();return false;}
 
 class PubSubClient : public Print {
@@ -101,6 +113,14 @@ private:
    uint32_t readPacket(uint8_t*);
    boolean readByte(uint8_t * result);
    boolean readByte(uint8_t * result, uint16_t * index);
+
+// Start Tasmota patch
+   MQTT_STREAM_CALLBACK_SIGNATURE = nullptr;
+   bool streamed = false;
+   uint16_t streamMsgId = 0;
+   uint16_t readBytes(uint8_t * result, uint16_t size);
+// End Tasmota patch
+
    boolean write(uint8_t header, uint8_t* buf, uint16_t length);
    uint16_t writeString(const char* string, uint8_t* buf, uint16_t pos);
    // Build up the header ready to send
@@ -141,6 +161,13 @@ public:
    PubSubClient& setServer(uint8_t * ip, uint16_t port);
    PubSubClient& setServer(const char * domain, uint16_t port);
    PubSubClient& setCallback(MQTT_CALLBACK_SIGNATURE);
+
+// Start Tasmota patch
+   // Publish payloads are passed in chunks straight from the socket to the stream callback
+   // for every topic it accepts, independent of the buffer size
+   PubSubClient& setStreamCallback(MQTT_STREAM_CALLBACK_SIGNATURE);
+// End Tasmota patch
+
    PubSubClient& setClient(Client& client);
    PubSubClient& setStream(Stream& stream);
    PubSubClient& setKeepAlive(uint16_t keepAlive);
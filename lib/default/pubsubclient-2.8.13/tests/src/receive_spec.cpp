@@ -27,6 +27,45 @@ void callback(char* topic, byte* payload, unsigned int length) {
     lastLength = length;
 }
 
+bool stream_accept = true;
+unsigned int stream_calls = 0;
+unsigned int stream_received = 0;
+unsigned int stream_total = 0;
+char streamTopic[1024];
+char streamPayload[1024];
+
+PubSubClient* stream_publisher = nullptr;
+bool stream_topic_kept = true;
+
+void reset_stream_callback(bool accept) {
+    stream_accept = accept;
+    stream_calls = 0;
+    stream_received = 0;
+    stream_total = 0;
+    streamTopic[0] = '\0';
+    stream_publisher = nullptr;
+    stream_topic_kept = true;
+}
+
+bool stream_callback(char* topic, byte* chunk, unsigned int length, unsigned int index, unsigned int total) {
+    TRACE("Stream callback received topic=[" << topic << "] length=" << length << " index=" << index << " total=" << total << "\n")
+    if (chunk == nullptr) {
+        strcpy(streamTopic,topic);
+        stream_total = total;
+        return stream_accept;
+    }
+    if (strcmp(streamTopic,topic) != 0) {
+        stream_topic_kept = false;
+    }
+    if (stream_publisher && (index == 0)) {
+        stream_publisher->publish("out","x");    // Reuses the buffer holding topic and message id
+    }
+    stream_calls++;
+    memcpy(streamPayload+index,chunk,length);
+    stream_received += length;
+    return true;
+}
+
 int test_receive_callback() {
     IT("receives a callback message");
     reset_callback();
@@ -324,6 +363,129 @@ int test_receive_qos1() {
     END_IT
 }
 
+int test_receive_stream_callback() {
+    IT("passes an oversized message in chunks to the stream callback");
+    reset_callback();
+    reset_stream_callback(true);
+
+    ShimClient shimClient;
+    shimClient.setAllowConnect(true);
+
+    byte connack[] = { 0x20, 0x02, 0x00, 0x00 };
+    shimClient.respond(connack,4);
+
+    PubSubClient client(server, 1883, callback, shimClient);
+    client.setStreamCallback(stream_callback);
+    client.setBufferSize(30);
+    int rc = client.connect((char*)"client_test1");
+    IS_TRUE(rc);
+
+    byte publish[] = {0x32,0x59,0x0,0x5,0x74,0x6f,0x70,0x69,0x63,0x12,0x34};
+    byte bigPublish[91];
+    memcpy(bigPublish,publish,11);
+    for (int i = 0; i < 80; i++) {
+        bigPublish[11+i] = 'a' + (i % 26);
+    }
+    shimClient.respond(bigPublish,91);
+
+    byte puback[] = {0x40,0x2,0x12,0x34};
+    shimClient.expect(puback,4);
+
+    rc = client.loop();
+
+    IS_TRUE(rc);
+
+    IS_FALSE(callback_called);
+    IS_TRUE(strcmp(streamTopic,"topic")==0);
+    IS_TRUE(stream_total == 80);
+    IS_TRUE(stream_received == 80);
+    IS_TRUE(stream_calls > 1);
+    IS_TRUE(memcmp(streamPayload,bigPublish+11,80)==0);
+
+    IS_FALSE(shimClient.error());
+
+    END_IT
+}
+
+int test_receive_stream_callback_publish() {
+    IT("keeps topic and message id when the stream callback publishes");
+    reset_callback();
+    reset_stream_callback(true);
+
+    ShimClient shimClient;
+    shimClient.setAllowConnect(true);
+
+    byte connack[] = { 0x20, 0x02, 0x00, 0x00 };
+    shimClient.respond(connack,4);
+
+    PubSubClient client(server, 1883, callback, shimClient);
+    client.setStreamCallback(stream_callback);
+    client.setBufferSize(30);
+    int rc = client.connect((char*)"client_test1");
+    IS_TRUE(rc);
+    stream_publisher = &client;
+
+    byte publish[] = {0x32,0x59,0x0,0x5,0x74,0x6f,0x70,0x69,0x63,0x12,0x34};
+    byte bigPublish[91];
+    memcpy(bigPublish,publish,11);
+    for (int i = 0; i < 80; i++) {
+        bigPublish[11+i] = 'a' + (i % 26);
+    }
+    shimClient.respond(bigPublish,91);
+
+    byte expected[] = {0x30,0x6,0x0,0x3,0x6f,0x75,0x74,0x78,0x40,0x2,0x12,0x34};
+    shimClient.expect(expected,12);
+
+    rc = client.loop();
+
+    IS_TRUE(rc);
+
+    IS_FALSE(callback_called);
+    IS_TRUE(stream_topic_kept);
+    IS_TRUE(stream_received == 80);
+    IS_TRUE(stream_calls > 1);
+    IS_TRUE(memcmp(streamPayload,bigPublish+11,80)==0);
+
+    IS_FALSE(shimClient.error());
+
+    END_IT
+}
+
+int test_receive_stream_callback_declined() {
+    IT("falls back to the callback when the stream callback declines");
+    reset_callback();
+    reset_stream_callback(false);
+
+    ShimClient shimClient;
+    shimClient.setAllowConnect(true);
+
+    byte connack[] = { 0x20, 0x02, 0x00, 0x00 };
+    shimClient.respond(connack,4);
+
+    PubSubClient client(server, 1883, callback, shimClient);
+    client.setStreamCallback(stream_callback);
+    int rc = client.connect((char*)"client_test1");
+    IS_TRUE(rc);
+
+    byte publish[] = {0x30,0xe,0x0,0x5,0x74,0x6f,0x70,0x69,0x63,0x70,0x61,0x79,0x6c,0x6f,0x61,0x64};
+    shimClient.respond(publish,16);
+
+    rc = client.loop();
+
+    IS_TRUE(rc);
+
+    IS_TRUE(strcmp(streamTopic,"topic")==0);
+    IS_TRUE(stream_calls == 0);
+    IS_TRUE(callback_called);
+    IS_TRUE(strcmp(lastTopic,"topic")==0);
+    IS_TRUE(memcmp(lastPayload,"payload",7)==0);
+    IS_TRUE(lastLength == 7);
+
+    IS_FALSE(shimClient.error());
+
+    END_IT
+}
+
 int main()
 {
     SUITE("Receive");
@@ -335,6 +497,9 @@ int main()
     test_resize_buffer();
     test_receive_oversized_stream_message();
     test_receive_qos1();
+    test_receive_stream_callback();
+    test_receive_stream_callback_publish();
+    test_receive_stream_callback_declined();
 
     FINISH
 }
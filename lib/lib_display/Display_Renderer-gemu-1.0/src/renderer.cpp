@@ -639,6 +639,21 @@ void Renderer::ep_update_mode(uint8_t mode) {
 void Renderer::ep_update_area(uint16_t xp, uint16_t yp, uint16_t width, uint16_t height, uint8_t mode) {
 }
 
+bool Renderer::dmaBusy(void) {
+  return false;
+}
+
+void Renderer::dmaWait(void) {
+}
+
+bool Renderer::SetFlushDoneCB(flush_done_cb cb, void *arg) {
+  return false;
+}
+
+uint8_t Renderer::lvgl_pixel_bytes(void) {
+  return 2;
+}
+
 
 // #ifndef USE_DISPLAY_LVGL_ONLY
 
@@ -46,6 +46,7 @@ typedef struct LVGL_PARAMS {
 
 typedef void (*pwr_cb)(uint8_t);
 typedef void (*dim_cb)(uint8_t);
+typedef void (*flush_done_cb)(void *);
 
 #define USE_GFX
 
@@ -90,6 +91,10 @@ public:
   virtual LVGL_PARAMS *lvgl_pars(void);
   virtual void ep_update_mode(uint8_t mode);
   virtual void ep_update_area(uint16_t xp, uint16_t yp, uint16_t width, uint16_t height, uint8_t mode);
+  virtual bool dmaBusy(void);   // poll asynchronous DMA transfer, true while in progress
+  virtual void dmaWait(void);   // block until asynchronous DMA transfer is done
+  virtual bool SetFlushDoneCB(flush_done_cb cb, void *arg);   // false if the renderer never calls it
+  virtual uint8_t lvgl_pixel_bytes(void);   // bytes per pixel sent to the panel by pushColors()
 
   void setDrawMode(uint8_t mode);
   uint8_t drawmode;
@@ -98,6 +103,8 @@ public:
   virtual uint8_t *allocate_framebuffer(uint32_t size);
   pwr_cb pwr_cbp = 0;
   dim_cb dim_cbp = 0;
+  flush_done_cb flush_done_cbp = 0;   // called when the pixel transfer of setAddrWindow()/pushColors() has ended
+  void *flush_done_arg = 0;
   LVGL_PARAMS lvgl_param;
   int8_t disp_bpp;
 private:
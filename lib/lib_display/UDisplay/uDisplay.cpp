@@ -1024,6 +1024,7 @@ void uDisplay::setAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
       if (!ep_mode) {
         Updateframe();
       }
+      if (flush_done_cbp) flush_done_cbp(flush_done_arg);
     } else {
       seta_xp1 = x0;
       seta_xp2 = x1;
@@ -1035,8 +1036,15 @@ void uDisplay::setAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
   }
 
   if (!x0 && !y0 && !x1 && !y1) {
+#ifdef ESP32
+    if (lvgl_param.async_dma && spiBusyCheck) {
+      dma_end_pending = true;     // transfer still running, end transaction in dmaDone()
+      return;
+    }
+#endif // ESP32
     SPI_CS_HIGH
     SPI_END_TRANSACTION
+    if (flush_done_cbp) flush_done_cbp(flush_done_arg);
   } else {
     SPI_BEGIN_TRANSACTION
     SPI_CS_LOW
@@ -1186,6 +1194,7 @@ void uDisplay::pushColors(uint16_t *data, uint16_t len, boolean not_swapped) {
 
           if (lvgl_param.use_dma) {
             pushPixels3DMA(line, len );
+            dmaWait();            // line is freed below, can't be left to an async transfer
           } else {
             uspi->writeBytes(line, len * 3);
           }
@@ -2083,7 +2092,10 @@ bool uDisplay::dmaBusy(void) {
   }
 
   //Serial.print("spiBusyCheck=");Serial.println(spiBusyCheck);
-  if (spiBusyCheck == 0) return false;
+  if (spiBusyCheck == 0) {
+    dmaDone();
+    return false;
+  }
   return true;
 }
 
@@ -2101,6 +2113,20 @@ void uDisplay::dmaWait(void) {
     assert(ret == ESP_OK);
   }
   spiBusyCheck = 0;
+  dmaDone();
+}
+
+/***************************************************************************************
+** Function name:           dmaDone
+** Description:             End the transaction deferred by setAddrWindow() and signal
+**                          the flush done callback
+***************************************************************************************/
+void uDisplay::dmaDone(void) {
+  if (!dma_end_pending) return;
+  dma_end_pending = false;
+  SPI_CS_HIGH
+  SPI_END_TRANSACTION
+  if (flush_done_cbp) flush_done_cbp(flush_done_arg);
 }
 
 
@@ -100,6 +100,12 @@ class uDisplay : public Renderer {
   void invertDisplay(boolean i);
   void SetPwrCB(pwr_cb cb) { pwr_cbp = cb; };
   void SetDimCB(dim_cb cb) { dim_cbp = cb; };
+  bool SetFlushDoneCB(flush_done_cb cb, void *arg) { flush_done_cbp = cb; flush_done_arg = arg; return true; };
+  uint8_t lvgl_pixel_bytes(void) { return (col_mode == 18) ? 3 : 2; };
+#ifdef ESP32
+  bool dmaBusy(void);
+  void dmaWait(void);
+#endif // ESP32
 
  private:
    void beginTransaction(SPISettings s);
@@ -229,6 +235,7 @@ class uDisplay : public Renderer {
 #ifdef ESP32
    // dma section
    bool DMA_Enabled = false;
+   bool dma_end_pending = false;   // transaction is ended when the async transfer completes
    uint8_t  spiBusyCheck = 0;
    spi_transaction_t trans;
    spi_device_handle_t dmaHAL;
@@ -236,8 +243,7 @@ class uDisplay : public Renderer {
    // spi_host_device_t spi_host = VSPI_HOST;
    bool initDMA(int32_t ctrl_cs);
    void deInitDMA(void);
-   bool dmaBusy(void);
-   void dmaWait(void);
+   void dmaDone(void);
    void pushPixelsDMA(uint16_t* image, uint32_t len);
    void pushPixels3DMA(uint8_t* image, uint32_t len);
 #endif // ESP32
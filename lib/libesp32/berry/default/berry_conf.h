@@ -167,6 +167,29 @@
  **/
 #define BE_USE_DEBUG_HOOK               0
 
+/* Macro: BE_USE_COMPUTED_GOTO
+ * Use a direct-threaded dispatch table (GCC "labels as values")
+ * in the VM main loop instead of a `switch` statement. Each
+ * instruction jumps directly to the next handler which improves
+ * branch prediction, at the cost of slightly larger code.
+ * Requires GCC or Clang.
+ * Default: 0
+ **/
+#ifndef BE_USE_COMPUTED_GOTO
+#define BE_USE_COMPUTED_GOTO            0
+#endif
+
+/* Macro: BE_MEMBER_CACHE_SIZE
+ * Number of entries of the inline cache used by GETMBR, GETMET
+ * and SETMBR to avoid walking the class hierarchy on each access.
+ * Entries are keyed by instruction and class, and the whole cache
+ * is flushed when a class is modified or after each GC.
+ * Must be a power of 2.
+ * 0: no cache, every access walks the class hierarchy.
+ * Default: 32
+ **/
+#define BE_MEMBER_CACHE_SIZE            32
+
 /* Macro: BE_USE_DEBUG_GC
  * Enable GC debug mode. This causes an actual gc after each
  * allocation. It's much slower and should not be used
@@ -175,6 +198,25 @@
  **/
 #define BE_USE_DEBUG_GC                  0
 
+/* Macro: BE_GC_SWEEP_BUDGET
+ * Maximum number of objects visited by one incremental sweep step.
+ * When a GC is triggered by an allocation, marking is done in one
+ * pass and the release of unreachable objects is spread over the
+ * following allocations, `gc.collect()` always runs a full cycle.
+ * 0: sweep all objects at once (stop-the-world GC).
+ * Default: 128
+ **/
+#define BE_GC_SWEEP_BUDGET              128
+
+/* Macro: BE_USE_GC_PAUSE_STATS
+ * Record the duration of each GC pause (marking and each sweep step)
+ * in a log2 histogram in microseconds, reported by `gc.pauses()`.
+ * The clock can be replaced with BE_EXPLICIT_CLOCK_US.
+ * 0: pauses are not timed and `gc.pauses()` returns nil.
+ * Default: 1
+ **/
+#define BE_USE_GC_PAUSE_STATS           1
+
 /* Macro: BE_USE_DEBUG_STACK
  * Enable Stack Resize debug mode. At each function call
  * the stack is reallocated at a different memory location
@@ -245,6 +287,17 @@ extern "C" {
 
 #define BE_EXPLICIT_ABORT               abort
 #define BE_EXPLICIT_EXIT                exit
+
+#ifdef COMPILE_BERRY_LIB
+#ifdef __cplusplus
+extern "C" {
+#endif
+  extern uint32_t berry_clock_us(void);
+#ifdef __cplusplus
+}
+#endif
+  #define BE_EXPLICIT_CLOCK_US            berry_clock_us
+#endif // COMPILE_BERRY_LIB
 // #define BE_EXPLICIT_MALLOC              malloc
 // #define BE_EXPLICIT_FREE                free
 // #define BE_EXPLICIT_REALLOC             realloc
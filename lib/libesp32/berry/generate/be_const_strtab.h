@@ -113,6 +113,7 @@ extern const bcstring be_const_str__X20_X28;
 extern const bcstring be_const_str__X21_X3D;
 extern const bcstring be_const_str__X21_X3D_X3D;
 extern const bcstring be_const_str__X22;
+extern const bcstring be_const_str__X22TELE_X22;
 extern const bcstring be_const_str__X22_X3A;
 extern const bcstring be_const_str__X23;
 extern const bcstring be_const_str__X23autoexec_X2Ebat;
@@ -225,11 +226,13 @@ extern const bcstring be_const_str__read;
 extern const bcstring be_const_str__request_from;
 extern const bcstring be_const_str__rmt;
 extern const bcstring be_const_str__rules;
+extern const bcstring be_const_str__rules_keys;
 extern const bcstring be_const_str__settings_def;
 extern const bcstring be_const_str__settings_ptr;
 extern const bcstring be_const_str__subscribe;
 extern const bcstring be_const_str__t;
 extern const bcstring be_const_str__timers;
+extern const bcstring be_const_str__timers_id;
 extern const bcstring be_const_str__unsubscribe;
 extern const bcstring be_const_str__validate;
 extern const bcstring be_const_str__write;
@@ -319,6 +322,7 @@ extern const bcstring be_const_str_code;
 extern const bcstring be_const_str_codedump;
 extern const bcstring be_const_str_collect;
 extern const bcstring be_const_str_compile;
+extern const bcstring be_const_str_compile_rule;
 extern const bcstring be_const_str_compress;
 extern const bcstring be_const_str_concat;
 extern const bcstring be_const_str_connect;
@@ -486,6 +490,10 @@ extern const bcstring be_const_str_has;
 extern const bcstring be_const_str_has_arg;
 extern const bcstring be_const_str_has_factory;
 extern const bcstring be_const_str_hasclient;
+extern const bcstring be_const_str_heap_push;
+extern const bcstring be_const_str_heap_remove;
+extern const bcstring be_const_str_heap_remove_id;
+extern const bcstring be_const_str_heap_sift;
 extern const bcstring be_const_str_height_def;
 extern const bcstring be_const_str_hex;
 extern const bcstring be_const_str_hour;
@@ -498,6 +506,7 @@ extern const bcstring be_const_str_hue_status;
 extern const bcstring be_const_str_i2c_enabled;
 extern const bcstring be_const_str_id;
 extern const bcstring be_const_str_id_X20must_X20be_X20of_X20type_X20_X27int_X27;
+extern const bcstring be_const_str_idx;
 extern const bcstring be_const_str_if;
 extern const bcstring be_const_str_imax;
 extern const bcstring be_const_str_imin;
@@ -621,6 +630,7 @@ extern const bcstring be_const_str_page_autoconf_mgr;
 extern const bcstring be_const_str_parse;
 extern const bcstring be_const_str_partition_core;
 extern const bcstring be_const_str_path;
+extern const bcstring be_const_str_pauses;
 extern const bcstring be_const_str_pc;
 extern const bcstring be_const_str_pc_abs;
 extern const bcstring be_const_str_pc_rel;
@@ -695,10 +705,13 @@ extern const bcstring be_const_str_reverse_gamma10;
 extern const bcstring be_const_str_rotate;
 extern const bcstring be_const_str_rtc;
 extern const bcstring be_const_str_rule;
+extern const bcstring be_const_str_rule_key;
+extern const bcstring be_const_str_rule_keys_in;
 extern const bcstring be_const_str_run;
 extern const bcstring be_const_str_run_bat;
 extern const bcstring be_const_str_run_cron;
 extern const bcstring be_const_str_run_deferred;
+extern const bcstring be_const_str_run_rules;
 extern const bcstring be_const_str_running;
 extern const bcstring be_const_str_sat;
 extern const bcstring be_const_str_save;
@@ -766,6 +779,7 @@ extern const bcstring be_const_str_srand;
 extern const bcstring be_const_str_start;
 extern const bcstring be_const_str_state;
 extern const bcstring be_const_str_static;
+extern const bcstring be_const_str_step;
 extern const bcstring be_const_str_stop;
 extern const bcstring be_const_str_stop_iteration;
 extern const bcstring be_const_str_str;
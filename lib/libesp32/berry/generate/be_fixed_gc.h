@@ -3,11 +3,13 @@
 static be_define_const_map_slots(m_libgc_map) {
     { be_const_key(allocated, -1), be_const_func(m_allocated) },
     { be_const_key(collect, -1), be_const_func(m_collect) },
+    { be_const_key(pauses, 0), be_const_func(m_pauses) },
+    { be_const_key(step, -1), be_const_func(m_step) },
 };
 
 static be_define_const_map(
     m_libgc_map,
-    2
+    4
 );
 
 static be_define_const_module(
@@ -442,6 +442,7 @@ BERRY_API bbool be_setsuper(bvm *vm, int index)
         if (!gc_isconst(c)) {
             bclass *super = var_toobj(top);
             be_class_setsuper(c, super);
+            be_vm_mbrcache_flush(vm);
             return btrue;
         }
     }
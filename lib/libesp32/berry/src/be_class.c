@@ -18,7 +18,8 @@
 #define check_members(vm, c)            \
     if (!(c)->members) {                \
         (c)->members = be_map_new(vm);  \
-    }
+    }                                   \
+    be_vm_mbrcache_flush(vm); /* class is changing, invalidate inline caches */
 
 bclass* be_newclass(bvm *vm, bstring *name, bclass *super)
 {
@@ -367,6 +368,7 @@ bbool be_class_setmember(bvm *vm, bclass *o, bstring *name, bvalue *src)
         bclass * obj = class_member(vm, o, name, &v);
         if (obj && !var_istype(&v, MT_VARIABLE)) {
             be_map_insertstr(vm, obj->members, name, src);
+            be_vm_mbrcache_flush(vm);
             return btrue;
         }
     }
@@ -18,6 +18,9 @@
 #include "be_module.h"
 #include "be_exec.h"
 #include "be_debug.h"
+#if BE_USE_GC_PAUSE_STATS && !defined(BE_EXPLICIT_CLOCK_US)
+#include <time.h>
+#endif
 
 #define GC_PAUSE    (1 << 0) /* GC will not be executed automatically */
 #define GC_HALT     (1 << 1) /* GC completely stopped */
@@ -35,10 +38,13 @@
 
 static void destruct_object(bvm *vm, bgcobject *obj);
 static void free_object(bvm *vm, bgcobject *obj);
+static bbool sweep_white(bvm *vm, size_t budget);
+static void gc_sweep_done(bvm *vm);
 
 void be_gc_init(bvm *vm)
 {
     vm->gc.usage = sizeof(bvm);
+    vm->gc.budget = BE_GC_SWEEP_BUDGET;
     be_gc_setsteprate(vm, 200);
     be_gc_init_memory_pools(vm);
 }
@@ -47,6 +53,11 @@ void be_gc_deleteall(bvm *vm)
 {
     bupval *uv, *uvnext;
     bgcobject *node, *next;
+    /* finish the pending sweep so that no destructor is called twice */
+    if (vm->gc.sweep != NULL) {
+        sweep_white(vm, 0);
+        gc_sweep_done(vm);
+    }
     /* halt GC and delete all objects */
     vm->gc.status |= GC_HALT;
     /* first: call destructor */
@@ -486,27 +497,33 @@ static void destruct_white(bvm *vm)
     vm->gc.status &= ~GC_HALT; /* reset GC halt flag */
 }
 
-static void delete_white(bvm *vm)
+/* Release unreachable objects of the `sweeping` list and set the others white */
+/* At most `budget` objects are visited (0 means no limit), returns true when done */
+static bbool sweep_white(bvm *vm, size_t budget)
 {
-    bgcobject *node, *prev, *next;
-    for (node = vm->gc.list, prev = node; node; node = next) {
-        next = node->next;
+    bgcobject **link = vm->gc.sweep, *node;
+    bbool freed = bfalse;
+    while ((node = *link) != NULL) {
         if (gc_iswhite(node)) {
-            if (node == vm->gc.list) { /* first node */
-                vm->gc.list = node->next;
-                prev = node->next;
-            } else { /* not first node */
-                prev->next = next;
-            }
+            *link = node->next;
             free_object(vm, node);
+            freed = btrue;
 #if BE_USE_PERF_COUNTERS
             vm->counter_gc_freed++;
 #endif
         } else {
             gc_setwhite(node);
-            prev = node;
+            link = &node->next;
         }
+        if (budget && --budget == 0) {
+            break;
+        }
+    }
+    vm->gc.sweep = link;
+    if (freed) {
+        be_vm_mbrcache_flush(vm); /* cached classes or strings may have been freed */
     }
+    return *link == NULL;
 }
 
 static void reset_fixedlist(bvm *vm)
@@ -519,32 +536,42 @@ static void reset_fixedlist(bvm *vm)
     }
 }
 
-void be_gc_auto(bvm *vm)
+size_t be_gc_memcount(bvm *vm)
 {
-#if BE_USE_DEBUG_GC
-    if (vm->gc.status & GC_PAUSE) { /* force gc each time it's possible */
-        be_gc_collect(vm);
-    }
+    return vm->gc.usage;
+}
+
+#if BE_USE_GC_PAUSE_STATS
+#ifdef BE_EXPLICIT_CLOCK_US
+  #define gc_clock_us()     ((uint32_t)BE_EXPLICIT_CLOCK_US())
 #else
-    if (vm->gc.status & GC_PAUSE && vm->gc.usage > vm->gc.threshold) {
-        be_gc_collect(vm);
-    }
+  #define gc_clock_us()     ((uint32_t)((uint64_t)clock() * 1000000 / CLOCKS_PER_SEC))
 #endif
-}
 
-size_t be_gc_memcount(bvm *vm)
+#define gc_pause_begin()    uint32_t _pause_start = gc_clock_us()
+#define gc_pause_end(vm)    gc_record_pause((vm), gc_clock_us() - _pause_start)
+
+static void gc_record_pause(bvm *vm, uint32_t us)
 {
-    return vm->gc.usage;
+    int bucket = 0;
+    while (us >> (bucket + 1) && bucket < BE_GC_PAUSE_BUCKETS - 1) {
+        ++bucket;
+    }
+    vm->gc.pauses[bucket]++;
+    if (us > vm->gc.pause_max) {
+        vm->gc.pause_max = us;
+    }
 }
+#else
+#define gc_pause_begin()
+#define gc_pause_end(vm)
+#endif
 
-void be_gc_collect(bvm *vm)
+/* Mark all reachable objects and start sweeping the others */
+static void gc_mark(bvm *vm)
 {
-    if (vm->gc.status & GC_HALT) {
-        return; /* the GC cannot run for some reason */
-    }
 #if BE_USE_PERF_COUNTERS
-    size_t slors_used_before_gc, slots_allocated_before_gc;
-    be_gc_memory_pools_info(vm, &slors_used_before_gc, &slots_allocated_before_gc);
+    be_gc_memory_pools_info(vm, &vm->gc.slots_used_before, &vm->gc.slots_allocated_before);
     vm->counter_gc_kept = 0;
     vm->counter_gc_freed = 0;
 #endif
@@ -557,10 +584,28 @@ void be_gc_collect(bvm *vm)
     premark_fixed(vm); /* fixed objects */
     /* step 2: set unscanned objects to black */
     mark_unscanned(vm);
-    /* step 3: destruct and delete unreachable objects */
+    /* step 3: call destructors and start sweeping unreachable objects */
     destruct_white(vm);
-    delete_white(vm);
     be_gcstrtab(vm);
+    be_vm_mbrcache_flush(vm); /* cached strings may have been freed */
+    /* objects allocated from now on are kept out of the sweep */
+    vm->gc.sweeping = vm->gc.list;
+    vm->gc.sweep = &vm->gc.sweeping;
+    vm->gc.list = NULL;
+}
+
+/* Finish the GC cycle once all objects are swept */
+static void gc_sweep_done(bvm *vm)
+{
+    /* put back the objects allocated during the sweep in front of the survivors, */
+    /* the list must stay sorted from newest to oldest so that instances are freed before their class */
+    bgcobject **tail = &vm->gc.list;
+    while (*tail) {
+        tail = &(*tail)->next;
+    }
+    *tail = vm->gc.sweeping;
+    vm->gc.sweeping = NULL;
+    vm->gc.sweep = NULL;
     /* step 4: reset the fixed objects */
     reset_fixedlist(vm);
     /* step 5: calculate the next GC threshold */
@@ -570,9 +615,64 @@ void be_gc_collect(bvm *vm)
     size_t slors_used_after_gc, slots_allocated_after_gc;
     be_gc_memory_pools_info(vm, &slors_used_after_gc, &slots_allocated_after_gc);
     if (vm->obshook != NULL) (*vm->obshook)(vm, BE_OBS_GC_END, vm->gc.usage, vm->counter_gc_kept, vm->counter_gc_freed,
-                                            slors_used_before_gc, slots_allocated_before_gc,
+                                            vm->gc.slots_used_before, vm->gc.slots_allocated_before,
                                             slors_used_after_gc, slots_allocated_after_gc);
 #else
     if (vm->obshook != NULL) (*vm->obshook)(vm, BE_OBS_GC_END, vm->gc.usage);
 #endif
 }
+
+/* Run one incremental sweep step, returns true if a sweep is still pending */
+bbool be_gc_step(bvm *vm)
+{
+    if (vm->gc.sweep == NULL || vm->gc.status & GC_HALT) {
+        return vm->gc.sweep != NULL;
+    }
+    gc_pause_begin();
+    if (sweep_white(vm, vm->gc.budget)) {
+        gc_sweep_done(vm);
+    }
+    gc_pause_end(vm);
+    return vm->gc.sweep != NULL;
+}
+
+void be_gc_auto(bvm *vm)
+{
+    if (vm->gc.sweep != NULL) { /* an incremental sweep is pending */
+        be_gc_step(vm);
+        return;
+    }
+#if BE_USE_DEBUG_GC
+    if (vm->gc.status & GC_PAUSE) { /* force gc each time it's possible */
+        be_gc_collect(vm);
+    }
+#else
+    if (vm->gc.status & GC_PAUSE && vm->gc.usage > vm->gc.threshold) {
+        if (vm->gc.status & GC_HALT) {
+            return; /* the GC cannot run for some reason */
+        }
+        gc_pause_begin();
+        gc_mark(vm);
+        if (sweep_white(vm, vm->gc.budget)) {
+            gc_sweep_done(vm);
+        }
+        gc_pause_end(vm);
+    }
+#endif
+}
+
+void be_gc_collect(bvm *vm)
+{
+    if (vm->gc.status & GC_HALT) {
+        return; /* the GC cannot run for some reason */
+    }
+    gc_pause_begin();
+    if (vm->gc.sweep != NULL) { /* finish the pending cycle first */
+        sweep_white(vm, 0);
+        gc_sweep_done(vm);
+    }
+    gc_mark(vm);
+    sweep_white(vm, 0);
+    gc_sweep_done(vm);
+    gc_pause_end(vm);
+}
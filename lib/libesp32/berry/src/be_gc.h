@@ -75,5 +75,6 @@ void be_gc_unfix(bvm *vm, bgcobject *obj);
 bbool be_gc_fix_set(bvm *vm, bgcobject *obj, bbool fix);
 void be_gc_collect(bvm *vm);
 void be_gc_auto(bvm *vm);
+bbool be_gc_step(bvm *vm);
 
 #endif
@@ -7,6 +7,8 @@
 ********************************************************************/
 #include "be_object.h"
 #include "be_gc.h"
+#include "be_vm.h"
+#include <string.h>
 
 #if BE_USE_GC_MODULE
 
@@ -27,10 +29,58 @@ static int m_collect(bvm *vm)
     be_return_nil(vm);
 }
 
+/* run one incremental sweep step, returns `true` if the sweep is not finished */
+/* an optional argument sets the number of objects visited per step, 0 for no limit */
+static int m_step(bvm *vm)
+{
+    if (be_top(vm) >= 1 && be_isint(vm, 1)) {
+        bint budget = be_toint(vm, 1);
+        vm->gc.budget = budget > 0 ? (size_t)budget : 0;
+    }
+    be_pushbool(vm, be_gc_step(vm));
+    be_return(vm);
+}
+
+/* return the GC pauses as a map `{'max': us, 'histogram': [...]}` */
+/* bucket `i` of the histogram counts pauses of 2^i to 2^(i+1)-1 microseconds */
+/* pass `true` to reset the statistics after reading them */
+static int m_pauses(bvm *vm)
+{
+#if BE_USE_GC_PAUSE_STATS
+    int i;
+    bbool reset = be_top(vm) >= 1 && be_tobool(vm, 1);
+    be_newobject(vm, "map");
+    be_pushstring(vm, "max");
+    be_pushint(vm, (bint)vm->gc.pause_max);
+    be_data_insert(vm, -3);
+    be_pop(vm, 2);
+    be_pushstring(vm, "histogram");
+    be_newobject(vm, "list");
+    for (i = 0; i < BE_GC_PAUSE_BUCKETS; i++) {
+        be_pushint(vm, (bint)vm->gc.pauses[i]);
+        be_data_push(vm, -2);
+        be_pop(vm, 1);
+    }
+    be_pop(vm, 1);
+    be_data_insert(vm, -3);
+    be_pop(vm, 2);
+    be_pop(vm, 1);
+    if (reset) {
+        memset(vm->gc.pauses, 0, sizeof(vm->gc.pauses));
+        vm->gc.pause_max = 0;
+    }
+    be_return(vm);
+#else
+    be_return_nil(vm);
+#endif
+}
+
 #if !BE_USE_PRECOMPILED_OBJECT
 be_native_module_attr_table(gc){
     be_native_module_function("allocated", m_allocated),
-    be_native_module_function("collect", m_collect)
+    be_native_module_function("collect", m_collect),
+    be_native_module_function("step", m_step),
+    be_native_module_function("pauses", m_pauses)
 };
 
 be_define_native_module(gc, NULL);
@@ -39,6 +89,8 @@ be_define_native_module(gc, NULL);
 module gc (scope: global, depend: BE_USE_GC_MODULE) {
     allocated, func(m_allocated)
     collect, func(m_collect)
+    step, func(m_step)
+    pauses, func(m_pauses)
 }
 @const_object_info_end */
 #include "../generate/be_fixed_gc.h"
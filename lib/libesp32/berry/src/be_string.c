@@ -189,6 +189,8 @@ static bstring* newshortstr(bvm *vm, const char *str, size_t len)
     }
     s = createstrobj(vm, len, 0);
     if (s) {
+        /* the allocation may have run the GC which can resize the string table */
+        list = vm->strtab.table + (hash & (vm->strtab.size - 1));
         memcpy(cast(char *, sstr(s)), str, len);
         s->extra = 0;
         s->next = cast(void*, *list);
@@ -197,8 +199,8 @@ static bstring* newshortstr(bvm *vm, const char *str, size_t len)
 #endif
         *list = s;
         vm->strtab.count++;
-        if (vm->strtab.count > size << 2) {
-            resize(vm, size << 1);
+        if (vm->strtab.count > vm->strtab.size << 2) {
+            resize(vm, vm->strtab.size << 1);
         }
     }
     return s;
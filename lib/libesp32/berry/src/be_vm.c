@@ -65,22 +65,43 @@
   #define VM_HEARTBEAT()
 #endif
 
-#define vm_exec_loop() \
+#if BE_USE_COMPUTED_GOTO
+  #if !defined(__GNUC__)
+    #error "BE_USE_COMPUTED_GOTO requires GCC or Clang (labels as values)"
+  #endif
+  /* direct-threaded dispatch: each handler fetches the next instruction
+   * and jumps to its label through `opcode_table` (see vm_exec) */
+  #define vm_fetch_dispatch() \
+    do { \
+        DEBUG_HOOK(); \
+        COUNTER_HOOK(); \
+        VM_HEARTBEAT(); \
+        goto *opcode_table[IGET_OP(ins = *vm->ip++)]; \
+    } while (0)
+
+  #define vm_exec_loop() \
+    vm_fetch_dispatch();
+
+  #define opcase(opcode)      opcase_##opcode
+  #define dispatch()          vm_fetch_dispatch()
+#else
+  #define vm_exec_loop() \
     loop: \
         DEBUG_HOOK(); \
         COUNTER_HOOK(); \
         VM_HEARTBEAT(); \
         switch (IGET_OP(ins = *vm->ip++))
 
+  #define opcase(opcode)      case OP_##opcode
+  #define dispatch()          goto loop
+#endif
+
 #if BE_USE_SINGLE_FLOAT
   #define mathfunc(func)    func##f
 #else
   #define mathfunc(func)    func
 #endif
 
-#define opcase(opcode)      case OP_##opcode
-#define dispatch()          goto loop
-
 #define equal_rule(op, iseq) \
     bbool res; \
     be_assert(!var_isstatic(a)); \
@@ -311,10 +332,99 @@ static void obj_method(bvm *vm, bvalue *o, bstring *attr, bvalue *dst)
     }
 }
 
+#if BE_MEMBER_CACHE_SIZE
+#define mbrcache_slot(vm, ip) \
+    (&(vm)->mbrcache[((size_t)(ip) / sizeof(binstruction)) & (BE_MEMBER_CACHE_SIZE - 1)])
+
+/* Invalidate all inline cache entries, called when a class changes or after a GC */
+void be_vm_mbrcache_flush(bvm *vm)
+{
+    memset(vm->mbrcache, 0, sizeof(vm->mbrcache));
+}
+
+/* Get the cache entry for the current instruction, fill it on miss */
+/* The entry only covers members found in the class hierarchy, not virtual members */
+static bmbrcache* mbrcache_lookup(bvm *vm, binstance *obj, bstring *name)
+{
+    bmbrcache *e = mbrcache_slot(vm, vm->ip);
+    if (e->ip != vm->ip || e->cls != obj->_class || e->name != name) {
+        uint16_t depth = 0;
+        e->ip = vm->ip;
+        e->cls = obj->_class;
+        e->name = name;
+        e->depth = BE_MBRCACHE_VIRTUAL;
+        var_setnil(&e->value);
+        for (; obj; obj = obj->super, ++depth) {
+            bmap *members = obj->_class->members;
+            if (members) {
+                bvalue *v = be_map_findstr(vm, members, name);
+                if (v) {
+                    e->value = *v;
+                    e->depth = depth;
+                    break;
+                }
+            }
+        }
+    }
+    return e;
+}
+
+/* Get the instance owning the cached member */
+static binstance* mbrcache_owner(bmbrcache *e, binstance *obj)
+{
+    uint16_t depth = e->depth;
+    while (depth--) {
+        obj = obj->super;
+    }
+    return obj;
+}
+
+/* Same as `be_instance_member()` using the inline cache, returns BE_NONE if not found */
+static int mbrcache_member(bvm *vm, binstance *obj, bstring *name, bvalue *dst)
+{
+    bmbrcache *e = mbrcache_lookup(vm, obj, name);
+    if (e->depth == BE_MBRCACHE_VIRTUAL) {
+        return BE_NONE;
+    }
+    if (var_type(&e->value) == MT_VARIABLE) {
+        *dst = mbrcache_owner(e, obj)->members[e->value.v.i];
+    } else {
+        *dst = e->value;
+    }
+    int type = var_type(dst);
+    var_clearstatic(dst);
+    return type;
+}
+
+/* Same as the instance variable path of `be_instance_setmember()` using the inline cache */
+static bbool mbrcache_setmember(bvm *vm, binstance *obj, bstring *name, bvalue *src)
+{
+    bmbrcache *e = mbrcache_lookup(vm, obj, name);
+    if (e->depth != BE_MBRCACHE_VIRTUAL && var_type(&e->value) == MT_VARIABLE) {
+        mbrcache_owner(e, obj)->members[e->value.v.i] = *src;
+        return btrue;
+    }
+    return bfalse;
+}
+#else
+void be_vm_mbrcache_flush(bvm *vm)
+{
+    (void)vm;
+}
+#endif
+
 static int obj_attribute(bvm *vm, bvalue *o, bstring *attr, bvalue *dst)
 {
     binstance *obj = var_toobj(o);
+#if BE_MEMBER_CACHE_SIZE
+    int type = mbrcache_member(vm, obj, attr, dst);
+    if (type != BE_NONE) {
+        return type;
+    }
+    type = be_instance_member(vm, obj, attr, dst);
+#else
     int type = be_instance_member(vm, obj, attr, dst);
+#endif
     if (type == BE_NONE) {
         vm_error(vm, "attribute_error",
             "the '%s' object has no attribute '%s'",
@@ -513,11 +623,23 @@ BERRY_API void be_vm_delete(bvm *vm)
     be_os_free(vm);
 }
 
+#if BE_USE_COMPUTED_GOTO
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"   /* 'goto *' and '&&label' are GNU extensions */
+#endif
 static void vm_exec(bvm *vm)
 {
     bclosure *clos;
     bvalue *ktab, *reg;
     binstruction ins;
+#if BE_USE_COMPUTED_GOTO
+    /* jump table indexed by opcode, same order as `bopcode` */
+    static const void * const opcode_table[] = {
+        #define OPCODE(opc) &&opcase_##opc
+        #include "be_opcodes.h"
+        #undef OPCODE
+    };
+#endif
     vm->cf->status |= BASE_FRAME;
 newframe: /* a new call frame */
     be_assert(var_isclosure(vm->cf->func));
@@ -926,6 +1048,11 @@ newframe: /* a new call frame */
                 if (var_isfunction(&result)) {
                     var_markstatic(&result);
                 }
+#if BE_MEMBER_CACHE_SIZE
+                if (mbrcache_setmember(vm, obj, attr, &result)) {
+                    dispatch();
+                }
+#endif
                 if (!be_instance_setmember(vm, obj, attr, &result)) {
                     reg = vm->reg;
                     vm_error(vm, "attribute_error",
@@ -1016,6 +1143,7 @@ newframe: /* a new call frame */
                 bclass *obj = var_toobj(a);
                 if (!gc_isconst(obj))  {
                    be_class_setsuper(obj, var_toobj(b));
+                   be_vm_mbrcache_flush(vm);
                 } else {
                     vm_error(vm, "internal_error",
                     "cannot change superclass of a read-only class");
@@ -1209,6 +1337,9 @@ newframe: /* a new call frame */
         }
     }
 }
+#if BE_USE_COMPUTED_GOTO
+#pragma GCC diagnostic pop
+#endif
 
 static void prep_closure(bvm *vm, int pos, int argc, int mode)
 {
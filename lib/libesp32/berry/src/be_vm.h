@@ -46,6 +46,8 @@ typedef struct {
     int status;
 } bcallframe;
 
+#define BE_GC_PAUSE_BUCKETS     16  /* last bucket is 2^15 us (32 ms) or more */
+
 struct gc16_t;           /* memory pool for 0-16 bytes or less objects */
 struct gc32_t;           /* memory pool for 17-32 bytes */
 struct bgc {
@@ -58,6 +60,17 @@ struct bgc {
     size_t threshold; /* he threshold of allocation for the next GC */
     bbyte steprate; /* the rate of increase in the distribution between two GCs (percentage) */
     bbyte status;
+    bgcobject *sweeping; /* objects left to sweep, allocated objects go to `list` meanwhile */
+    bgcobject **sweep; /* next link to sweep in `sweeping`, NULL when no sweep is pending */
+    size_t budget; /* max objects visited per sweep step, 0 for no limit */
+#if BE_USE_PERF_COUNTERS
+    size_t slots_used_before; /* memory pool slots used when the GC cycle started */
+    size_t slots_allocated_before; /* memory pool slots allocated when the GC cycle started */
+#endif
+#if BE_USE_GC_PAUSE_STATS
+    uint32_t pauses[BE_GC_PAUSE_BUCKETS]; /* log2 histogram of GC pauses in microseconds */
+    uint32_t pause_max; /* longest GC pause in microseconds */
+#endif
 };
 
 struct bstringtable {
@@ -76,6 +89,18 @@ typedef struct {
     binstruction *ip;
 } bcallsnapshot;
 
+#if BE_MEMBER_CACHE_SIZE
+typedef struct {
+    binstruction *ip; /* instruction owning this entry, NULL if empty */
+    bclass *cls; /* class of the instance that filled the entry */
+    bstring *name; /* member name */
+    bvalue value; /* raw member value from the class, index for instance variables */
+    uint16_t depth; /* superclass hops to the owner, BE_MBRCACHE_VIRTUAL if not found */
+} bmbrcache;
+
+#define BE_MBRCACHE_VIRTUAL     0xFFFF
+#endif
+
 struct bupval {
     bvalue* value;
     union {
@@ -121,6 +146,9 @@ struct bvm {
     bvalue hook;
     bbyte hookmask;
 #endif
+#if BE_MEMBER_CACHE_SIZE
+    bmbrcache mbrcache[BE_MEMBER_CACHE_SIZE]; /* inline cache for GETMBR/GETMET/SETMBR */
+#endif
 };
 
 #define NONE_FLAG           0
@@ -136,5 +164,6 @@ bbool be_vm_islt(bvm *vm, bvalue *a, bvalue *b);
 bbool be_vm_isle(bvm *vm, bvalue *a, bvalue *b);
 bbool be_vm_isgt(bvm *vm, bvalue *a, bvalue *b);
 bbool be_vm_isge(bvm *vm, bvalue *a, bvalue *b);
+void be_vm_mbrcache_flush(bvm *vm);
 
 #endif
@@ -208,6 +208,265 @@ be_local_closure(Tasmota_find_op,   /* name */
 /*******************************************************************/
 
 
+/********************************************************************
+** Solidified function: compile_rule
+********************************************************************/
+be_local_closure(Tasmota_compile_rule,   /* name */
+  be_nested_proto(
+    9,                          /* nstack */
+    2,                          /* argc */
+    2,                          /* varg */
+    0,                          /* has upvals */
+    NULL,                       /* no upvals */
+    0,                          /* has sup protos */
+    NULL,                       /* no sub protos */
+    1,                          /* has constants */
+    ( &(const bvalue[ 8]) {     /* constants */
+    /* K0   */  be_nested_str(string),
+    /* K1   */  be_nested_str(find_op),
+    /* K2   */  be_nested_str(split),
+    /* K3   */  be_nested_str(toupper),
+    /* K4   */  be_const_int(0),
+    /* K5   */  be_nested_str(_X23),
+    /* K6   */  be_const_int(2),
+    /* K7   */  be_const_int(1),
+    }),
+    &be_const_str_compile_rule,
+    &be_const_str_solidified,
+    ( &(const binstruction[29]) {  /* code */
+      0xA40A0000,  //  0000  IMPORT	R2	K0
+      0x8C0C0101,  //  0001  GETMET	R3	R0	K1
+      0x5C140200,  //  0002  MOVE	R5	R1
+      0x7C0C0400,  //  0003  CALL	R3	2
+      0x8C100502,  //  0004  GETMET	R4	R2	K2
+      0x8C180503,  //  0005  GETMET	R6	R2	K3
+      0x94200704,  //  0006  GETIDX	R8	R3	K4
+      0x7C180400,  //  0007  CALL	R6	2
+      0x581C0005,  //  0008  LDCONST	R7	K5
+      0x7C100600,  //  0009  CALL	R4	3
+      0x94140706,  //  000A  GETIDX	R5	R3	K6
+      0x60180012,  //  000B  GETGBL	R6	G18
+      0x7C180000,  //  000C  CALL	R6	0
+      0x941C0704,  //  000D  GETIDX	R7	R3	K4
+      0x401C0C07,  //  000E  CONNECT	R7	R6	R7
+      0x401C0C04,  //  000F  CONNECT	R7	R6	R4
+      0x941C0707,  //  0010  GETIDX	R7	R3	K7
+      0x401C0C07,  //  0011  CONNECT	R7	R6	R7
+      0x401C0C05,  //  0012  CONNECT	R7	R6	R5
+      0x4C1C0000,  //  0013  LDNIL	R7
+      0x201C0A07,  //  0014  NE	R7	R5	R7
+      0x781E0003,  //  0015  JMPF	R7	#001A
+      0x601C000A,  //  0016  GETGBL	R7	G10
+      0x5C200A00,  //  0017  MOVE	R8	R5
+      0x7C1C0200,  //  0018  CALL	R7	1
+      0x70020000,  //  0019  JMP		#001B
+      0x4C1C0000,  //  001A  LDNIL	R7
+      0x401C0C07,  //  001B  CONNECT	R7	R6	R7
+      0x80040C00,  //  001C  RET	1	R6
+    })
+  )
+);
+/*******************************************************************/
+
+
+/********************************************************************
+** Solidified function: rule_key
+********************************************************************/
+be_local_closure(Tasmota_rule_key,   /* name */
+  be_nested_proto(
+    4,                          /* nstack */
+    2,                          /* argc */
+    2,                          /* varg */
+    0,                          /* has upvals */
+    NULL,                       /* no upvals */
+    0,                          /* has sup protos */
+    NULL,                       /* no sub protos */
+    1,                          /* has constants */
+    ( &(const bvalue[ 4]) {     /* constants */
+    /* K0   */  be_const_int(1),
+    /* K1   */  be_const_int(0),
+    /* K2   */  be_nested_str(_X3F),
+    /* K3   */  be_nested_str(_X22),
+    }),
+    &be_const_str_rule_key,
+    &be_const_str_solidified,
+    ( &(const binstruction[ 9]) {  /* code */
+      0x94080300,  //  0000  GETIDX	R2	R1	K0
+      0x94080501,  //  0001  GETIDX	R2	R2	K1
+      0x1C0C0502,  //  0002  EQ	R3	R2	K2
+      0x780E0001,  //  0003  JMPF	R3	#0006
+      0x5C0C0400,  //  0004  MOVE	R3	R2
+      0x70020001,  //  0005  JMP		#0008
+      0x000E0602,  //  0006  ADD	R3	K3	R2
+      0x000C0703,  //  0007  ADD	R3	R3	K3
+      0x80040600,  //  0008  RET	1	R3
+    })
+  )
+);
+/*******************************************************************/
+
+
+/********************************************************************
+** Solidified function: rule_keys_in
+********************************************************************/
+be_local_closure(Tasmota_rule_keys_in,   /* name */
+  be_nested_proto(
+    10,                          /* nstack */
+    2,                          /* argc */
+    2,                          /* varg */
+    0,                          /* has upvals */
+    NULL,                       /* no upvals */
+    0,                          /* has sup protos */
+    NULL,                       /* no sub protos */
+    1,                          /* has constants */
+    ( &(const bvalue[ 9]) {     /* constants */
+    /* K0   */  be_nested_str(string),
+    /* K1   */  be_nested_str(_rules_keys),
+    /* K2   */  be_nested_str(contains),
+    /* K3   */  be_nested_str(_X3F),
+    /* K4   */  be_nested_str(toupper),
+    /* K5   */  be_nested_str(keys),
+    /* K6   */  be_nested_str(find),
+    /* K7   */  be_const_int(0),
+    /* K8   */  be_nested_str(stop_iteration),
+    }),
+    &be_const_str_rule_keys_in,
+    &be_const_str_solidified,
+    ( &(const binstruction[34]) {  /* code */
+      0xA40A0000,  //  0000  IMPORT	R2	K0
+      0x880C0101,  //  0001  GETMBR	R3	R0	K1
+      0x8C0C0702,  //  0002  GETMET	R3	R3	K2
+      0x58140003,  //  0003  LDCONST	R5	K3
+      0x7C0C0400,  //  0004  CALL	R3	2
+      0x780E0001,  //  0005  JMPF	R3	#0008
+      0x500C0200,  //  0006  LDBOOL	R3	1	0
+      0x80040600,  //  0007  RET	1	R3
+      0x8C0C0504,  //  0008  GETMET	R3	R2	K4
+      0x5C140200,  //  0009  MOVE	R5	R1
+      0x7C0C0400,  //  000A  CALL	R3	2
+      0x60100010,  //  000B  GETGBL	R4	G16
+      0x88140101,  //  000C  GETMBR	R5	R0	K1
+      0x8C140B05,  //  000D  GETMET	R5	R5	K5
+      0x7C140200,  //  000E  CALL	R5	1
+      0x7C100200,  //  000F  CALL	R4	1
+      0xA802000B,  //  0010  EXBLK	0	#001D
+      0x5C140800,  //  0011  MOVE	R5	R4
+      0x7C140000,  //  0012  CALL	R5	0
+      0x8C180506,  //  0013  GETMET	R6	R2	K6
+      0x5C200600,  //  0014  MOVE	R8	R3
+      0x5C240A00,  //  0015  MOVE	R9	R5
+      0x7C180600,  //  0016  CALL	R6	3
+      0x28180D07,  //  0017  GE	R6	R6	K7
+      0x781A0002,  //  0018  JMPF	R6	#001C
+      0x50180200,  //  0019  LDBOOL	R6	1	0
+      0xA8040001,  //  001A  EXBLK	1	1
+      0x80040C00,  //  001B  RET	1	R6
+      0x7001FFF3,  //  001C  JMP		#0011
+      0x58100008,  //  001D  LDCONST	R4	K8
+      0xAC100200,  //  001E  CATCH	R4	1	0
+      0xB0080000,  //  001F  RAISE	2	R0	R0
+      0x50100000,  //  0020  LDBOOL	R4	0	0
+      0x80040800,  //  0021  RET	1	R4
+    })
+  )
+);
+/*******************************************************************/
+
+
+/********************************************************************
+** Solidified function: run_rules
+********************************************************************/
+be_local_closure(Tasmota_run_rules,   /* name */
+  be_nested_proto(
+    13,                          /* nstack */
+    2,                          /* argc */
+    2,                          /* varg */
+    0,                          /* has upvals */
+    NULL,                       /* no upvals */
+    0,                          /* has sup protos */
+    NULL,                       /* no sub protos */
+    1,                          /* has constants */
+    ( &(const bvalue[14]) {     /* constants */
+    /* K0   */  be_nested_str(string),
+    /* K1   */  be_nested_str(keys),
+    /* K2   */  be_nested_str(_X22),
+    /* K3   */  be_nested_str(toupper),
+    /* K4   */  be_nested_str(stop_iteration),
+    /* K5   */  be_const_int(0),
+    /* K6   */  be_nested_str(_rules),
+    /* K7   */  be_nested_str(rule_key),
+    /* K8   */  be_nested_str(o),
+    /* K9   */  be_nested_str(_X3F),
+    /* K10  */  be_nested_str(contains),
+    /* K11  */  be_nested_str(try_rule),
+    /* K12  */  be_nested_str(f),
+    /* K13  */  be_const_int(1),
+    }),
+    &be_const_str_run_rules,
+    &be_const_str_solidified,
+    ( &(const binstruction[56]) {  /* code */
+      0xA40A0000,  //  0000  IMPORT	R2	K0
+      0x600C0013,  //  0001  GETGBL	R3	G19
+      0x7C0C0000,  //  0002  CALL	R3	0
+      0x6010000F,  //  0003  GETGBL	R4	G15
+      0x5C140200,  //  0004  MOVE	R5	R1
+      0x60180013,  //  0005  GETGBL	R6	G19
+      0x7C100400,  //  0006  CALL	R4	2
+      0x78120011,  //  0007  JMPF	R4	#001A
+      0x60100010,  //  0008  GETGBL	R4	G16
+      0x8C140301,  //  0009  GETMET	R5	R1	K1
+      0x7C140200,  //  000A  CALL	R5	1
+      0x7C100200,  //  000B  CALL	R4	1
+      0xA8020009,  //  000C  EXBLK	0	#0017
+      0x5C140800,  //  000D  MOVE	R5	R4
+      0x7C140000,  //  000E  CALL	R5	0
+      0x8C180503,  //  000F  GETMET	R6	R2	K3
+      0x5C200A00,  //  0010  MOVE	R8	R5
+      0x7C180400,  //  0011  CALL	R6	2
+      0x001A0406,  //  0012  ADD	R6	K2	R6
+      0x00180D02,  //  0013  ADD	R6	R6	K2
+      0x501C0200,  //  0014  LDBOOL	R7	1	0
+      0x980C0C07,  //  0015  SETIDX	R3	R6	R7
+      0x7001FFF5,  //  0016  JMP		#000D
+      0x58100004,  //  0017  LDCONST	R4	K4
+      0xAC100200,  //  0018  CATCH	R4	1	0
+      0xB0080000,  //  0019  RAISE	2	R0	R0
+      0x50100000,  //  001A  LDBOOL	R4	0	0
+      0x58140005,  //  001B  LDCONST	R5	K5
+      0x6018000C,  //  001C  GETGBL	R6	G12
+      0x881C0106,  //  001D  GETMBR	R7	R0	K6
+      0x7C180200,  //  001E  CALL	R6	1
+      0x14180A06,  //  001F  LT	R6	R5	R6
+      0x781A0015,  //  0020  JMPF	R6	#0037
+      0x88180106,  //  0021  GETMBR	R6	R0	K6
+      0x94180C05,  //  0022  GETIDX	R6	R6	R5
+      0x8C1C0107,  //  0023  GETMET	R7	R0	K7
+      0x88240D08,  //  0024  GETMBR	R9	R6	K8
+      0x7C1C0400,  //  0025  CALL	R7	2
+      0x1C200F09,  //  0026  EQ	R8	R7	K9
+      0x74220003,  //  0027  JMPT	R8	#002C
+      0x8C20070A,  //  0028  GETMET	R8	R3	K10
+      0x5C280E00,  //  0029  MOVE	R10	R7
+      0x7C200400,  //  002A  CALL	R8	2
+      0x78220008,  //  002B  JMPF	R8	#0035
+      0x8C20010B,  //  002C  GETMET	R8	R0	K11
+      0x5C280200,  //  002D  MOVE	R10	R1
+      0x882C0D08,  //  002E  GETMBR	R11	R6	K8
+      0x88300D0C,  //  002F  GETMBR	R12	R6	K12
+      0x7C200800,  //  0030  CALL	R8	4
+      0x74220001,  //  0031  JMPT	R8	#0034
+      0x74120000,  //  0032  JMPT	R4	#0034
+      0x50100001,  //  0033  LDBOOL	R4	0	1
+      0x50100200,  //  0034  LDBOOL	R4	1	0
+      0x00140B0D,  //  0035  ADD	R5	R5	K13
+      0x7001FFE4,  //  0036  JMP		#001C
+      0x80040800,  //  0037  RET	1	R4
+    })
+  )
+);
+/*******************************************************************/
+
+
 /********************************************************************
 ** Solidified function: try_rule
 ********************************************************************/
@@ -221,168 +480,175 @@ be_local_closure(Tasmota_try_rule,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[16]) {     /* constants */
+    ( &(const bvalue[18]) {     /* constants */
     /* K0   */  be_nested_str(string),
-    /* K1   */  be_nested_str(find_op),
-    /* K2   */  be_nested_str(split),
+    /* K1   */  be_nested_str(compile_rule),
+    /* K2   */  be_const_int(1),
     /* K3   */  be_const_int(0),
-    /* K4   */  be_nested_str(_X23),
-    /* K5   */  be_nested_str(find_key_i),
-    /* K6   */  be_const_int(1),
-    /* K7   */  be_const_int(2),
-    /* K8   */  be_nested_str(_X3D_X3D),
-    /* K9   */  be_nested_str(_X21_X3D_X3D),
-    /* K10  */  be_nested_str(_X3D),
-    /* K11  */  be_nested_str(_X21_X3D),
-    /* K12  */  be_nested_str(_X3E),
-    /* K13  */  be_nested_str(_X3E_X3D),
-    /* K14  */  be_nested_str(_X3C),
-    /* K15  */  be_nested_str(_X3C_X3D),
+    /* K4   */  be_nested_str(keys),
+    /* K5   */  be_nested_str(_X3F),
+    /* K6   */  be_nested_str(toupper),
+    /* K7   */  be_nested_str(stop_iteration),
+    /* K8   */  be_const_int(2),
+    /* K9   */  be_const_int(3),
+    /* K10  */  be_nested_str(_X3D_X3D),
+    /* K11  */  be_nested_str(_X21_X3D_X3D),
+    /* K12  */  be_nested_str(_X3D),
+    /* K13  */  be_nested_str(_X21_X3D),
+    /* K14  */  be_nested_str(_X3E),
+    /* K15  */  be_nested_str(_X3E_X3D),
+    /* K16  */  be_nested_str(_X3C),
+    /* K17  */  be_nested_str(_X3C_X3D),
     }),
     &be_const_str_try_rule,
     &be_const_str_solidified,
-    ( &(const binstruction[141]) {  /* code */
+    ( &(const binstruction[146]) {  /* code */
       0xA4120000,  //  0000  IMPORT	R4	K0
-      0x8C140101,  //  0001  GETMET	R5	R0	K1
-      0x5C1C0400,  //  0002  MOVE	R7	R2
-      0x7C140400,  //  0003  CALL	R5	2
-      0x5C180200,  //  0004  MOVE	R6	R1
-      0x8C1C0902,  //  0005  GETMET	R7	R4	K2
-      0x94240B03,  //  0006  GETIDX	R9	R5	K3
-      0x58280004,  //  0007  LDCONST	R10	K4
-      0x7C1C0600,  //  0008  CALL	R7	3
-      0x58200003,  //  0009  LDCONST	R8	K3
-      0x6024000C,  //  000A  GETGBL	R9	G12
-      0x5C280E00,  //  000B  MOVE	R10	R7
-      0x7C240200,  //  000C  CALL	R9	1
-      0x14241009,  //  000D  LT	R9	R8	R9
-      0x7826000C,  //  000E  JMPF	R9	#001C
-      0x94240E08,  //  000F  GETIDX	R9	R7	R8
-      0x8C280105,  //  0010  GETMET	R10	R0	K5
-      0x5C300C00,  //  0011  MOVE	R12	R6
-      0x5C341200,  //  0012  MOVE	R13	R9
-      0x7C280600,  //  0013  CALL	R10	3
-      0x4C2C0000,  //  0014  LDNIL	R11
-      0x1C2C140B,  //  0015  EQ	R11	R10	R11
-      0x782E0001,  //  0016  JMPF	R11	#0019
-      0x502C0000,  //  0017  LDBOOL	R11	0	0
-      0x80041600,  //  0018  RET	1	R11
-      0x94180C0A,  //  0019  GETIDX	R6	R6	R10
-      0x00201106,  //  001A  ADD	R8	R8	K6
-      0x7001FFED,  //  001B  JMP		#000A
-      0x94240B06,  //  001C  GETIDX	R9	R5	K6
-      0x94280B07,  //  001D  GETIDX	R10	R5	K7
-      0x78260066,  //  001E  JMPF	R9	#0086
-      0x1C2C1308,  //  001F  EQ	R11	R9	K8
-      0x782E000A,  //  0020  JMPF	R11	#002C
-      0x602C0008,  //  0021  GETGBL	R11	G8
-      0x5C300C00,  //  0022  MOVE	R12	R6
-      0x7C2C0200,  //  0023  CALL	R11	1
-      0x60300008,  //  0024  GETGBL	R12	G8
-      0x5C341400,  //  0025  MOVE	R13	R10
-      0x7C300200,  //  0026  CALL	R12	1
-      0x202C160C,  //  0027  NE	R11	R11	R12
-      0x782E0001,  //  0028  JMPF	R11	#002B
-      0x502C0000,  //  0029  LDBOOL	R11	0	0
-      0x80041600,  //  002A  RET	1	R11
-      0x70020059,  //  002B  JMP		#0086
-      0x1C2C1309,  //  002C  EQ	R11	R9	K9
-      0x782E000A,  //  002D  JMPF	R11	#0039
-      0x602C0008,  //  002E  GETGBL	R11	G8
-      0x5C300C00,  //  002F  MOVE	R12	R6
-      0x7C2C0200,  //  0030  CALL	R11	1
-      0x60300008,  //  0031  GETGBL	R12	G8
-      0x5C341400,  //  0032  MOVE	R13	R10
-      0x7C300200,  //  0033  CALL	R12	1
-      0x1C2C160C,  //  0034  EQ	R11	R11	R12
-      0x782E0001,  //  0035  JMPF	R11	#0038
-      0x502C0000,  //  0036  LDBOOL	R11	0	0
-      0x80041600,  //  0037  RET	1	R11
-      0x7002004C,  //  0038  JMP		#0086
-      0x1C2C130A,  //  0039  EQ	R11	R9	K10
-      0x782E000A,  //  003A  JMPF	R11	#0046
-      0x602C000A,  //  003B  GETGBL	R11	G10
-      0x5C300C00,  //  003C  MOVE	R12	R6
-      0x7C2C0200,  //  003D  CALL	R11	1
-      0x6030000A,  //  003E  GETGBL	R12	G10
-      0x5C341400,  //  003F  MOVE	R13	R10
-      0x7C300200,  //  0040  CALL	R12	1
-      0x202C160C,  //  0041  NE	R11	R11	R12
+      0x60140004,  //  0001  GETGBL	R5	G4
+      0x5C180400,  //  0002  MOVE	R6	R2
+      0x7C140200,  //  0003  CALL	R5	1
+      0x1C140B00,  //  0004  EQ	R5	R5	K0
+      0x78160003,  //  0005  JMPF	R5	#000A
+      0x8C140101,  //  0006  GETMET	R5	R0	K1
+      0x5C1C0400,  //  0007  MOVE	R7	R2
+      0x7C140400,  //  0008  CALL	R5	2
+      0x5C080A00,  //  0009  MOVE	R2	R5
+      0x5C140200,  //  000A  MOVE	R5	R1
+      0x94180502,  //  000B  GETIDX	R6	R2	K2
+      0x581C0003,  //  000C  LDCONST	R7	K3
+      0x6020000C,  //  000D  GETGBL	R8	G12
+      0x5C240C00,  //  000E  MOVE	R9	R6
+      0x7C200200,  //  000F  CALL	R8	1
+      0x14200E08,  //  0010  LT	R8	R7	R8
+      0x78220024,  //  0011  JMPF	R8	#0037
+      0x94200C07,  //  0012  GETIDX	R8	R6	R7
+      0x4C240000,  //  0013  LDNIL	R9
+      0x6028000F,  //  0014  GETGBL	R10	G15
+      0x5C2C0A00,  //  0015  MOVE	R11	R5
+      0x60300013,  //  0016  GETGBL	R12	G19
+      0x7C280400,  //  0017  CALL	R10	2
+      0x782A0015,  //  0018  JMPF	R10	#002F
+      0x60280010,  //  0019  GETGBL	R10	G16
+      0x8C2C0B04,  //  001A  GETMET	R11	R5	K4
+      0x7C2C0200,  //  001B  CALL	R11	1
+      0x7C280200,  //  001C  CALL	R10	1
+      0xA802000D,  //  001D  EXBLK	0	#002C
+      0x5C2C1400,  //  001E  MOVE	R11	R10
+      0x7C2C0000,  //  001F  CALL	R11	0
+      0x1C301105,  //  0020  EQ	R12	R8	K5
+      0x74320004,  //  0021  JMPT	R12	#0027
+      0x8C300906,  //  0022  GETMET	R12	R4	K6
+      0x5C381600,  //  0023  MOVE	R14	R11
+      0x7C300400,  //  0024  CALL	R12	2
+      0x1C301808,  //  0025  EQ	R12	R12	R8
+      0x78320001,  //  0026  JMPF	R12	#0029
+      0x5C241600,  //  0027  MOVE	R9	R11
+      0x70020000,  //  0028  JMP		#002A
+      0x7001FFF3,  //  0029  JMP		#001E
+      0xA8040001,  //  002A  EXBLK	1	1
+      0x70020002,  //  002B  JMP		#002F
+      0x58280007,  //  002C  LDCONST	R10	K7
+      0xAC280200,  //  002D  CATCH	R10	1	0
+      0xB0080000,  //  002E  RAISE	2	R0	R0
+      0x4C280000,  //  002F  LDNIL	R10
+      0x1C28120A,  //  0030  EQ	R10	R9	R10
+      0x782A0001,  //  0031  JMPF	R10	#0034
+      0x50280000,  //  0032  LDBOOL	R10	0	0
+      0x80041400,  //  0033  RET	1	R10
+      0x94140A09,  //  0034  GETIDX	R5	R5	R9
+      0x001C0F02,  //  0035  ADD	R7	R7	K2
+      0x7001FFD5,  //  0036  JMP		#000D
+      0x94200508,  //  0037  GETIDX	R8	R2	K8
+      0x94240509,  //  0038  GETIDX	R9	R2	K9
+      0x542A0003,  //  0039  LDINT	R10	4
+      0x9428040A,  //  003A  GETIDX	R10	R2	R10
+      0x7822004E,  //  003B  JMPF	R8	#008B
+      0x1C2C110A,  //  003C  EQ	R11	R8	K10
+      0x782E0007,  //  003D  JMPF	R11	#0046
+      0x602C0008,  //  003E  GETGBL	R11	G8
+      0x5C300A00,  //  003F  MOVE	R12	R5
+      0x7C2C0200,  //  0040  CALL	R11	1
+      0x202C1609,  //  0041  NE	R11	R11	R9
       0x782E0001,  //  0042  JMPF	R11	#0045
       0x502C0000,  //  0043  LDBOOL	R11	0	0
       0x80041600,  //  0044  RET	1	R11
-      0x7002003F,  //  0045  JMP		#0086
-      0x1C2C130B,  //  0046  EQ	R11	R9	K11
-      0x782E000A,  //  0047  JMPF	R11	#0053
-      0x602C000A,  //  0048  GETGBL	R11	G10
-      0x5C300C00,  //  0049  MOVE	R12	R6
+      0x70020044,  //  0045  JMP		#008B
+      0x1C2C110B,  //  0046  EQ	R11	R8	K11
+      0x782E0007,  //  0047  JMPF	R11	#0050
+      0x602C0008,  //  0048  GETGBL	R11	G8
+      0x5C300A00,  //  0049  MOVE	R12	R5
       0x7C2C0200,  //  004A  CALL	R11	1
-      0x6030000A,  //  004B  GETGBL	R12	G10
-      0x5C341400,  //  004C  MOVE	R13	R10
-      0x7C300200,  //  004D  CALL	R12	1
-      0x1C2C160C,  //  004E  EQ	R11	R11	R12
-      0x782E0001,  //  004F  JMPF	R11	#0052
-      0x502C0000,  //  0050  LDBOOL	R11	0	0
-      0x80041600,  //  0051  RET	1	R11
-      0x70020032,  //  0052  JMP		#0086
-      0x1C2C130C,  //  0053  EQ	R11	R9	K12
-      0x782E000A,  //  0054  JMPF	R11	#0060
-      0x602C000A,  //  0055  GETGBL	R11	G10
-      0x5C300C00,  //  0056  MOVE	R12	R6
-      0x7C2C0200,  //  0057  CALL	R11	1
-      0x6030000A,  //  0058  GETGBL	R12	G10
-      0x5C341400,  //  0059  MOVE	R13	R10
-      0x7C300200,  //  005A  CALL	R12	1
-      0x182C160C,  //  005B  LE	R11	R11	R12
-      0x782E0001,  //  005C  JMPF	R11	#005F
-      0x502C0000,  //  005D  LDBOOL	R11	0	0
-      0x80041600,  //  005E  RET	1	R11
-      0x70020025,  //  005F  JMP		#0086
-      0x1C2C130D,  //  0060  EQ	R11	R9	K13
-      0x782E000A,  //  0061  JMPF	R11	#006D
-      0x602C000A,  //  0062  GETGBL	R11	G10
-      0x5C300C00,  //  0063  MOVE	R12	R6
-      0x7C2C0200,  //  0064  CALL	R11	1
-      0x6030000A,  //  0065  GETGBL	R12	G10
-      0x5C341400,  //  0066  MOVE	R13	R10
-      0x7C300200,  //  0067  CALL	R12	1
-      0x142C160C,  //  0068  LT	R11	R11	R12
-      0x782E0001,  //  0069  JMPF	R11	#006C
-      0x502C0000,  //  006A  LDBOOL	R11	0	0
-      0x80041600,  //  006B  RET	1	R11
-      0x70020018,  //  006C  JMP		#0086
-      0x1C2C130E,  //  006D  EQ	R11	R9	K14
-      0x782E000A,  //  006E  JMPF	R11	#007A
-      0x602C000A,  //  006F  GETGBL	R11	G10
-      0x5C300C00,  //  0070  MOVE	R12	R6
-      0x7C2C0200,  //  0071  CALL	R11	1
-      0x6030000A,  //  0072  GETGBL	R12	G10
-      0x5C341400,  //  0073  MOVE	R13	R10
-      0x7C300200,  //  0074  CALL	R12	1
-      0x282C160C,  //  0075  GE	R11	R11	R12
-      0x782E0001,  //  0076  JMPF	R11	#0079
-      0x502C0000,  //  0077  LDBOOL	R11	0	0
-      0x80041600,  //  0078  RET	1	R11
-      0x7002000B,  //  0079  JMP		#0086
-      0x1C2C130F,  //  007A  EQ	R11	R9	K15
-      0x782E0009,  //  007B  JMPF	R11	#0086
-      0x602C000A,  //  007C  GETGBL	R11	G10
-      0x5C300C00,  //  007D  MOVE	R12	R6
-      0x7C2C0200,  //  007E  CALL	R11	1
-      0x6030000A,  //  007F  GETGBL	R12	G10
-      0x5C341400,  //  0080  MOVE	R13	R10
-      0x7C300200,  //  0081  CALL	R12	1
-      0x242C160C,  //  0082  GT	R11	R11	R12
-      0x782E0001,  //  0083  JMPF	R11	#0086
-      0x502C0000,  //  0084  LDBOOL	R11	0	0
-      0x80041600,  //  0085  RET	1	R11
-      0x5C2C0600,  //  0086  MOVE	R11	R3
-      0x5C300C00,  //  0087  MOVE	R12	R6
-      0x94340B03,  //  0088  GETIDX	R13	R5	K3
-      0x5C380200,  //  0089  MOVE	R14	R1
-      0x7C2C0600,  //  008A  CALL	R11	3
-      0x502C0200,  //  008B  LDBOOL	R11	1	0
-      0x80041600,  //  008C  RET	1	R11
+      0x1C2C1609,  //  004B  EQ	R11	R11	R9
+      0x782E0001,  //  004C  JMPF	R11	#004F
+      0x502C0000,  //  004D  LDBOOL	R11	0	0
+      0x80041600,  //  004E  RET	1	R11
+      0x7002003A,  //  004F  JMP		#008B
+      0x1C2C110C,  //  0050  EQ	R11	R8	K12
+      0x782E0007,  //  0051  JMPF	R11	#005A
+      0x602C000A,  //  0052  GETGBL	R11	G10
+      0x5C300A00,  //  0053  MOVE	R12	R5
+      0x7C2C0200,  //  0054  CALL	R11	1
+      0x202C160A,  //  0055  NE	R11	R11	R10
+      0x782E0001,  //  0056  JMPF	R11	#0059
+      0x502C0000,  //  0057  LDBOOL	R11	0	0
+      0x80041600,  //  0058  RET	1	R11
+      0x70020030,  //  0059  JMP		#008B
+      0x1C2C110D,  //  005A  EQ	R11	R8	K13
+      0x782E0007,  //  005B  JMPF	R11	#0064
+      0x602C000A,  //  005C  GETGBL	R11	G10
+      0x5C300A00,  //  005D  MOVE	R12	R5
+      0x7C2C0200,  //  005E  CALL	R11	1
+      0x1C2C160A,  //  005F  EQ	R11	R11	R10
+      0x782E0001,  //  0060  JMPF	R11	#0063
+      0x502C0000,  //  0061  LDBOOL	R11	0	0
+      0x80041600,  //  0062  RET	1	R11
+      0x70020026,  //  0063  JMP		#008B
+      0x1C2C110E,  //  0064  EQ	R11	R8	K14
+      0x782E0007,  //  0065  JMPF	R11	#006E
+      0x602C000A,  //  0066  GETGBL	R11	G10
+      0x5C300A00,  //  0067  MOVE	R12	R5
+      0x7C2C0200,  //  0068  CALL	R11	1
+      0x182C160A,  //  0069  LE	R11	R11	R10
+      0x782E0001,  //  006A  JMPF	R11	#006D
+      0x502C0000,  //  006B  LDBOOL	R11	0	0
+      0x80041600,  //  006C  RET	1	R11
+      0x7002001C,  //  006D  JMP		#008B
+      0x1C2C110F,  //  006E  EQ	R11	R8	K15
+      0x782E0007,  //  006F  JMPF	R11	#0078
+      0x602C000A,  //  0070  GETGBL	R11	G10
+      0x5C300A00,  //  0071  MOVE	R12	R5
+      0x7C2C0200,  //  0072  CALL	R11	1
+      0x142C160A,  //  0073  LT	R11	R11	R10
+      0x782E0001,  //  0074  JMPF	R11	#0077
+      0x502C0000,  //  0075  LDBOOL	R11	0	0
+      0x80041600,  //  0076  RET	1	R11
+      0x70020012,  //  0077  JMP		#008B
+      0x1C2C1110,  //  0078  EQ	R11	R8	K16
+      0x782E0007,  //  0079  JMPF	R11	#0082
+      0x602C000A,  //  007A  GETGBL	R11	G10
+      0x5C300A00,  //  007B  MOVE	R12	R5
+      0x7C2C0200,  //  007C  CALL	R11	1
+      0x282C160A,  //  007D  GE	R11	R11	R10
+      0x782E0001,  //  007E  JMPF	R11	#0081
+      0x502C0000,  //  007F  LDBOOL	R11	0	0
+      0x80041600,  //  0080  RET	1	R11
+      0x70020008,  //  0081  JMP		#008B
+      0x1C2C1111,  //  0082  EQ	R11	R8	K17
+      0x782E0006,  //  0083  JMPF	R11	#008B
+      0x602C000A,  //  0084  GETGBL	R11	G10
+      0x5C300A00,  //  0085  MOVE	R12	R5
+      0x7C2C0200,  //  0086  CALL	R11	1
+      0x242C160A,  //  0087  GT	R11	R11	R10
+      0x782E0001,  //  0088  JMPF	R11	#008B
+      0x502C0000,  //  0089  LDBOOL	R11	0	0
+      0x80041600,  //  008A  RET	1	R11
+      0x5C2C0600,  //  008B  MOVE	R11	R3
+      0x5C300A00,  //  008C  MOVE	R12	R5
+      0x94340503,  //  008D  GETIDX	R13	R2	K3
+      0x5C380200,  //  008E  MOVE	R14	R1
+      0x7C2C0600,  //  008F  CALL	R11	3
+      0x502C0200,  //  0090  LDBOOL	R11	1	0
+      0x80041600,  //  0091  RET	1	R11
     })
   )
 );
@@ -470,7 +736,7 @@ be_local_closure(Tasmota_set_light,   /* name */
 ********************************************************************/
 be_local_closure(Tasmota_exec_tele,   /* name */
   be_nested_proto(
-    12,                          /* nstack */
+    8,                          /* nstack */
     2,                          /* argc */
     2,                          /* varg */
     0,                          /* has upvals */
@@ -480,62 +746,55 @@ be_local_closure(Tasmota_exec_tele,   /* name */
     1,                          /* has constants */
     ( &(const bvalue[12]) {     /* constants */
     /* K0   */  be_nested_str(_rules),
-    /* K1   */  be_nested_str(json),
-    /* K2   */  be_nested_str(load),
-    /* K3   */  be_nested_str(log),
-    /* K4   */  be_nested_str(BRY_X3A_X20ERROR_X2C_X20bad_X20json_X3A_X20),
-    /* K5   */  be_const_int(3),
-    /* K6   */  be_nested_str(Tele),
-    /* K7   */  be_const_int(0),
-    /* K8   */  be_nested_str(try_rule),
-    /* K9   */  be_nested_str(trig),
-    /* K10  */  be_nested_str(f),
-    /* K11  */  be_const_int(1),
+    /* K1   */  be_nested_str(_rules_keys),
+    /* K2   */  be_nested_str(contains),
+    /* K3   */  be_nested_str(_X22TELE_X22),
+    /* K4   */  be_nested_str(_X3F),
+    /* K5   */  be_nested_str(json),
+    /* K6   */  be_nested_str(load),
+    /* K7   */  be_nested_str(log),
+    /* K8   */  be_nested_str(BRY_X3A_X20ERROR_X2C_X20bad_X20json_X3A_X20),
+    /* K9   */  be_const_int(3),
+    /* K10  */  be_nested_str(Tele),
+    /* K11  */  be_nested_str(run_rules),
     }),
     &be_const_str_exec_tele,
     &be_const_str_solidified,
-    ( &(const binstruction[41]) {  /* code */
+    ( &(const binstruction[34]) {  /* code */
       0x88080100,  //  0000  GETMBR	R2	R0	K0
-      0x780A0024,  //  0001  JMPF	R2	#0027
-      0xA40A0200,  //  0002  IMPORT	R2	K1
-      0x8C0C0502,  //  0003  GETMET	R3	R2	K2
-      0x5C140200,  //  0004  MOVE	R5	R1
-      0x7C0C0400,  //  0005  CALL	R3	2
-      0x50100000,  //  0006  LDBOOL	R4	0	0
-      0x4C140000,  //  0007  LDNIL	R5
-      0x1C140605,  //  0008  EQ	R5	R3	R5
-      0x78160004,  //  0009  JMPF	R5	#000F
-      0x8C140103,  //  000A  GETMET	R5	R0	K3
-      0x001E0801,  //  000B  ADD	R7	K4	R1
-      0x58200005,  //  000C  LDCONST	R8	K5
-      0x7C140600,  //  000D  CALL	R5	3
-      0x5C0C0200,  //  000E  MOVE	R3	R1
-      0x60140013,  //  000F  GETGBL	R5	G19
-      0x7C140000,  //  0010  CALL	R5	0
-      0x98160C03,  //  0011  SETIDX	R5	K6	R3
-      0x5C0C0A00,  //  0012  MOVE	R3	R5
-      0x58140007,  //  0013  LDCONST	R5	K7
-      0x6018000C,  //  0014  GETGBL	R6	G12
-      0x881C0100,  //  0015  GETMBR	R7	R0	K0
-      0x7C180200,  //  0016  CALL	R6	1
-      0x14180A06,  //  0017  LT	R6	R5	R6
-      0x781A000C,  //  0018  JMPF	R6	#0026
-      0x88180100,  //  0019  GETMBR	R6	R0	K0
-      0x94180C05,  //  001A  GETIDX	R6	R6	R5
-      0x8C1C0108,  //  001B  GETMET	R7	R0	K8
-      0x5C240600,  //  001C  MOVE	R9	R3
-      0x88280D09,  //  001D  GETMBR	R10	R6	K9
-      0x882C0D0A,  //  001E  GETMBR	R11	R6	K10
-      0x7C1C0800,  //  001F  CALL	R7	4
-      0x741E0001,  //  0020  JMPT	R7	#0023
-      0x74120000,  //  0021  JMPT	R4	#0023
-      0x50100001,  //  0022  LDBOOL	R4	0	1
-      0x50100200,  //  0023  LDBOOL	R4	1	0
-      0x00140B0B,  //  0024  ADD	R5	R5	K11
-      0x7001FFED,  //  0025  JMP		#0014
-      0x80040800,  //  0026  RET	1	R4
-      0x50080000,  //  0027  LDBOOL	R2	0	0
-      0x80040400,  //  0028  RET	1	R2
+      0x780A001D,  //  0001  JMPF	R2	#0020
+      0x88080101,  //  0002  GETMBR	R2	R0	K1
+      0x8C080502,  //  0003  GETMET	R2	R2	K2
+      0x58100003,  //  0004  LDCONST	R4	K3
+      0x7C080400,  //  0005  CALL	R2	2
+      0x740A0004,  //  0006  JMPT	R2	#000C
+      0x88080101,  //  0007  GETMBR	R2	R0	K1
+      0x8C080502,  //  0008  GETMET	R2	R2	K2
+      0x58100004,  //  0009  LDCONST	R4	K4
+      0x7C080400,  //  000A  CALL	R2	2
+      0x780A0013,  //  000B  JMPF	R2	#0020
+      0xA40A0A00,  //  000C  IMPORT	R2	K5
+      0x8C0C0506,  //  000D  GETMET	R3	R2	K6
+      0x5C140200,  //  000E  MOVE	R5	R1
+      0x7C0C0400,  //  000F  CALL	R3	2
+      0x4C100000,  //  0010  LDNIL	R4
+      0x1C100604,  //  0011  EQ	R4	R3	R4
+      0x78120004,  //  0012  JMPF	R4	#0018
+      0x8C100107,  //  0013  GETMET	R4	R0	K7
+      0x001A1001,  //  0014  ADD	R6	K8	R1
+      0x581C0009,  //  0015  LDCONST	R7	K9
+      0x7C100600,  //  0016  CALL	R4	3
+      0x5C0C0200,  //  0017  MOVE	R3	R1
+      0x60100013,  //  0018  GETGBL	R4	G19
+      0x7C100000,  //  0019  CALL	R4	0
+      0x98121403,  //  001A  SETIDX	R4	K10	R3
+      0x5C0C0800,  //  001B  MOVE	R3	R4
+      0x8C10010B,  //  001C  GETMET	R4	R0	K11
+      0x5C180600,  //  001D  MOVE	R6	R3
+      0x7C100400,  //  001E  CALL	R4	2
+      0x80040800,  //  001F  RET	1	R4
+      0x50080000,  //  0020  LDBOOL	R2	0	0
+      0x80040400,  //  0021  RET	1	R2
     })
   )
 );
@@ -547,7 +806,7 @@ be_local_closure(Tasmota_exec_tele,   /* name */
 ********************************************************************/
 be_local_closure(Tasmota_run_deferred,   /* name */
   be_nested_proto(
-    7,                          /* nstack */
+    9,                          /* nstack */
     1,                          /* argc */
     2,                          /* varg */
     0,                          /* has upvals */
@@ -555,44 +814,67 @@ be_local_closure(Tasmota_run_deferred,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[ 8]) {     /* constants */
+    ( &(const bvalue[10]) {     /* constants */
     /* K0   */  be_nested_str(_timers),
     /* K1   */  be_const_int(0),
-    /* K2   */  be_nested_str(size),
-    /* K3   */  be_nested_str(time_reached),
-    /* K4   */  be_nested_str(trig),
-    /* K5   */  be_nested_str(f),
-    /* K6   */  be_nested_str(remove),
-    /* K7   */  be_const_int(1),
+    /* K2   */  be_nested_str(time_reached),
+    /* K3   */  be_nested_str(trig),
+    /* K4   */  be_nested_str(heap_remove),
+    /* K5   */  be_nested_str(id),
+    /* K6   */  be_nested_str(_timers_id),
+    /* K7   */  be_nested_str(find),
+    /* K8   */  be_nested_str(remove),
+    /* K9   */  be_nested_str(f),
     }),
     &be_const_str_run_deferred,
     &be_const_str_solidified,
-    ( &(const binstruction[25]) {  /* code */
+    ( &(const binstruction[46]) {  /* code */
       0x88040100,  //  0000  GETMBR	R1	R0	K0
-      0x78060015,  //  0001  JMPF	R1	#0018
-      0x58040001,  //  0002  LDCONST	R1	K1
-      0x88080100,  //  0003  GETMBR	R2	R0	K0
-      0x8C080502,  //  0004  GETMET	R2	R2	K2
-      0x7C080200,  //  0005  CALL	R2	1
-      0x14080202,  //  0006  LT	R2	R1	R2
-      0x780A000F,  //  0007  JMPF	R2	#0018
-      0x88080100,  //  0008  GETMBR	R2	R0	K0
-      0x94080401,  //  0009  GETIDX	R2	R2	R1
-      0x8C0C0103,  //  000A  GETMET	R3	R0	K3
-      0x88140504,  //  000B  GETMBR	R5	R2	K4
-      0x7C0C0400,  //  000C  CALL	R3	2
-      0x780E0007,  //  000D  JMPF	R3	#0016
-      0x880C0505,  //  000E  GETMBR	R3	R2	K5
-      0x88100100,  //  000F  GETMBR	R4	R0	K0
-      0x8C100906,  //  0010  GETMET	R4	R4	K6
-      0x5C180200,  //  0011  MOVE	R6	R1
-      0x7C100400,  //  0012  CALL	R4	2
-      0x5C100600,  //  0013  MOVE	R4	R3
-      0x7C100000,  //  0014  CALL	R4	0
-      0x70020000,  //  0015  JMP		#0017
-      0x00040307,  //  0016  ADD	R1	R1	K7
-      0x7001FFEA,  //  0017  JMP		#0003
-      0x80000000,  //  0018  RET	0
+      0x7806002A,  //  0001  JMPF	R1	#002D
+      0x6008000C,  //  0002  GETGBL	R2	G12
+      0x5C0C0200,  //  0003  MOVE	R3	R1
+      0x7C080200,  //  0004  CALL	R2	1
+      0x24080501,  //  0005  GT	R2	R2	K1
+      0x780A0025,  //  0006  JMPF	R2	#002D
+      0x8C080102,  //  0007  GETMET	R2	R0	K2
+      0x94100301,  //  0008  GETIDX	R4	R1	K1
+      0x88100903,  //  0009  GETMBR	R4	R4	K3
+      0x7C080400,  //  000A  CALL	R2	2
+      0x780A0020,  //  000B  JMPF	R2	#002D
+      0x8C080104,  //  000C  GETMET	R2	R0	K4
+      0x5C100200,  //  000D  MOVE	R4	R1
+      0x58140001,  //  000E  LDCONST	R5	K1
+      0x7C080600,  //  000F  CALL	R2	3
+      0x880C0505,  //  0010  GETMBR	R3	R2	K5
+      0x4C100000,  //  0011  LDNIL	R4
+      0x200C0604,  //  0012  NE	R3	R3	R4
+      0x780E0014,  //  0013  JMPF	R3	#0029
+      0x880C0106,  //  0014  GETMBR	R3	R0	K6
+      0x8C0C0707,  //  0015  GETMET	R3	R3	K7
+      0x88140505,  //  0016  GETMBR	R5	R2	K5
+      0x7C0C0400,  //  0017  CALL	R3	2
+      0x4C100000,  //  0018  LDNIL	R4
+      0x20100604,  //  0019  NE	R4	R3	R4
+      0x7812000D,  //  001A  JMPF	R4	#0029
+      0x8C100708,  //  001B  GETMET	R4	R3	K8
+      0x8C180707,  //  001C  GETMET	R6	R3	K7
+      0x5C200400,  //  001D  MOVE	R8	R2
+      0x7C180400,  //  001E  CALL	R6	2
+      0x7C100400,  //  001F  CALL	R4	2
+      0x6010000C,  //  0020  GETGBL	R4	G12
+      0x5C140600,  //  0021  MOVE	R5	R3
+      0x7C100200,  //  0022  CALL	R4	1
+      0x1C100901,  //  0023  EQ	R4	R4	K1
+      0x78120003,  //  0024  JMPF	R4	#0029
+      0x88100106,  //  0025  GETMBR	R4	R0	K6
+      0x8C100908,  //  0026  GETMET	R4	R4	K8
+      0x88180505,  //  0027  GETMBR	R6	R2	K5
+      0x7C100400,  //  0028  CALL	R4	2
+      0x880C0509,  //  0029  GETMBR	R3	R2	K9
+      0x5C100600,  //  002A  MOVE	R4	R3
+      0x7C100000,  //  002B  CALL	R4	0
+      0x7001FFD4,  //  002C  JMP		#0002
+      0x80000000,  //  002D  RET	0
     })
   )
 );
@@ -1186,7 +1468,7 @@ be_local_closure(Tasmota_time_str,   /* name */
 ********************************************************************/
 be_local_closure(Tasmota_remove_rule,   /* name */
   be_nested_proto(
-    7,                          /* nstack */
+    9,                          /* nstack */
     3,                          /* argc */
     2,                          /* varg */
     0,                          /* has upvals */
@@ -1194,43 +1476,67 @@ be_local_closure(Tasmota_remove_rule,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[ 6]) {     /* constants */
+    ( &(const bvalue[10]) {     /* constants */
     /* K0   */  be_nested_str(_rules),
     /* K1   */  be_const_int(0),
     /* K2   */  be_nested_str(trig),
     /* K3   */  be_nested_str(id),
-    /* K4   */  be_nested_str(remove),
-    /* K5   */  be_const_int(1),
+    /* K4   */  be_nested_str(rule_key),
+    /* K5   */  be_nested_str(o),
+    /* K6   */  be_nested_str(_rules_keys),
+    /* K7   */  be_nested_str(find),
+    /* K8   */  be_const_int(1),
+    /* K9   */  be_nested_str(remove),
     }),
     &be_const_str_remove_rule,
     &be_const_str_solidified,
-    ( &(const binstruction[26]) {  /* code */
+    ( &(const binstruction[46]) {  /* code */
       0x880C0100,  //  0000  GETMBR	R3	R0	K0
-      0x780E0016,  //  0001  JMPF	R3	#0019
+      0x780E002A,  //  0001  JMPF	R3	#002D
       0x580C0001,  //  0002  LDCONST	R3	K1
       0x6010000C,  //  0003  GETGBL	R4	G12
       0x88140100,  //  0004  GETMBR	R5	R0	K0
       0x7C100200,  //  0005  CALL	R4	1
       0x14100604,  //  0006  LT	R4	R3	R4
-      0x78120010,  //  0007  JMPF	R4	#0019
+      0x78120024,  //  0007  JMPF	R4	#002D
       0x88100100,  //  0008  GETMBR	R4	R0	K0
       0x94100803,  //  0009  GETIDX	R4	R4	R3
       0x88100902,  //  000A  GETMBR	R4	R4	K2
       0x1C100801,  //  000B  EQ	R4	R4	R1
-      0x78120009,  //  000C  JMPF	R4	#0017
+      0x7812001D,  //  000C  JMPF	R4	#002B
       0x88100100,  //  000D  GETMBR	R4	R0	K0
       0x94100803,  //  000E  GETIDX	R4	R4	R3
       0x88100903,  //  000F  GETMBR	R4	R4	K3
       0x1C100802,  //  0010  EQ	R4	R4	R2
-      0x78120004,  //  0011  JMPF	R4	#0017
-      0x88100100,  //  0012  GETMBR	R4	R0	K0
-      0x8C100904,  //  0013  GETMET	R4	R4	K4
-      0x5C180600,  //  0014  MOVE	R6	R3
-      0x7C100400,  //  0015  CALL	R4	2
-      0x70020000,  //  0016  JMP		#0018
-      0x000C0705,  //  0017  ADD	R3	R3	K5
-      0x7001FFE9,  //  0018  JMP		#0003
-      0x80000000,  //  0019  RET	0
+      0x78120018,  //  0011  JMPF	R4	#002B
+      0x8C100104,  //  0012  GETMET	R4	R0	K4
+      0x88180100,  //  0013  GETMBR	R6	R0	K0
+      0x94180C03,  //  0014  GETIDX	R6	R6	R3
+      0x88180D05,  //  0015  GETMBR	R6	R6	K5
+      0x7C100400,  //  0016  CALL	R4	2
+      0x88140106,  //  0017  GETMBR	R5	R0	K6
+      0x8C140B07,  //  0018  GETMET	R5	R5	K7
+      0x5C1C0800,  //  0019  MOVE	R7	R4
+      0x58200001,  //  001A  LDCONST	R8	K1
+      0x7C140600,  //  001B  CALL	R5	3
+      0x04140B08,  //  001C  SUB	R5	R5	K8
+      0x24180B01,  //  001D  GT	R6	R5	K1
+      0x781A0002,  //  001E  JMPF	R6	#0022
+      0x88180106,  //  001F  GETMBR	R6	R0	K6
+      0x98180805,  //  0020  SETIDX	R6	R4	R5
+      0x70020003,  //  0021  JMP		#0026
+      0x88180106,  //  0022  GETMBR	R6	R0	K6
+      0x8C180D09,  //  0023  GETMET	R6	R6	K9
+      0x5C200800,  //  0024  MOVE	R8	R4
+      0x7C180400,  //  0025  CALL	R6	2
+      0x88180100,  //  0026  GETMBR	R6	R0	K0
+      0x8C180D09,  //  0027  GETMET	R6	R6	K9
+      0x5C200600,  //  0028  MOVE	R8	R3
+      0x7C180400,  //  0029  CALL	R6	2
+      0x70020000,  //  002A  JMP		#002C
+      0x000C0708,  //  002B  ADD	R3	R3	K8
+      0x7001FFD5,  //  002C  JMP		#0003
+      0x80000000,  //  002D  RET	0
     })
   )
 );
@@ -1866,7 +2172,7 @@ be_local_closure(Tasmota_add_cmd,   /* name */
 ********************************************************************/
 be_local_closure(Tasmota_add_rule,   /* name */
   be_nested_proto(
-    10,                          /* nstack */
+    13,                          /* nstack */
     4,                          /* argc */
     2,                          /* varg */
     0,                          /* has upvals */
@@ -1874,42 +2180,66 @@ be_local_closure(Tasmota_add_rule,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[ 7]) {     /* constants */
+    ( &(const bvalue[13]) {     /* constants */
     /* K0   */  be_nested_str(check_not_method),
     /* K1   */  be_nested_str(_rules),
-    /* K2   */  be_nested_str(function),
-    /* K3   */  be_nested_str(push),
-    /* K4   */  be_nested_str(Trigger),
-    /* K5   */  be_nested_str(value_error),
-    /* K6   */  be_nested_str(the_X20second_X20argument_X20is_X20not_X20a_X20function),
+    /* K2   */  be_nested_str(_rules_keys),
+    /* K3   */  be_nested_str(function),
+    /* K4   */  be_nested_str(compile_rule),
+    /* K5   */  be_nested_str(rule_key),
+    /* K6   */  be_nested_str(find),
+    /* K7   */  be_const_int(0),
+    /* K8   */  be_const_int(1),
+    /* K9   */  be_nested_str(push),
+    /* K10  */  be_nested_str(Trigger),
+    /* K11  */  be_nested_str(value_error),
+    /* K12  */  be_nested_str(the_X20second_X20argument_X20is_X20not_X20a_X20function),
     }),
     &be_const_str_add_rule,
     &be_const_str_solidified,
-    ( &(const binstruction[24]) {  /* code */
+    ( &(const binstruction[42]) {  /* code */
       0x8C100100,  //  0000  GETMET	R4	R0	K0
       0x5C180400,  //  0001  MOVE	R6	R2
       0x7C100400,  //  0002  CALL	R4	2
       0x88100101,  //  0003  GETMBR	R4	R0	K1
-      0x74120002,  //  0004  JMPT	R4	#0008
+      0x74120005,  //  0004  JMPT	R4	#000B
       0x60100012,  //  0005  GETGBL	R4	G18
       0x7C100000,  //  0006  CALL	R4	0
       0x90020204,  //  0007  SETMBR	R0	K1	R4
-      0x60100004,  //  0008  GETGBL	R4	G4
-      0x5C140400,  //  0009  MOVE	R5	R2
-      0x7C100200,  //  000A  CALL	R4	1
-      0x1C100902,  //  000B  EQ	R4	R4	K2
-      0x78120008,  //  000C  JMPF	R4	#0016
-      0x88100101,  //  000D  GETMBR	R4	R0	K1
-      0x8C100903,  //  000E  GETMET	R4	R4	K3
-      0xB81A0800,  //  000F  GETNGBL	R6	K4
-      0x5C1C0200,  //  0010  MOVE	R7	R1
-      0x5C200400,  //  0011  MOVE	R8	R2
-      0x5C240600,  //  0012  MOVE	R9	R3
-      0x7C180600,  //  0013  CALL	R6	3
-      0x7C100400,  //  0014  CALL	R4	2
-      0x70020000,  //  0015  JMP		#0017
-      0xB0060B06,  //  0016  RAISE	1	K5	K6
-      0x80000000,  //  0017  RET	0
+      0x60100013,  //  0008  GETGBL	R4	G19
+      0x7C100000,  //  0009  CALL	R4	0
+      0x90020404,  //  000A  SETMBR	R0	K2	R4
+      0x60100004,  //  000B  GETGBL	R4	G4
+      0x5C140400,  //  000C  MOVE	R5	R2
+      0x7C100200,  //  000D  CALL	R4	1
+      0x1C100903,  //  000E  EQ	R4	R4	K3
+      0x78120017,  //  000F  JMPF	R4	#0028
+      0x8C100104,  //  0010  GETMET	R4	R0	K4
+      0x5C180200,  //  0011  MOVE	R6	R1
+      0x7C100400,  //  0012  CALL	R4	2
+      0x8C140105,  //  0013  GETMET	R5	R0	K5
+      0x5C1C0800,  //  0014  MOVE	R7	R4
+      0x7C140400,  //  0015  CALL	R5	2
+      0x88180102,  //  0016  GETMBR	R6	R0	K2
+      0x881C0102,  //  0017  GETMBR	R7	R0	K2
+      0x8C1C0F06,  //  0018  GETMET	R7	R7	K6
+      0x5C240A00,  //  0019  MOVE	R9	R5
+      0x58280007,  //  001A  LDCONST	R10	K7
+      0x7C1C0600,  //  001B  CALL	R7	3
+      0x001C0F08,  //  001C  ADD	R7	R7	K8
+      0x98180A07,  //  001D  SETIDX	R6	R5	R7
+      0x88180101,  //  001E  GETMBR	R6	R0	K1
+      0x8C180D09,  //  001F  GETMET	R6	R6	K9
+      0xB8221400,  //  0020  GETNGBL	R8	K10
+      0x5C240200,  //  0021  MOVE	R9	R1
+      0x5C280400,  //  0022  MOVE	R10	R2
+      0x5C2C0600,  //  0023  MOVE	R11	R3
+      0x5C300800,  //  0024  MOVE	R12	R4
+      0x7C200800,  //  0025  CALL	R8	4
+      0x7C180400,  //  0026  CALL	R6	2
+      0x70020000,  //  0027  JMP		#0029
+      0xB006170C,  //  0028  RAISE	1	K11	K12
+      0x80000000,  //  0029  RET	0
     })
   )
 );
@@ -1921,7 +2251,7 @@ be_local_closure(Tasmota_add_rule,   /* name */
 ********************************************************************/
 be_local_closure(Tasmota_exec_rules,   /* name */
   be_nested_proto(
-    14,                          /* nstack */
+    12,                          /* nstack */
     3,                          /* argc */
     2,                          /* varg */
     0,                          /* has upvals */
@@ -1929,73 +2259,61 @@ be_local_closure(Tasmota_exec_rules,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[12]) {     /* constants */
+    ( &(const bvalue[ 9]) {     /* constants */
     /* K0   */  be_nested_str(cmd_res),
     /* K1   */  be_nested_str(_rules),
-    /* K2   */  be_nested_str(json),
-    /* K3   */  be_nested_str(load),
-    /* K4   */  be_nested_str(log),
-    /* K5   */  be_nested_str(BRY_X3A_X20ERROR_X2C_X20bad_X20json_X3A_X20),
-    /* K6   */  be_const_int(3),
-    /* K7   */  be_const_int(0),
-    /* K8   */  be_nested_str(try_rule),
-    /* K9   */  be_nested_str(trig),
-    /* K10  */  be_nested_str(f),
-    /* K11  */  be_const_int(1),
+    /* K2   */  be_nested_str(rule_keys_in),
+    /* K3   */  be_nested_str(json),
+    /* K4   */  be_nested_str(load),
+    /* K5   */  be_nested_str(log),
+    /* K6   */  be_nested_str(BRY_X3A_X20ERROR_X2C_X20bad_X20json_X3A_X20),
+    /* K7   */  be_const_int(3),
+    /* K8   */  be_nested_str(run_rules),
     }),
     &be_const_str_exec_rules,
     &be_const_str_solidified,
-    ( &(const binstruction[50]) {  /* code */
+    ( &(const binstruction[41]) {  /* code */
       0x880C0100,  //  0000  GETMBR	R3	R0	K0
-      0x88100101,  //  0001  GETMBR	R4	R0	K1
-      0x74120002,  //  0002  JMPT	R4	#0006
-      0x4C100000,  //  0003  LDNIL	R4
-      0x20100604,  //  0004  NE	R4	R3	R4
-      0x78120029,  //  0005  JMPF	R4	#0030
-      0xA4120400,  //  0006  IMPORT	R4	K2
-      0x4C140000,  //  0007  LDNIL	R5
-      0x90020005,  //  0008  SETMBR	R0	K0	R5
-      0x50140000,  //  0009  LDBOOL	R5	0	0
-      0x8C180903,  //  000A  GETMET	R6	R4	K3
-      0x5C200200,  //  000B  MOVE	R8	R1
-      0x7C180400,  //  000C  CALL	R6	2
-      0x4C1C0000,  //  000D  LDNIL	R7
-      0x1C1C0C07,  //  000E  EQ	R7	R6	R7
-      0x781E0004,  //  000F  JMPF	R7	#0015
-      0x8C1C0104,  //  0010  GETMET	R7	R0	K4
-      0x00260A01,  //  0011  ADD	R9	K5	R1
-      0x58280006,  //  0012  LDCONST	R10	K6
-      0x7C1C0600,  //  0013  CALL	R7	3
-      0x5C180200,  //  0014  MOVE	R6	R1
-      0x780A0014,  //  0015  JMPF	R2	#002B
-      0x881C0101,  //  0016  GETMBR	R7	R0	K1
-      0x781E0012,  //  0017  JMPF	R7	#002B
-      0x581C0007,  //  0018  LDCONST	R7	K7
-      0x6020000C,  //  0019  GETGBL	R8	G12
-      0x88240101,  //  001A  GETMBR	R9	R0	K1
-      0x7C200200,  //  001B  CALL	R8	1
-      0x14200E08,  //  001C  LT	R8	R7	R8
-      0x7822000C,  //  001D  JMPF	R8	#002B
-      0x88200101,  //  001E  GETMBR	R8	R0	K1
-      0x94201007,  //  001F  GETIDX	R8	R8	R7
-      0x8C240108,  //  0020  GETMET	R9	R0	K8
-      0x5C2C0C00,  //  0021  MOVE	R11	R6
-      0x88301109,  //  0022  GETMBR	R12	R8	K9
-      0x8834110A,  //  0023  GETMBR	R13	R8	K10
-      0x7C240800,  //  0024  CALL	R9	4
-      0x74260001,  //  0025  JMPT	R9	#0028
-      0x74160000,  //  0026  JMPT	R5	#0028
-      0x50140001,  //  0027  LDBOOL	R5	0	1
-      0x50140200,  //  0028  LDBOOL	R5	1	0
-      0x001C0F0B,  //  0029  ADD	R7	R7	K11
-      0x7001FFED,  //  002A  JMP		#0019
-      0x4C1C0000,  //  002B  LDNIL	R7
-      0x201C0607,  //  002C  NE	R7	R3	R7
-      0x781E0000,  //  002D  JMPF	R7	#002F
-      0x90020006,  //  002E  SETMBR	R0	K0	R6
-      0x80040A00,  //  002F  RET	1	R5
-      0x50100000,  //  0030  LDBOOL	R4	0	0
-      0x80040800,  //  0031  RET	1	R4
+      0x780A0005,  //  0001  JMPF	R2	#0008
+      0x88100101,  //  0002  GETMBR	R4	R0	K1
+      0x78120003,  //  0003  JMPF	R4	#0008
+      0x8C100102,  //  0004  GETMET	R4	R0	K2
+      0x5C180200,  //  0005  MOVE	R6	R1
+      0x7C100400,  //  0006  CALL	R4	2
+      0x74120000,  //  0007  JMPT	R4	#0009
+      0x50100001,  //  0008  LDBOOL	R4	0	1
+      0x50100200,  //  0009  LDBOOL	R4	1	0
+      0x74120002,  //  000A  JMPT	R4	#000E
+      0x4C140000,  //  000B  LDNIL	R5
+      0x20140605,  //  000C  NE	R5	R3	R5
+      0x78160018,  //  000D  JMPF	R5	#0027
+      0xA4160600,  //  000E  IMPORT	R5	K3
+      0x4C180000,  //  000F  LDNIL	R6
+      0x90020006,  //  0010  SETMBR	R0	K0	R6
+      0x50180000,  //  0011  LDBOOL	R6	0	0
+      0x8C1C0B04,  //  0012  GETMET	R7	R5	K4
+      0x5C240200,  //  0013  MOVE	R9	R1
+      0x7C1C0400,  //  0014  CALL	R7	2
+      0x4C200000,  //  0015  LDNIL	R8
+      0x1C200E08,  //  0016  EQ	R8	R7	R8
+      0x78220004,  //  0017  JMPF	R8	#001D
+      0x8C200105,  //  0018  GETMET	R8	R0	K5
+      0x002A0C01,  //  0019  ADD	R10	K6	R1
+      0x582C0007,  //  001A  LDCONST	R11	K7
+      0x7C200600,  //  001B  CALL	R8	3
+      0x5C1C0200,  //  001C  MOVE	R7	R1
+      0x78120003,  //  001D  JMPF	R4	#0022
+      0x8C200108,  //  001E  GETMET	R8	R0	K8
+      0x5C280E00,  //  001F  MOVE	R10	R7
+      0x7C200400,  //  0020  CALL	R8	2
+      0x5C181000,  //  0021  MOVE	R6	R8
+      0x4C200000,  //  0022  LDNIL	R8
+      0x20200608,  //  0023  NE	R8	R3	R8
+      0x78220000,  //  0024  JMPF	R8	#0026
+      0x90020007,  //  0025  SETMBR	R0	K0	R7
+      0x80040C00,  //  0026  RET	1	R6
+      0x50140000,  //  0027  LDBOOL	R5	0	0
+      0x80040A00,  //  0028  RET	1	R5
     })
   )
 );
@@ -2135,12 +2453,226 @@ be_local_closure(Tasmota_remove_cmd,   /* name */
 /*******************************************************************/
 
 
+/********************************************************************
+** Solidified function: heap_push
+********************************************************************/
+be_local_closure(Tasmota_heap_push,   /* name */
+  be_nested_proto(
+    7,                          /* nstack */
+    3,                          /* argc */
+    2,                          /* varg */
+    0,                          /* has upvals */
+    NULL,                       /* no upvals */
+    0,                          /* has sup protos */
+    NULL,                       /* no sub protos */
+    1,                          /* has constants */
+    ( &(const bvalue[ 3]) {     /* constants */
+    /* K0   */  be_nested_str(idx),
+    /* K1   */  be_nested_str(push),
+    /* K2   */  be_nested_str(heap_sift),
+    }),
+    &be_const_str_heap_push,
+    &be_const_str_solidified,
+    ( &(const binstruction[12]) {  /* code */
+      0x600C000C,  //  0000  GETGBL	R3	G12
+      0x5C100200,  //  0001  MOVE	R4	R1
+      0x7C0C0200,  //  0002  CALL	R3	1
+      0x900A0003,  //  0003  SETMBR	R2	K0	R3
+      0x8C0C0301,  //  0004  GETMET	R3	R1	K1
+      0x5C140400,  //  0005  MOVE	R5	R2
+      0x7C0C0400,  //  0006  CALL	R3	2
+      0x8C0C0102,  //  0007  GETMET	R3	R0	K2
+      0x5C140200,  //  0008  MOVE	R5	R1
+      0x88180500,  //  0009  GETMBR	R6	R2	K0
+      0x7C0C0600,  //  000A  CALL	R3	3
+      0x80000000,  //  000B  RET	0
+    })
+  )
+);
+/*******************************************************************/
+
+
+/********************************************************************
+** Solidified function: heap_sift
+********************************************************************/
+be_local_closure(Tasmota_heap_sift,   /* name */
+  be_nested_proto(
+    9,                          /* nstack */
+    3,                          /* argc */
+    2,                          /* varg */
+    0,                          /* has upvals */
+    NULL,                       /* no upvals */
+    0,                          /* has sup protos */
+    NULL,                       /* no sub protos */
+    1,                          /* has constants */
+    ( &(const bvalue[ 5]) {     /* constants */
+    /* K0   */  be_const_int(0),
+    /* K1   */  be_const_int(1),
+    /* K2   */  be_const_int(2),
+    /* K3   */  be_nested_str(trig),
+    /* K4   */  be_nested_str(idx),
+    }),
+    &be_const_str_heap_sift,
+    &be_const_str_solidified,
+    ( &(const binstruction[52]) {  /* code */
+      0x600C000C,  //  0000  GETGBL	R3	G12
+      0x5C100200,  //  0001  MOVE	R4	R1
+      0x7C0C0200,  //  0002  CALL	R3	1
+      0x94100202,  //  0003  GETIDX	R4	R1	R2
+      0x24140500,  //  0004  GT	R5	R2	K0
+      0x7816000C,  //  0005  JMPF	R5	#0013
+      0x04140501,  //  0006  SUB	R5	R2	K1
+      0x0C140B02,  //  0007  DIV	R5	R5	K2
+      0x94180205,  //  0008  GETIDX	R6	R1	R5
+      0x881C0903,  //  0009  GETMBR	R7	R4	K3
+      0x88200D03,  //  000A  GETMBR	R8	R6	K3
+      0x041C0E08,  //  000B  SUB	R7	R7	R8
+      0x281C0F00,  //  000C  GE	R7	R7	K0
+      0x781E0000,  //  000D  JMPF	R7	#000F
+      0x70020003,  //  000E  JMP		#0013
+      0x98040406,  //  000F  SETIDX	R1	R2	R6
+      0x901A0802,  //  0010  SETMBR	R6	K4	R2
+      0x5C080A00,  //  0011  MOVE	R2	R5
+      0x7001FFF0,  //  0012  JMP		#0004
+      0x50140200,  //  0013  LDBOOL	R5	1	0
+      0x7816001B,  //  0014  JMPF	R5	#0031
+      0x08160402,  //  0015  MUL	R5	K2	R2
+      0x00140B01,  //  0016  ADD	R5	R5	K1
+      0x28180A03,  //  0017  GE	R6	R5	R3
+      0x781A0000,  //  0018  JMPF	R6	#001A
+      0x70020016,  //  0019  JMP		#0031
+      0x94180205,  //  001A  GETIDX	R6	R1	R5
+      0x001C0B01,  //  001B  ADD	R7	R5	K1
+      0x141C0E03,  //  001C  LT	R7	R7	R3
+      0x781E0008,  //  001D  JMPF	R7	#0027
+      0x001C0B01,  //  001E  ADD	R7	R5	K1
+      0x941C0207,  //  001F  GETIDX	R7	R1	R7
+      0x881C0F03,  //  0020  GETMBR	R7	R7	K3
+      0x88200D03,  //  0021  GETMBR	R8	R6	K3
+      0x041C0E08,  //  0022  SUB	R7	R7	R8
+      0x141C0F00,  //  0023  LT	R7	R7	K0
+      0x781E0001,  //  0024  JMPF	R7	#0027
+      0x00140B01,  //  0025  ADD	R5	R5	K1
+      0x94180205,  //  0026  GETIDX	R6	R1	R5
+      0x881C0D03,  //  0027  GETMBR	R7	R6	K3
+      0x88200903,  //  0028  GETMBR	R8	R4	K3
+      0x041C0E08,  //  0029  SUB	R7	R7	R8
+      0x281C0F00,  //  002A  GE	R7	R7	K0
+      0x781E0000,  //  002B  JMPF	R7	#002D
+      0x70020003,  //  002C  JMP		#0031
+      0x98040406,  //  002D  SETIDX	R1	R2	R6
+      0x901A0802,  //  002E  SETMBR	R6	K4	R2
+      0x5C080A00,  //  002F  MOVE	R2	R5
+      0x7001FFE1,  //  0030  JMP		#0013
+      0x98040404,  //  0031  SETIDX	R1	R2	R4
+      0x90120802,  //  0032  SETMBR	R4	K4	R2
+      0x80000000,  //  0033  RET	0
+    })
+  )
+);
+/*******************************************************************/
+
+
+/********************************************************************
+** Solidified function: heap_remove
+********************************************************************/
+be_local_closure(Tasmota_heap_remove,   /* name */
+  be_nested_proto(
+    9,                          /* nstack */
+    3,                          /* argc */
+    2,                          /* varg */
+    0,                          /* has upvals */
+    NULL,                       /* no upvals */
+    0,                          /* has sup protos */
+    NULL,                       /* no sub protos */
+    1,                          /* has constants */
+    ( &(const bvalue[ 3]) {     /* constants */
+    /* K0   */  be_nested_str(pop),
+    /* K1   */  be_nested_str(heap_sift),
+    /* K2   */  be_nested_str(idx),
+    }),
+    &be_const_str_heap_remove,
+    &be_const_str_solidified,
+    ( &(const binstruction[16]) {  /* code */
+      0x940C0202,  //  0000  GETIDX	R3	R1	R2
+      0x8C100300,  //  0001  GETMET	R4	R1	K0
+      0x7C100200,  //  0002  CALL	R4	1
+      0x6014000C,  //  0003  GETGBL	R5	G12
+      0x5C180200,  //  0004  MOVE	R6	R1
+      0x7C140200,  //  0005  CALL	R5	1
+      0x14140405,  //  0006  LT	R5	R2	R5
+      0x78160004,  //  0007  JMPF	R5	#000D
+      0x98040404,  //  0008  SETIDX	R1	R2	R4
+      0x8C140101,  //  0009  GETMET	R5	R0	K1
+      0x5C1C0200,  //  000A  MOVE	R7	R1
+      0x5C200400,  //  000B  MOVE	R8	R2
+      0x7C140600,  //  000C  CALL	R5	3
+      0x4C140000,  //  000D  LDNIL	R5
+      0x900E0405,  //  000E  SETMBR	R3	K2	R5
+      0x80040600,  //  000F  RET	1	R3
+    })
+  )
+);
+/*******************************************************************/
+
+
+/********************************************************************
+** Solidified function: heap_remove_id
+********************************************************************/
+be_local_closure(Tasmota_heap_remove_id,   /* name */
+  be_nested_proto(
+    10,                          /* nstack */
+    3,                          /* argc */
+    2,                          /* varg */
+    0,                          /* has upvals */
+    NULL,                       /* no upvals */
+    0,                          /* has sup protos */
+    NULL,                       /* no sub protos */
+    1,                          /* has constants */
+    ( &(const bvalue[ 5]) {     /* constants */
+    /* K0   */  be_nested_str(copy),
+    /* K1   */  be_nested_str(clear),
+    /* K2   */  be_nested_str(id),
+    /* K3   */  be_nested_str(heap_push),
+    /* K4   */  be_nested_str(stop_iteration),
+    }),
+    &be_const_str_heap_remove_id,
+    &be_const_str_solidified,
+    ( &(const binstruction[22]) {  /* code */
+      0x8C0C0300,  //  0000  GETMET	R3	R1	K0
+      0x7C0C0200,  //  0001  CALL	R3	1
+      0x8C100301,  //  0002  GETMET	R4	R1	K1
+      0x7C100200,  //  0003  CALL	R4	1
+      0x60100010,  //  0004  GETGBL	R4	G16
+      0x5C140600,  //  0005  MOVE	R5	R3
+      0x7C100200,  //  0006  CALL	R4	1
+      0xA8020009,  //  0007  EXBLK	0	#0012
+      0x5C140800,  //  0008  MOVE	R5	R4
+      0x7C140000,  //  0009  CALL	R5	0
+      0x88180B02,  //  000A  GETMBR	R6	R5	K2
+      0x20180C02,  //  000B  NE	R6	R6	R2
+      0x781A0003,  //  000C  JMPF	R6	#0011
+      0x8C180103,  //  000D  GETMET	R6	R0	K3
+      0x5C200200,  //  000E  MOVE	R8	R1
+      0x5C240A00,  //  000F  MOVE	R9	R5
+      0x7C180600,  //  0010  CALL	R6	3
+      0x7001FFF5,  //  0011  JMP		#0008
+      0x58100004,  //  0012  LDCONST	R4	K4
+      0xAC100200,  //  0013  CATCH	R4	1	0
+      0xB0080000,  //  0014  RAISE	2	R0	R0
+      0x80000000,  //  0015  RET	0
+    })
+  )
+);
+/*******************************************************************/
+
+
 /********************************************************************
 ** Solidified function: set_timer
 ********************************************************************/
 be_local_closure(Tasmota_set_timer,   /* name */
   be_nested_proto(
-    10,                          /* nstack */
+    9,                          /* nstack */
     4,                          /* argc */
     2,                          /* varg */
     0,                          /* has upvals */
@@ -2148,35 +2680,60 @@ be_local_closure(Tasmota_set_timer,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[ 5]) {     /* constants */
+    ( &(const bvalue[ 8]) {     /* constants */
     /* K0   */  be_nested_str(check_not_method),
     /* K1   */  be_nested_str(_timers),
-    /* K2   */  be_nested_str(push),
+    /* K2   */  be_nested_str(_timers_id),
     /* K3   */  be_nested_str(Trigger),
     /* K4   */  be_nested_str(millis),
+    /* K5   */  be_nested_str(heap_push),
+    /* K6   */  be_nested_str(find),
+    /* K7   */  be_nested_str(push),
     }),
     &be_const_str_set_timer,
     &be_const_str_solidified,
-    ( &(const binstruction[19]) {  /* code */
+    ( &(const binstruction[41]) {  /* code */
       0x8C100100,  //  0000  GETMET	R4	R0	K0
       0x5C180400,  //  0001  MOVE	R6	R2
       0x7C100400,  //  0002  CALL	R4	2
       0x88100101,  //  0003  GETMBR	R4	R0	K1
-      0x74120002,  //  0004  JMPT	R4	#0008
+      0x74120005,  //  0004  JMPT	R4	#000B
       0x60100012,  //  0005  GETGBL	R4	G18
       0x7C100000,  //  0006  CALL	R4	0
       0x90020204,  //  0007  SETMBR	R0	K1	R4
-      0x88100101,  //  0008  GETMBR	R4	R0	K1
-      0x8C100902,  //  0009  GETMET	R4	R4	K2
-      0xB81A0600,  //  000A  GETNGBL	R6	K3
-      0x8C1C0104,  //  000B  GETMET	R7	R0	K4
-      0x5C240200,  //  000C  MOVE	R9	R1
-      0x7C1C0400,  //  000D  CALL	R7	2
-      0x5C200400,  //  000E  MOVE	R8	R2
-      0x5C240600,  //  000F  MOVE	R9	R3
-      0x7C180600,  //  0010  CALL	R6	3
-      0x7C100400,  //  0011  CALL	R4	2
-      0x80000000,  //  0012  RET	0
+      0x60100013,  //  0008  GETGBL	R4	G19
+      0x7C100000,  //  0009  CALL	R4	0
+      0x90020404,  //  000A  SETMBR	R0	K2	R4
+      0xB8120600,  //  000B  GETNGBL	R4	K3
+      0x8C140104,  //  000C  GETMET	R5	R0	K4
+      0x5C1C0200,  //  000D  MOVE	R7	R1
+      0x7C140400,  //  000E  CALL	R5	2
+      0x5C180400,  //  000F  MOVE	R6	R2
+      0x5C1C0600,  //  0010  MOVE	R7	R3
+      0x7C100600,  //  0011  CALL	R4	3
+      0x8C140105,  //  0012  GETMET	R5	R0	K5
+      0x881C0101,  //  0013  GETMBR	R7	R0	K1
+      0x5C200800,  //  0014  MOVE	R8	R4
+      0x7C140600,  //  0015  CALL	R5	3
+      0x4C140000,  //  0016  LDNIL	R5
+      0x20140605,  //  0017  NE	R5	R3	R5
+      0x7816000E,  //  0018  JMPF	R5	#0028
+      0x88140102,  //  0019  GETMBR	R5	R0	K2
+      0x8C140B06,  //  001A  GETMET	R5	R5	K6
+      0x5C1C0600,  //  001B  MOVE	R7	R3
+      0x7C140400,  //  001C  CALL	R5	2
+      0x4C180000,  //  001D  LDNIL	R6
+      0x1C180A06,  //  001E  EQ	R6	R5	R6
+      0x781A0004,  //  001F  JMPF	R6	#0025
+      0x60180012,  //  0020  GETGBL	R6	G18
+      0x7C180000,  //  0021  CALL	R6	0
+      0x5C140C00,  //  0022  MOVE	R5	R6
+      0x88180102,  //  0023  GETMBR	R6	R0	K2
+      0x98180605,  //  0024  SETIDX	R6	R3	R5
+      0x8C180B07,  //  0025  GETMET	R6	R5	K7
+      0x5C200800,  //  0026  MOVE	R8	R4
+      0x7C180400,  //  0027  CALL	R6	2
+      0x80000000,  //  0028  RET	0
     })
   )
 );
@@ -2188,7 +2745,7 @@ be_local_closure(Tasmota_set_timer,   /* name */
 ********************************************************************/
 be_local_closure(Tasmota_remove_timer,   /* name */
   be_nested_proto(
-    7,                          /* nstack */
+    10,                          /* nstack */
     2,                          /* argc */
     2,                          /* varg */
     0,                          /* has upvals */
@@ -2196,35 +2753,55 @@ be_local_closure(Tasmota_remove_timer,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[ 6]) {     /* constants */
+    ( &(const bvalue[ 8]) {     /* constants */
     /* K0   */  be_nested_str(_timers),
-    /* K1   */  be_const_int(0),
-    /* K2   */  be_nested_str(size),
-    /* K3   */  be_nested_str(id),
-    /* K4   */  be_nested_str(remove),
-    /* K5   */  be_const_int(1),
+    /* K1   */  be_nested_str(heap_remove_id),
+    /* K2   */  be_nested_str(_timers_id),
+    /* K3   */  be_nested_str(find),
+    /* K4   */  be_nested_str(heap_remove),
+    /* K5   */  be_nested_str(idx),
+    /* K6   */  be_nested_str(stop_iteration),
+    /* K7   */  be_nested_str(remove),
     }),
     &be_const_str_remove_timer,
     &be_const_str_solidified,
-    ( &(const binstruction[18]) {  /* code */
+    ( &(const binstruction[36]) {  /* code */
       0x88080100,  //  0000  GETMBR	R2	R0	K0
-      0x780A000E,  //  0001  JMPF	R2	#0011
-      0x580C0001,  //  0002  LDCONST	R3	K1
-      0x8C100502,  //  0003  GETMET	R4	R2	K2
-      0x7C100200,  //  0004  CALL	R4	1
-      0x14100604,  //  0005  LT	R4	R3	R4
-      0x78120009,  //  0006  JMPF	R4	#0011
-      0x94100403,  //  0007  GETIDX	R4	R2	R3
-      0x88100903,  //  0008  GETMBR	R4	R4	K3
-      0x1C100801,  //  0009  EQ	R4	R4	R1
-      0x78120003,  //  000A  JMPF	R4	#000F
-      0x8C100504,  //  000B  GETMET	R4	R2	K4
-      0x5C180600,  //  000C  MOVE	R6	R3
-      0x7C100400,  //  000D  CALL	R4	2
-      0x70020000,  //  000E  JMP		#0010
-      0x000C0705,  //  000F  ADD	R3	R3	K5
-      0x7001FFF1,  //  0010  JMP		#0003
-      0x80000000,  //  0011  RET	0
+      0x780A0020,  //  0001  JMPF	R2	#0023
+      0x4C0C0000,  //  0002  LDNIL	R3
+      0x1C0C0203,  //  0003  EQ	R3	R1	R3
+      0x780E0004,  //  0004  JMPF	R3	#000A
+      0x8C0C0101,  //  0005  GETMET	R3	R0	K1
+      0x5C140400,  //  0006  MOVE	R5	R2
+      0x5C180200,  //  0007  MOVE	R6	R1
+      0x7C0C0600,  //  0008  CALL	R3	3
+      0x70020018,  //  0009  JMP		#0023
+      0x880C0102,  //  000A  GETMBR	R3	R0	K2
+      0x8C0C0703,  //  000B  GETMET	R3	R3	K3
+      0x5C140200,  //  000C  MOVE	R5	R1
+      0x7C0C0400,  //  000D  CALL	R3	2
+      0x4C100000,  //  000E  LDNIL	R4
+      0x20100604,  //  000F  NE	R4	R3	R4
+      0x78120011,  //  0010  JMPF	R4	#0023
+      0x60100010,  //  0011  GETGBL	R4	G16
+      0x5C140600,  //  0012  MOVE	R5	R3
+      0x7C100200,  //  0013  CALL	R4	1
+      0xA8020006,  //  0014  EXBLK	0	#001C
+      0x5C140800,  //  0015  MOVE	R5	R4
+      0x7C140000,  //  0016  CALL	R5	0
+      0x8C180104,  //  0017  GETMET	R6	R0	K4
+      0x5C200400,  //  0018  MOVE	R8	R2
+      0x88240B05,  //  0019  GETMBR	R9	R5	K5
+      0x7C180600,  //  001A  CALL	R6	3
+      0x7001FFF8,  //  001B  JMP		#0015
+      0x58100006,  //  001C  LDCONST	R4	K6
+      0xAC100200,  //  001D  CATCH	R4	1	0
+      0xB0080000,  //  001E  RAISE	2	R0	R0
+      0x88100102,  //  001F  GETMBR	R4	R0	K2
+      0x8C100907,  //  0020  GETMET	R4	R4	K7
+      0x5C180200,  //  0021  MOVE	R6	R1
+      0x7C100400,  //  0022  CALL	R4	2
+      0x80000000,  //  0023  RET	0
     })
   )
 );
@@ -2236,7 +2813,7 @@ be_local_closure(Tasmota_remove_timer,   /* name */
 ********************************************************************/
 be_local_closure(Tasmota_add_cron,   /* name */
   be_nested_proto(
-    13,                          /* nstack */
+    14,                          /* nstack */
     4,                          /* argc */
     2,                          /* varg */
     0,                          /* has upvals */
@@ -2249,7 +2826,7 @@ be_local_closure(Tasmota_add_cron,   /* name */
     /* K1   */  be_nested_str(_crons),
     /* K2   */  be_nested_str(ccronexpr),
     /* K3   */  be_nested_str(next),
-    /* K4   */  be_nested_str(push),
+    /* K4   */  be_nested_str(heap_push),
     /* K5   */  be_nested_str(Trigger),
     }),
     &be_const_str_add_cron,
@@ -2270,15 +2847,15 @@ be_local_closure(Tasmota_add_cron,   /* name */
       0x7C100200,  //  000C  CALL	R4	1
       0x8C140903,  //  000D  GETMET	R5	R4	K3
       0x7C140200,  //  000E  CALL	R5	1
-      0x88180101,  //  000F  GETMBR	R6	R0	K1
-      0x8C180D04,  //  0010  GETMET	R6	R6	K4
-      0xB8220A00,  //  0011  GETNGBL	R8	K5
-      0x5C240A00,  //  0012  MOVE	R9	R5
-      0x5C280400,  //  0013  MOVE	R10	R2
-      0x5C2C0600,  //  0014  MOVE	R11	R3
-      0x5C300800,  //  0015  MOVE	R12	R4
-      0x7C200800,  //  0016  CALL	R8	4
-      0x7C180400,  //  0017  CALL	R6	2
+      0x8C180104,  //  000F  GETMET	R6	R0	K4
+      0x88200101,  //  0010  GETMBR	R8	R0	K1
+      0xB8260A00,  //  0011  GETNGBL	R9	K5
+      0x5C280A00,  //  0012  MOVE	R10	R5
+      0x5C2C0400,  //  0013  MOVE	R11	R2
+      0x5C300600,  //  0014  MOVE	R12	R3
+      0x5C340800,  //  0015  MOVE	R13	R4
+      0x7C240800,  //  0016  CALL	R9	4
+      0x7C180600,  //  0017  CALL	R6	3
       0x80000000,  //  0018  RET	0
     })
   )
@@ -2291,7 +2868,7 @@ be_local_closure(Tasmota_add_cron,   /* name */
 ********************************************************************/
 be_local_closure(Tasmota_run_cron,   /* name */
   be_nested_proto(
-    9,                          /* nstack */
+    11,                          /* nstack */
     1,                          /* argc */
     2,                          /* varg */
     0,                          /* has upvals */
@@ -2301,53 +2878,69 @@ be_local_closure(Tasmota_run_cron,   /* name */
     1,                          /* has constants */
     ( &(const bvalue[10]) {     /* constants */
     /* K0   */  be_nested_str(_crons),
-    /* K1   */  be_const_int(0),
-    /* K2   */  be_nested_str(ccronexpr),
-    /* K3   */  be_nested_str(now),
-    /* K4   */  be_nested_str(size),
-    /* K5   */  be_nested_str(trig),
-    /* K6   */  be_nested_str(next),
+    /* K1   */  be_nested_str(ccronexpr),
+    /* K2   */  be_nested_str(now),
+    /* K3   */  be_const_int(0),
+    /* K4   */  be_nested_str(trig),
+    /* K5   */  be_nested_str(next),
+    /* K6   */  be_nested_str(heap_sift),
     /* K7   */  be_nested_str(time_reached),
     /* K8   */  be_nested_str(f),
     /* K9   */  be_const_int(1),
     }),
     &be_const_str_run_cron,
     &be_const_str_solidified,
-    ( &(const binstruction[34]) {  /* code */
+    ( &(const binstruction[50]) {  /* code */
       0x88040100,  //  0000  GETMBR	R1	R0	K0
-      0x7806001E,  //  0001  JMPF	R1	#0021
-      0x58040001,  //  0002  LDCONST	R1	K1
-      0xB80A0400,  //  0003  GETNGBL	R2	K2
-      0x8C080503,  //  0004  GETMET	R2	R2	K3
-      0x7C080200,  //  0005  CALL	R2	1
-      0x880C0100,  //  0006  GETMBR	R3	R0	K0
-      0x8C0C0704,  //  0007  GETMET	R3	R3	K4
-      0x7C0C0200,  //  0008  CALL	R3	1
-      0x140C0203,  //  0009  LT	R3	R1	R3
-      0x780E0015,  //  000A  JMPF	R3	#0021
-      0x880C0100,  //  000B  GETMBR	R3	R0	K0
-      0x940C0601,  //  000C  GETIDX	R3	R3	R1
-      0x88100705,  //  000D  GETMBR	R4	R3	K5
-      0x1C100901,  //  000E  EQ	R4	R4	K1
-      0x78120003,  //  000F  JMPF	R4	#0014
-      0x8C100706,  //  0010  GETMET	R4	R3	K6
-      0x7C100200,  //  0011  CALL	R4	1
-      0x900E0A04,  //  0012  SETMBR	R3	K5	R4
-      0x7002000A,  //  0013  JMP		#001F
-      0x8C100707,  //  0014  GETMET	R4	R3	K7
-      0x7C100200,  //  0015  CALL	R4	1
-      0x78120007,  //  0016  JMPF	R4	#001F
-      0x88100708,  //  0017  GETMBR	R4	R3	K8
-      0x8C140706,  //  0018  GETMET	R5	R3	K6
-      0x7C140200,  //  0019  CALL	R5	1
-      0x900E0A05,  //  001A  SETMBR	R3	K5	R5
-      0x5C180800,  //  001B  MOVE	R6	R4
-      0x5C1C0400,  //  001C  MOVE	R7	R2
-      0x5C200A00,  //  001D  MOVE	R8	R5
-      0x7C180400,  //  001E  CALL	R6	2
-      0x00040309,  //  001F  ADD	R1	R1	K9
-      0x7001FFE4,  //  0020  JMP		#0006
-      0x80000000,  //  0021  RET	0
+      0x7806002E,  //  0001  JMPF	R1	#0031
+      0xB80A0200,  //  0002  GETNGBL	R2	K1
+      0x8C080502,  //  0003  GETMET	R2	R2	K2
+      0x7C080200,  //  0004  CALL	R2	1
+      0x600C000C,  //  0005  GETGBL	R3	G12
+      0x5C100200,  //  0006  MOVE	R4	R1
+      0x7C0C0200,  //  0007  CALL	R3	1
+      0x24100703,  //  0008  GT	R4	R3	K3
+      0x78120026,  //  0009  JMPF	R4	#0031
+      0x6010000C,  //  000A  GETGBL	R4	G12
+      0x5C140200,  //  000B  MOVE	R5	R1
+      0x7C100200,  //  000C  CALL	R4	1
+      0x24100903,  //  000D  GT	R4	R4	K3
+      0x78120021,  //  000E  JMPF	R4	#0031
+      0x94100303,  //  000F  GETIDX	R4	R1	K3
+      0x88140904,  //  0010  GETMBR	R5	R4	K4
+      0x1C140B03,  //  0011  EQ	R5	R5	K3
+      0x7816000A,  //  0012  JMPF	R5	#001E
+      0x8C140905,  //  0013  GETMET	R5	R4	K5
+      0x7C140200,  //  0014  CALL	R5	1
+      0x1C180B03,  //  0015  EQ	R6	R5	K3
+      0x781A0000,  //  0016  JMPF	R6	#0018
+      0x70020018,  //  0017  JMP		#0031
+      0x90120805,  //  0018  SETMBR	R4	K4	R5
+      0x8C180106,  //  0019  GETMET	R6	R0	K6
+      0x5C200200,  //  001A  MOVE	R8	R1
+      0x58240003,  //  001B  LDCONST	R9	K3
+      0x7C180600,  //  001C  CALL	R6	3
+      0x70020010,  //  001D  JMP		#002F
+      0x8C140907,  //  001E  GETMET	R5	R4	K7
+      0x7C140200,  //  001F  CALL	R5	1
+      0x7816000C,  //  0020  JMPF	R5	#002E
+      0x88140908,  //  0021  GETMBR	R5	R4	K8
+      0x8C180905,  //  0022  GETMET	R6	R4	K5
+      0x7C180200,  //  0023  CALL	R6	1
+      0x90120806,  //  0024  SETMBR	R4	K4	R6
+      0x8C1C0106,  //  0025  GETMET	R7	R0	K6
+      0x5C240200,  //  0026  MOVE	R9	R1
+      0x58280003,  //  0027  LDCONST	R10	K3
+      0x7C1C0600,  //  0028  CALL	R7	3
+      0x5C1C0A00,  //  0029  MOVE	R7	R5
+      0x5C200400,  //  002A  MOVE	R8	R2
+      0x5C240C00,  //  002B  MOVE	R9	R6
+      0x7C1C0400,  //  002C  CALL	R7	2
+      0x70020000,  //  002D  JMP		#002F
+      0x70020001,  //  002E  JMP		#0031
+      0x040C0709,  //  002F  SUB	R3	R3	K9
+      0x7001FFD6,  //  0030  JMP		#0008
+      0x80000000,  //  0031  RET	0
     })
   )
 );
@@ -2414,35 +3007,20 @@ be_local_closure(Tasmota_remove_cron,   /* name */
     0,                          /* has sup protos */
     NULL,                       /* no sub protos */
     1,                          /* has constants */
-    ( &(const bvalue[ 6]) {     /* constants */
+    ( &(const bvalue[ 2]) {     /* constants */
     /* K0   */  be_nested_str(_crons),
-    /* K1   */  be_const_int(0),
-    /* K2   */  be_nested_str(size),
-    /* K3   */  be_nested_str(id),
-    /* K4   */  be_nested_str(remove),
-    /* K5   */  be_const_int(1),
+    /* K1   */  be_nested_str(heap_remove_id),
     }),
     &be_const_str_remove_cron,
     &be_const_str_solidified,
-    ( &(const binstruction[18]) {  /* code */
+    ( &(const binstruction[ 7]) {  /* code */
       0x88080100,  //  0000  GETMBR	R2	R0	K0
-      0x780A000E,  //  0001  JMPF	R2	#0011
-      0x580C0001,  //  0002  LDCONST	R3	K1
-      0x8C100502,  //  0003  GETMET	R4	R2	K2
-      0x7C100200,  //  0004  CALL	R4	1
-      0x14100604,  //  0005  LT	R4	R3	R4
-      0x78120009,  //  0006  JMPF	R4	#0011
-      0x94100403,  //  0007  GETIDX	R4	R2	R3
-      0x88100903,  //  0008  GETMBR	R4	R4	K3
-      0x1C100801,  //  0009  EQ	R4	R4	R1
-      0x78120003,  //  000A  JMPF	R4	#000F
-      0x8C100504,  //  000B  GETMET	R4	R2	K4
-      0x5C180600,  //  000C  MOVE	R6	R3
-      0x7C100400,  //  000D  CALL	R4	2
-      0x70020000,  //  000E  JMP		#0010
-      0x000C0705,  //  000F  ADD	R3	R3	K5
-      0x7001FFF1,  //  0010  JMP		#0003
-      0x80000000,  //  0011  RET	0
+      0x780A0003,  //  0001  JMPF	R2	#0006
+      0x8C0C0101,  //  0002  GETMET	R3	R0	K1
+      0x5C140400,  //  0003  MOVE	R5	R2
+      0x5C180200,  //  0004  MOVE	R6	R1
+      0x7C0C0600,  //  0005  CALL	R3	3
+      0x80000000,  //  0006  RET	0
     })
   )
 );
@@ -2599,7 +3177,9 @@ be_local_closure(Tasmota_check_not_method,   /* name */
 class be_class_tasmota (scope: global, name: Tasmota) {
     _fl, var
     _rules, var
+    _rules_keys, var
     _timers, var
+    _timers_id, var
     _crons, var
     _ccmd, var
     _drivers, var
@@ -2669,9 +3249,17 @@ class be_class_tasmota (scope: global, name: Tasmota) {
     find_op, closure(Tasmota_find_op_closure)
     add_rule, closure(Tasmota_add_rule_closure)
     remove_rule, closure(Tasmota_remove_rule_closure)
+    compile_rule, closure(Tasmota_compile_rule_closure)
+    rule_key, closure(Tasmota_rule_key_closure)
+    rule_keys_in, closure(Tasmota_rule_keys_in_closure)
     try_rule, closure(Tasmota_try_rule_closure)
+    run_rules, closure(Tasmota_run_rules_closure)
     exec_rules, closure(Tasmota_exec_rules_closure)
     exec_tele, closure(Tasmota_exec_tele_closure)
+    heap_push, closure(Tasmota_heap_push_closure)
+    heap_sift, closure(Tasmota_heap_sift_closure)
+    heap_remove, closure(Tasmota_heap_remove_closure)
+    heap_remove_id, closure(Tasmota_heap_remove_id_closure)
     set_timer, closure(Tasmota_set_timer_closure)
     run_deferred, closure(Tasmota_run_deferred_closure)
     remove_timer, closure(Tasmota_remove_timer_closure)
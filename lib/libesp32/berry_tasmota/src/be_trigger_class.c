@@ -164,18 +164,19 @@ be_local_closure(Trigger_next,   /* name */
 ** Solidified class: Trigger
 ********************************************************************/
 be_local_class(Trigger,
-    4,
+    5,
     NULL,
-    be_nested_map(8,
+    be_nested_map(9,
     ( (struct bmapnode*) &(const bmapnode[]) {
-        { be_const_key(id, 2), be_const_var(2) },
-        { be_const_key(f, -1), be_const_var(1) },
-        { be_const_key(next, -1), be_const_closure(Trigger_next_closure) },
-        { be_const_key(trig, 7), be_const_var(0) },
-        { be_const_key(time_reached, -1), be_const_closure(Trigger_time_reached_closure) },
-        { be_const_key(tostring, 4), be_const_closure(Trigger_tostring_closure) },
+        { be_const_key(trig, -1), be_const_var(0) },
         { be_const_key(o, -1), be_const_var(3) },
+        { be_const_key(next, -1), be_const_closure(Trigger_next_closure) },
+        { be_const_key(f, -1), be_const_var(1) },
         { be_const_key(init, -1), be_const_closure(Trigger_init_closure) },
+        { be_const_key(time_reached, -1), be_const_closure(Trigger_time_reached_closure) },
+        { be_const_key(id, 4), be_const_var(2) },
+        { be_const_key(tostring, -1), be_const_closure(Trigger_tostring_closure) },
+        { be_const_key(idx, 3), be_const_var(4) },
     })),
     be_str_weak(Trigger)
 );
@@ -11,6 +11,39 @@ static const int lv_tick_interval_ms = 5;
 
 static void lv_tick_handler(void) { lv_tick_inc(lv_tick_interval_ms); }
 
+// ASYNC DMA FLUSH ---------------------------------------------------------
+
+// Called by the display when the pixels of the last flush are on the wire
+static void lv_flush_done(void *arg) {
+  ((Adafruit_LvGL_Glue *)arg)->flushDone();
+}
+
+// Called by LVGL while it waits for a buffer to be released
+static void lv_flush_wait(lv_disp_drv_t *disp) {
+  Adafruit_LvGL_Glue *glue = (Adafruit_LvGL_Glue *)disp->user_data;
+  glue->display->dmaBusy();     // completes the flush when DMA is over
+}
+
+// Called by LVGL after each refresh cycle
+static void lv_flush_monitor(lv_disp_drv_t *disp, uint32_t time, uint32_t px) {
+  Adafruit_LvGL_Glue *glue = (Adafruit_LvGL_Glue *)disp->user_data;
+  glue->frame_time_ms = time;
+  glue->frame_pixels = px;
+}
+
+/**
+ * @brief Acknowledge the flush in progress to LVGL and update flush statistics
+ *
+ */
+void Adafruit_LvGL_Glue::flushDone(void) {
+  if (flush_disp == nullptr) { return; }    // not a flush from LVGL
+  flush_time_us = micros() - flush_start;
+  flush_bytes_ms = flush_time_us ? (uint64_t)flush_pixels * pixel_bytes * 1000 / flush_time_us : 0;
+  lv_disp_drv_t *disp = flush_disp;
+  flush_disp = nullptr;
+  lv_disp_flush_ready(disp);
+}
+
 // TOUCHSCREEN STUFF -------------------------------------------------------
 
 
@@ -113,7 +146,8 @@ static void touchscreen_read(lv_indev_drv_t *indev_drv, lv_indev_data_t *data) {
  *
  */
 Adafruit_LvGL_Glue::Adafruit_LvGL_Glue(void)
-    : first_frame(true), lv_pixel_buf(NULL) {
+    : first_frame(true), async_flush(false), flush_disp(NULL), flush_start(0), flush_pixels(0),
+      flush_time_us(0), flush_bytes_ms(0), pixel_bytes(2), frame_time_ms(0), frame_pixels(0), lv_pixel_buf(NULL) {
 }
 
 // Destructor
@@ -237,6 +271,16 @@ LvGLStatus Adafruit_LvGL_Glue::begin(Renderer *tft, void *touch, bool debug) {
     lv_disp_drv.flush_cb = lv_flush_callback;
     lv_disp_drv.draw_buf = &lv_disp_buf;
     lv_disp_drv.user_data = (void*)this;
+    lv_disp_drv.monitor_cb = lv_flush_monitor;
+    // with async DMA, the flush returns while the transfer is running and
+    // the second buffer is rendered meanwhile; completion releases the first
+    // the renderer must confirm it calls back at the end of every flush, or LVGL waits forever
+    pixel_bytes = tft->lvgl_pixel_bytes();
+    if (tft->lvgl_pars()->use_dma && tft->lvgl_pars()->async_dma &&
+        tft->SetFlushDoneCB(lv_flush_done, (void*)this)) {
+      async_flush = true;
+      lv_disp_drv.wait_cb = lv_flush_wait;
+    }
     lv_disp_drv_register(&lv_disp_drv);
 
     // Initialize LvGL input device (touchscreen already started)
@@ -36,6 +36,16 @@ public:
   bool is_adc_touch; ///< determines if the touchscreen controlelr is ADC based
   bool first_frame;  ///< Tracks if a call to `lv_flush_callback` needs to wait
                      ///< for DMA transfer to complete
+  bool async_flush;  ///< Flush is acknowledged by `lv_flush_done` when DMA completes
+  lv_disp_drv_t *flush_disp;  ///< Driver of the flush in progress, NULL if none
+  uint32_t flush_start;       ///< micros() when the flush in progress started
+  uint32_t flush_pixels;      ///< Pixels of the flush in progress
+  uint32_t flush_time_us;     ///< Duration of the last completed flush
+  uint32_t flush_bytes_ms;    ///< Throughput of the last completed flush
+  uint8_t pixel_bytes;        ///< Bytes per pixel sent to the panel
+  uint32_t frame_time_ms;     ///< Render + flush time of the last frame (from LVGL monitor)
+  uint32_t frame_pixels;      ///< Pixels refreshed in the last frame
+  void flushDone(void);
   void setScreenshotFile(File *f) { screenshot = f; }
   File * getScreenshotFile(void) const { return screenshot; }
   void stopScreenshot(void) { screenshot = nullptr; }
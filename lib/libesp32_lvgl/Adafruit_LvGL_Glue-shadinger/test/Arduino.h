@@ -0,0 +1,19 @@
+/*
+  Arduino.h - minimal host shim to build the LVGL glue on a PC for tests
+*/
+
+#ifndef __ARDUINO_HOST_SHIM__
+#define __ARDUINO_HOST_SHIM__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+typedef bool boolean;
+
+extern uint32_t host_micros;                 // advanced by the test, not by wall time
+
+inline uint32_t micros(void) { return host_micros; }
+inline uint32_t millis(void) { return host_micros / 1000; }
+
+#endif // __ARDUINO_HOST_SHIM__
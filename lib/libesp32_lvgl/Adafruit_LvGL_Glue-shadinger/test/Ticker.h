@@ -0,0 +1,15 @@
+/*
+  Ticker.h - host shim, the test drives lv_tick_inc() itself
+*/
+
+#ifndef __TICKER_HOST_SHIM__
+#define __TICKER_HOST_SHIM__
+
+#include "Arduino.h"
+
+class Ticker {
+public:
+  void attach_ms(uint32_t ms, void (*cb)(void)) {}
+};
+
+#endif // __TICKER_HOST_SHIM__
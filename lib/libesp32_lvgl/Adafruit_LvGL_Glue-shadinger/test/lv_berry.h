@@ -0,0 +1,19 @@
+/*
+  lv_berry.h - host shim with the touchscreen calibration used by the glue
+*/
+
+#ifndef __LV_BERRY__
+#define __LV_BERRY__
+
+#include "lvgl.h"
+
+typedef struct lv_ts_calibration_t {
+  lv_coord_t        raw_x;
+  lv_coord_t        raw_y;
+  lv_coord_t        x;
+  lv_coord_t        y;
+  lv_indev_state_t  state;
+} lv_ts_calibration_t;
+extern lv_ts_calibration_t lv_ts_calibration;
+
+#endif // __LV_BERRY__
@@ -0,0 +1,13 @@
+/*
+  lv_conf.h - minimal LVGL configuration for host tests, everything else uses LVGL defaults
+*/
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#define LV_COLOR_DEPTH 16
+#define LV_COLOR_16_SWAP 1
+#define LV_MEM_CUSTOM 1
+#define LV_TICK_CUSTOM 0
+
+#endif // LV_CONF_H
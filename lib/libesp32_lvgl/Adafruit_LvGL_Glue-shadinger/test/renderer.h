@@ -0,0 +1,52 @@
+/*
+  renderer.h - host stand-in for the Renderer interface used by the LVGL glue
+
+  Only the members the glue and lv_flush_callback() use, with the same signatures and
+  defaults as lib/lib_display/Display_Renderer-gemu-1.0/src/renderer.h
+*/
+
+#ifndef RENDERER_H
+#define RENDERER_H
+
+#include "Arduino.h"
+
+typedef struct LVGL_PARAMS {
+  uint16_t fluslines;
+  union {
+    uint8_t data;
+    struct {
+      uint8_t use_dma : 1;
+      uint8_t swap_color : 1;
+      uint8_t async_dma : 1;
+      uint8_t resvd_1 : 1;
+      uint8_t resvd_2 : 1;
+      uint8_t resvd_3 : 1;
+      uint8_t resvd_4 : 1;
+      uint8_t resvd_5 : 1;
+    };
+  };
+}LVGL_PARAMS;
+
+typedef void (*flush_done_cb)(void *);
+
+class Renderer {
+public:
+  Renderer(int16_t x, int16_t y) : _width(x), _height(y) { lvgl_param.fluslines = 0; lvgl_param.data = 0; }
+  virtual ~Renderer() {}
+  int16_t width(void) const { return _width; }
+  int16_t height(void) const { return _height; }
+  virtual void pushColors(uint16_t *data, uint16_t len, boolean first) {}
+  virtual void setAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {}
+  virtual LVGL_PARAMS *lvgl_pars(void) { return &lvgl_param; }
+  virtual bool dmaBusy(void) { return false; }
+  virtual void dmaWait(void) {}
+  virtual bool SetFlushDoneCB(flush_done_cb cb, void *arg) { return false; }
+  virtual uint8_t lvgl_pixel_bytes(void) { return 2; }
+  flush_done_cb flush_done_cbp = 0;
+  void *flush_done_arg = 0;
+  LVGL_PARAMS lvgl_param;
+protected:
+  int16_t _width, _height;
+};
+
+#endif // RENDERER_H
@@ -0,0 +1,220 @@
+// Host test of the LVGL flush state machine with a mock Renderer
+//
+// A full screen redraw is run through the real LVGL refresh and the real glue. The mock display
+// models uDisplay's async DMA: pushColors() starts a transfer that completes after a number of
+// dmaBusy() polls, and setAddrWindow(0,0,0,0) defers the end of the flush until then. Like FUNC_LOOP
+// in xdrv_54_lvgl.ino each loop ends with dmaWait() so no transfer or SPI transaction is left open for
+// other users of the bus (i.e. touch controllers polled from FUNC_EVERY_100_MSECOND).
+// lv_flush_callback() below follows the one in xdrv_54_lvgl.ino without screenshot and logging.
+//
+// gcc -c -O1 -DLV_CONF_INCLUDE_SIMPLE -I. -I../../lvgl $(find ../../lvgl/src -name '*.c') && ar rcs liblvgl.a *.o && rm *.o
+// g++ -O1 -DLV_CONF_INCLUDE_SIMPLE -I. -I.. -I../../lvgl test-flush.cpp ../Adafruit_LvGL_Glue.cpp liblvgl.a -o test-flush && ./test-flush
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "Adafruit_LvGL_Glue.h"
+#include "lv_berry.h"
+
+uint32_t host_micros = 0;
+lv_ts_calibration_t lv_ts_calibration;
+uint32_t Touch_Status(int32_t sel) { return 0; }
+
+static uint32_t checks = 0;
+static uint32_t failures = 0;
+
+#define CHECK(cond) do { checks++; if (!(cond)) { failures++; printf("  FAIL %s:%d %s\n", __FILE__, __LINE__, #cond); } } while (0)
+
+static uint32_t checksum(const uint16_t *data, uint32_t len) {
+  uint32_t h = 2166136261;
+  for (uint32_t i = 0; i < len; i++) { h = (h ^ data[i]) * 16777619; }
+  return h;
+}
+
+class MockDisplay : public Renderer {
+public:
+  // mode: 0 = renderer without flush done callback, 1 = async DMA (uDisplay 16 bpp), 2 = framebuffer (uDisplay bpp != 16)
+  MockDisplay(int16_t w, int16_t h, uint8_t mode, uint8_t pixel_bytes) : Renderer(w, h), mode(mode), bytes(pixel_bytes) {
+    lvgl_param.fluslines = 40;
+    lvgl_param.use_dma = 1;
+    lvgl_param.async_dma = 1;
+  }
+
+  bool SetFlushDoneCB(flush_done_cb cb, void *arg) {
+    if (0 == mode) { return false; }
+    flush_done_cbp = cb;
+    flush_done_arg = arg;
+    return true;
+  }
+
+  uint8_t lvgl_pixel_bytes(void) { return bytes; }
+
+  void setAddrWindow(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    if (x0 || y0 || x1 || y1) {
+      if (busy_polls) {                  // beginTransaction() waits for the previous transfer
+        forced_waits++;
+        dmaWait();
+      }
+      return;
+    }
+    if ((1 == mode) && busy_polls) {
+      end_pending = true;
+      return;
+    }
+    done();
+  }
+
+  void pushColors(uint16_t *data, uint16_t len, boolean first) {
+    flushes++;
+    pixels += len;
+    if (data != last_buf) { buffer_swaps++; }
+    last_buf = data;
+    if (1 == mode) {
+      in_flight = data;
+      in_flight_len = len;
+      in_flight_sum = checksum(data, len);
+      busy_polls = 4;
+    }
+  }
+
+  bool dmaBusy(void) {
+    if (!busy_polls) {
+      if (++idle_polls > 100000) {         // LVGL waits for a flush nobody acknowledges, the watchdog would fire
+        printf("  FAIL flush never acknowledged\n");
+        exit(1);
+      }
+      return false;
+    }
+    idle_polls = 0;
+    host_micros += 100;                  // transfer progresses while LVGL renders or waits
+    if (lv_disp_get_default()->driver->draw_buf->flushing == 0) { early_ready++; }
+    if (--busy_polls) { return true; }
+    complete();
+    return false;
+  }
+
+  void dmaWait(void) {
+    while (dmaBusy());
+  }
+
+  uint8_t mode;
+  uint8_t bytes;
+  uint32_t busy_polls = 0;
+  uint32_t idle_polls = 0;
+  bool end_pending = false;
+  uint16_t *in_flight = nullptr;
+  uint32_t in_flight_len = 0;
+  uint32_t in_flight_sum = 0;
+  uint16_t *last_buf = nullptr;
+  uint32_t flushes = 0;
+  uint32_t pixels = 0;
+  uint32_t buffer_swaps = 0;
+  uint32_t forced_waits = 0;             // flush started before the previous one was acknowledged
+  uint32_t early_ready = 0;              // LVGL released the buffer before the transfer ended
+  uint32_t overwritten = 0;              // LVGL rendered into the buffer under transfer
+  uint32_t bus_held = 0;                 // Transfer or transaction left open after a loop
+
+private:
+  void complete(void) {
+    if (checksum(in_flight, in_flight_len) != in_flight_sum) { overwritten++; }
+    in_flight = nullptr;
+    if (end_pending) {
+      end_pending = false;
+      done();
+    }
+  }
+
+  void done(void) {
+    if (flush_done_cbp) { flush_done_cbp(flush_done_arg); }
+  }
+};
+
+// Follows lv_flush_callback() in xdrv_54_lvgl.ino
+void lv_flush_callback(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
+  Adafruit_LvGL_Glue *glue = (Adafruit_LvGL_Glue *)disp->user_data;
+
+  uint16_t width = (area->x2 - area->x1 + 1);
+  uint16_t height = (area->y2 - area->y1 + 1);
+
+  Renderer *display = glue->display;
+
+  uint32_t pixels_len = width * height;
+  glue->flush_start = micros();
+  glue->flush_pixels = pixels_len;
+  glue->flush_disp = disp;
+  display->setAddrWindow(area->x1, area->y1, area->x1+width, area->y1+height);
+  display->pushColors((uint16_t *)color_p, pixels_len, false);
+  display->setAddrWindow(0,0,0,0);
+
+  if (!glue->async_flush) {
+    glue->flushDone();
+  }
+}
+
+// Redraw the whole screen, polling like FUNC_LOOP, returns false if LVGL never completes
+static bool redraw(Adafruit_LvGL_Glue *glue, MockDisplay *display) {
+  lv_obj_t *scr = lv_scr_act();
+  lv_obj_set_style_bg_color(scr, lv_color_hex(0x102030 + display->flushes), 0);
+  lv_obj_invalidate(scr);
+  for (uint32_t loop = 0; loop < 1000; loop++) {
+    if (glue->async_flush) { glue->display->dmaBusy(); }
+    lv_tick_inc(5);
+    host_micros += 5000;
+    lv_timer_handler();
+    if (glue->async_flush) { glue->display->dmaWait(); }
+    if (display->busy_polls || display->end_pending) { display->bus_held++; }   // Other SPI users would block
+    lv_disp_t *disp = lv_disp_get_default();
+    if ((0 == disp->inv_p) && !disp->driver->draw_buf->flushing && (nullptr == glue->flush_disp) && !display->busy_polls) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static void run(const char *name, uint8_t mode, uint8_t pixel_bytes) {
+  printf("%s\n", name);
+  MockDisplay *display = new MockDisplay(320, 480, mode, pixel_bytes);
+  Adafruit_LvGL_Glue *glue = new Adafruit_LvGL_Glue();
+  CHECK(LVGL_OK == glue->begin(display, false));
+  lv_disp_t *disp = lv_disp_get_default();
+  while (lv_disp_get_next(disp)) { disp = lv_disp_get_next(disp); }   // last registered is ours
+  lv_disp_set_default(disp);
+  lv_obj_t *label = lv_label_create(lv_scr_act());
+  lv_label_set_text(label, "Tasmota");
+
+  CHECK(glue->async_flush == (0 != mode));
+  CHECK(glue->pixel_bytes == pixel_bytes);
+  for (uint32_t frame = 0; frame < 3; frame++) {
+    uint32_t pixels = display->pixels;
+    CHECK(redraw(glue, display));
+    CHECK(display->pixels - pixels == 320 * 480);
+  }
+  CHECK(display->flushes >= 3 * (480 / 20));        // two buffers of 20 lines each
+  CHECK(display->buffer_swaps == display->flushes);  // buffers alternate
+  CHECK(0 == display->forced_waits);
+  CHECK(0 == display->early_ready);
+  CHECK(0 == display->overwritten);
+  CHECK(0 == display->bus_held);
+  CHECK(nullptr == glue->flush_disp);
+  CHECK(glue->frame_pixels == 320 * 480);
+  if (1 == mode) {
+    CHECK(glue->flush_time_us >= 400);
+    CHECK(glue->flush_bytes_ms == (uint64_t)glue->flush_pixels * pixel_bytes * 1000 / glue->flush_time_us);
+  }
+  printf("  %u flushes, last %u pixels in %u us (%u bytes/ms), frame %u ms\n", display->flushes, glue->flush_pixels,
+         glue->flush_time_us, glue->flush_bytes_ms, glue->frame_time_ms);
+
+  lv_disp_remove(disp);
+  delete glue;
+  delete display;
+}
+
+int main(int argc, char* argv[]) {
+  run("async DMA, 16 bit panel", 1, 2);
+  run("async DMA, 18 bit panel", 1, 3);
+  run("framebuffer display, flush done on setAddrWindow", 2, 2);
+  run("renderer without flush done callback", 0, 2);
+  printf("%u checks, %u failures\n", checks, failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,56 @@
+/////////////////////////////////////////////////////////////////////
+// compressed by tools/unishox/compress-html-uncompressed.py
+/////////////////////////////////////////////////////////////////////
+
+const size_t HTTP_SCRIPT_CONSOL_SIZE = 1405;
+const char HTTP_SCRIPT_CONSOL_COMPRESSED[] PROGMEM = "\x33\xBF\xAF\x71\xF0\xE3\x3A\x8B\x44\x3E\x1C\x67\x51\x18\xA3\xA8\x2A\x2B\x1A\x7C"
+                             "\x3E\x84\x3A\x9F\x8F\x06\x05\xF0\x75\xB9\xCA\xC2\x3B\xA6\xD3\xBC\x7B\x4C\xEF\xEA"
+                             "\x8F\x8C\x71\xDD\x3E\xE8\xE4\x3E\xCE\xF1\xD4\x46\x0F\x87\x76\x8E\x9E\x0F\xF8\x10"
+                             "\x45\x58\x30\xFC\x3E\x7B\x8E\xF1\xE2\x8E\x86\x76\x10\xB6\x76\xCF\x87\x74\x10\xA3"
+                             "\x1D\x02\x7C\x3D\x42\x8E\xD1\xF6\x7F\x4D\xC7\xD9\xE6\x7D\x9F\x67\x78\xED\x9B\x4F"
+                             "\x1A\x60\xEE\x98\x3B\xC7\xB4\x11\xB1\x73\xE1\xC8\x4C\xE7\xCF\x05\xEE\x3E\x02\x34"
+                             "\xF3\xC1\xEE\x3D\xC0\x89\xAC\x84\x77\x46\x02\x0E\xB0\x19\xD5\x87\xC3\xEC\xFB\x3C"
+                             "\x06\x13\xBF\x95\x68\xD7\x82\xE8\xEE\x85\x47\x78\x12\x66\x98\xA3\xBC\x78\x04\x5E"
+                             "\x2A\x01\x4F\x1A\x60\xEE\xBF\x1F\x0F\x9C\x2C\x20\x8E\xF1\xED\x7E\x3E\x1C\x67\x82"
+                             "\xD3\x07\x76\x8C\x86\x3C\x30\x77\x49\x99\xBE\xA2\xF6\x0B\xF8\x6C\xEF\x1F\xC3\xE1"
+                             "\xF0\xF6\x0B\xE1\x19\x8D\xE6\x21\xEC\x3B\xC7\xB5\xF8\xF9\xCC\x7D\x02\x35\xF3\xBA"
+                             "\x7D\xB3\x37\xD5\xE3\xB4\x19\xF0\xE4\x3E\xCE\xF1\xE0\x9F\x8E\x99\xD8\x31\xF1\xF0"
+                             "\xEE\x9D\xE3\xE1\xF8\x7B\x41\x0F\x4D\x04\x1E\x14\x8F\x87\xD9\xF6\x78\x3D\xC7\x87"
+                             "\xE3\xA5\x88\x21\x33\x37\xD4\x41\x6F\xA9\xF3\xF9\xDD\x3E\xC2\x3E\xCE\xA6\x7C\x3F"
+                             "\x0F\x6E\x88\x7C\x67\x40\xAF\xD4\x4C\xCD\xF5\x16\x88\x78\xB0\x8E\xEB\x3A\x09\x75"
+                             "\x67\x78\xF0\x7B\x81\x0B\x3A\x7F\xFE\x7C\x10\x73\xBD\x30\x77\x5F\x8E\x9F\x76\x21"
+                             "\x91\x7A\xAE\x99\xF0\xF8\x72\x88\x10\xB8\x2B\x08\xEE\x9D\xE3\xC1\xEE\x3D\xC7\x83"
+                             "\xDC\x7B\xB4\xC1\xDD\x18\x7C\x3E\x1C\x87\x78\xF6\x90\x67\xC6\x38\xEE\x9F\x61\x9C"
+                             "\x87\xD9\xDE\x3C\x16\x1F\x0F\xB3\xF4\x19\xC8\x7C\x3E\xCE\xD9\x3E\x0F\x04\x64\x2C"
+                             "\xBE\x5A\x41\xE0\xD1\x99\xCF\xA8\xEE\x86\x08\x3C\x03\x9D\xE3\xC0\x21\x45\x3E\x1F"
+                             "\x67\xD9\xE0\x16\xF8\xF1\x61\x79\xAD\x30\x77\x5F\x8E\xF1\xED\xFB\xA1\x7F\xE4\x62"
+                             "\xC2\xF3\x3C\x1E\xED\x30\x09\x9C\xB4\x9E\xDD\x30\x77\x4D\x87\xF0\x10\xB8\xD7\x36"
+                             "\x1D\x2C\x76\x7E\x8E\xE9\xDE\x3C\x1E\xE3\x61\xF3\x98\xFA\x23\x61\x0D\x20\x88\x55"
+                             "\x50\xC2\xFB\x35\x0B\x7E\xA3\xBA\x77\x8F\x06\xC3\xA6\x77\xDD\x88\x65\xEA\xBA\x61"
+                             "\x8A\xBE\x1E\x60\x89\xC2\xC9\xB0\x12\x38\x58\x39\x87\xE8\xFD\x11\xB0\xE9\xEA\xBA"
+                             "\x17\xE3\xE1\xF0\xE5\x36\x77\x8F\x69\x02\x67\x2B\xE0\x91\xC0\x09\xE0\xF7\x19\xDF"
+                             "\xD1\xB4\xEA\x10\xF0\x21\xF0\xD8\x74\xFB\xF0\xCC\xEF\x32\xA6\x6C\xA3\xA7\x86\x05"
+                             "\xB4\x77\x4E\xC3\xDC\x72\x1D\x87\x78\xF0\x5A\x21\xF0\x43\xA7\x85\x69\x8A\x3B\xA7"
+                             "\x78\xF1\xA6\x0E\xE8\x22\x49\x3E\x1F\x0E\x33\xBC\x7B\x48\x10\xBA\x05\xA7\xC3\xEC"
+                             "\xFB\x3C\x1E\xE3\x68\x24\xE0\xA6\xD0\x42\xE8\x21\x1F\x80\x8B\x81\x9D\xB3\xE1\xB4"
+                             "\xF0\x7B\x81\x6B\x8A\xB0\xA8\xF9\xE7\x40\x89\xD0\x26\x3A\x82\xA1\xA7\x78\xF0\x7B"
+                             "\x8F\x71\xE0\xD8\x74\xC1\x8F\x8E\xE9\xF6\x43\xC4\xCA\x8F\xB3\xA8\xFB\x0F\xC7\x68"
+                             "\x33\x94\x7C\x3E\xCE\xD9\x68\x87\x6F\x0E\xAA\xF8\xB6\x77\x8F\x06\xC3\xA7\x9F\x08"
+                             "\x08\x3A\xC1\xFC\x7E\x3B\xC7\xB4\xC0\x25\x64\xC7\x28\x99\xCC\x3B\xC7\x83\xDC\x40"
+                             "\x89\xC8\x59\xFC\x7E\x3B\xC7\xB4\x14\x74\xA0\x49\xE4\x88\x7C\x23\xBA\x11\xDE\x3C"
+                             "\x19\xDF\xD0\xA0\xCF\x87\xBC\x7B\xE7\x50\x7C\x7C\x38\xC8\x11\x7A\x2C\x42\x8E\xE9"
+                             "\xDE\x3D\xA0\x87\xCD\xB8\x27\x74\x0D\x8D\x19\x90\x98\x3F\xC0\x83\xD0\x3C\x33\xBF"
+                             "\xA1\xC0\x89\xCF\x29\xD4\x19\xF1\x9D\x0D\x19\x91\x07\x82\x33\xC6\x98\x3B\xA7\x2F"
+                             "\xE7\xC3\xE1\x06\x7F\x8F\xF1\xCC\x67\xC3\xE1\x06\x77\x8F\x68\xE3\xA5\x8B\xAC\x0F"
+                             "\x06\x8C\x09\xD3\x3E\x1F\x78\x60\xC1\xF6\x78\x04\x6E\x02\x07\x1F\x0F\xC3\xDA\x38"
+                             "\xE8\x63\x03\x17\xE3\xBA\x77\x8F\x03\x8E\x9E\x74\x5E\x61\x30\xEB\x73\x8B\xF7\xC3"
+                             "\xCC\xEE\x9C\x84\xCE\x23\xAA\x13\x38\x8E\xF1\xEE\x3A\x99\xD4\x43\x8E\xF1\xEE\x39"
+                             "\x7F\x3E\x1F\x08\x33\xB4\x77\x4E\xD9\xDB\x0F\x8F\xC1\x41\x82\x17\x1F\x27\xE8\xFD"
+                             "\x1D\xD0\xF8\xF8\x08\x92\xCE\xF1\xD4\x38\x10\xB9\x2D\x14\x19\xEF\x07\xC7\x59\xC8"
+                             "\x7B\xE7\xF8\xFF\x1F\x67\xD9\xDE\x3C\xF1\x9F\x0F\x84\x19\xDA\x3B\xA7\x19\xF8\x75"
+                             "\x9D\x64\x1F\x02\x0E\x20\x71\x90\x29\xE1\x07\x25\x9F\x0F\x84\x19\xFA\x3F\x47\x74"
+                             "\x11\x33\x13\xF0\xE4\x47\xE8\xFD\x10\xA0\xCE\x83\x30\x61\xDD\x3B\xC7\x50\xA0\xCE"
+                             "\x82\xF8\x10\x79\x83\x04\x2C\x70\xEF\x1D\x41\xF1\xF0\xE3\x3B\xC7\xB8\xEF\x1E\x0F"
+                             "\x71\x0F\x84\x77\x45\x1D\xE3\xC1";
+
+#define  HTTP_SCRIPT_CONSOL       Decompress(HTTP_SCRIPT_CONSOL_COMPRESSED,HTTP_SCRIPT_CONSOL_SIZE).c_str()
\ No newline at end of file
@@ -2,23 +2,33 @@
 // compressed by tools/unishox/compress-html-uncompressed.py
 /////////////////////////////////////////////////////////////////////
 
-const size_t HTTP_SCRIPT_ROOT_SIZE = 434;
-const char HTTP_SCRIPT_ROOT_COMPRESSED[] PROGMEM = "\x30\x2F\x83\xAD\xCE\x41\x59\xDD\x18\x77\x8F\x6E\x98\x3B\xB4\x64\x31\xE1\x83\xBA"
-                             "\x4C\xCD\xF5\x17\xB0\x5F\xC3\x67\x78\xFE\x1F\x0F\x87\xB0\x5F\x08\xCC\x6F\x31\x0F"
-                             "\x61\xDE\x3D\xA6\x77\xF4\xCF\x9C\xC7\xD0\x23\x60\x47\x74\xFB\x3B\x43\x4F\x87\x21"
-                             "\xF6\x77\x8F\x04\xCE\x99\xC3\x5F\xBD\x63\xCC\xF8\xCC\xDF\x51\xF0\xFC\x3D\xAC\x71"
-                             "\xDD\x3E\xC2\x39\x0F\xB3\xBC\x74\x2D\xEE\x7F\x21\x45\x44\x34\x82\x04\x1A\xE7\x41"
-                             "\x2E\xAC\xE9\xF6\x30\x2B\x0D\x9D\xD3\xB0\xF6\xD1\xEE\x3B\x07\x8E\xA3\xD8\x7A\x55"
-                             "\x8E\x09\xAF\x51\x90\x4C\xF8\x7D\x8F\xE8\x94\x28\xF3\x39\x1B\x3E\x8F\xA3\xEC\xFC"
-                             "\x3D\x87\x78\x81\x1B\x0A\xF0\x21\x61\x5F\x3F\x0F\x4A\x14\x09\x35\xC6\x82\x0D\x73"
-                             "\xB2\x85\x1F\x87\xA5\x08\x09\x39\x39\xCA\x64\x30\xD8\x78\x1F\x15\xB4\xCE\xBF\x0C"
-                             "\xB0\xD9\xE7\xD8\x3F\xFB\x18\x09\x59\xCB\x04\x3C\x78\x43\xF0\xF4\x3B\x2B\xE7\xE1"
-                             "\xEC\x3B\xC7\x83\xDC\x7B\xAC\xF8\x30\xFF\x1F\xE3\xEC\xFB\x3C\x06\x13\xBF\x95\x68"
-                             "\xD7\x82\xE8\xEE\x85\x47\x78\xF1\xA6\x0E\xE9\xB0\xFE\x1F\x38\x58\x41\x1D\xE3\xDA"
-                             "\x6C\x3A\x58\xEC\xFD\x1D\xD3\xBC\x7B\x8D\x87\xCE\x63\xE8\x8D\x84\x34\x82\x21\x55"
-                             "\x43\x0B\xEC\xD4\x2D\xFA\x8E\xE9\xDE\x3C\x1B\x0E\x98\x31\xF1\xDD\x3E\xC8\x78\x99"
-                             "\x51\xF6\x75\x1F\x67\x43\xB4\x34\xF8\x72\x1F\x67\x6C\xAC\xEA\xAF\x8B\x67\x78\xF0"
-                             "\x6C\x3A\x79\xF0\x87\x74\xEF\x1E\x02\xA3\xE7\x9D\x02\x26\x83\x67\x51\xCA\x26\x73"
-                             "\x0E\xF1\xE0\xF7\x1B";
+const size_t HTTP_SCRIPT_ROOT_SIZE = 752;
+const char HTTP_SCRIPT_ROOT_COMPRESSED[] PROGMEM = "\x33\xBF\xA3\x14\x75\x3F\x1E\x0C\x0B\xE0\xEB\x73\x90\x5E\x3B\xBE\x3B\xC7\xB5\x8E"
+                             "\x3B\xA7\xD8\x47\x21\xF6\x77\x8E\x85\xBD\xCF\xE4\x28\xA8\x86\x90\x47\xCF\x1D\x3E"
+                             "\xC6\x05\x61\xB3\xBA\x76\x1E\xDA\x3D\xC7\x60\xF1\xD4\x7B\x0F\x4A\xB1\xC1\x35\xEA"
+                             "\x32\x09\x9F\x0F\xB1\xFD\x12\x85\x1E\x67\x23\x67\xD1\xF4\x7D\x9F\x87\xB0\xEF\x10"
+                             "\x23\x61\x5E\x04\x2C\x2B\xE7\xE1\xE9\x42\x81\x26\xB8\xD0\x41\xAE\x76\x50\xA3\xF0"
+                             "\xF4\xA1\x01\x27\x27\x39\x4C\x86\x1B\x0F\x03\xE2\xB6\x99\xD7\xE1\x96\x1B\x3C\xFB"
+                             "\x07\xFF\x63\x01\x2B\x39\x60\x87\x8F\x08\x7E\x1E\x87\x65\x7C\xFC\x3D\x87\x78\xF0"
+                             "\x7B\x81\x17\x82\x9B\x3B\xA3\x0E\xF1\xED\xB3\xE0\xC3\xFC\x7F\x8F\xB3\xEC\xF0\x18"
+                             "\x4E\xFE\x55\xA3\x5E\x0B\xA3\xBA\x62\x8E\xF0\x24\xCD\x0A\x8E\xF1\xE3\x4C\x1D\xD3"
+                             "\xF9\x67\xE8\xFD\x3F\x1F\xC3\xE1\xF0\xE3\x3B\xC7\xB4\xB4\xC1\xDD\x7E\x3E\x1F\x38"
+                             "\x58\x41\x1D\xE3\xDB\xA6\x0E\xED\x19\x0C\x78\x60\xEE\x93\x33\x7D\x45\xEC\x17\xF0"
+                             "\xD9\xDE\x3F\x87\xC3\xE1\xEC\x17\xC2\x33\x1B\xCC\x43\xD8\x77\x8F\x6B\xF1\xF3\x98"
+                             "\xFA\x04\x6B\xE7\x74\xFB\x66\x6F\xAB\xC7\xD9\xDE\x3C\x3F\x1D\x2C\x41\x09\x99\xBE"
+                             "\xA2\x0B\x7D\x4F\x9F\xCE\xE9\xF7\xE3\xEC\xEA\x67\xC3\xF0\x2F\x1D\xD6\x74\x12\xEA"
+                             "\xCE\xF1\xDE\x3C\x3F\x1D\x33\x9F\xFF\x9F\x3E\x1D\xD3\xBC\x7C\x3F\x01\x07\x63\x3A"
+                             "\x7D\xD8\x86\x45\xEA\xBA\x67\xC3\xE1\xCA\x3B\xC7\xB4\x9F\x8F\x87\x19\xE0\x82\xB3"
+                             "\xBA\x77\x8F\x07\xB8\xF7\x1E\x3E\xE8\x5F\xF8\xF0\x7B\x9F\x8F\x87\x19\xE0\xF7\x13"
+                             "\x0B\xCC\xF6\x82\x1C\xF3\xDD\xA6\x0E\xE9\xB0\xFE\x02\x17\x04\x06\xC3\xA5\x8E\xCF"
+                             "\xD1\xDD\x3B\xC7\xB8\xD8\x7C\xE6\x3E\x88\xD8\x43\x48\x22\x15\x54\x30\xBE\xCD\x42"
+                             "\xDF\xA8\xEE\x9D\xE3\xC1\xB0\xE9\x9D\xF7\x62\x19\x7A\xAE\x98\x62\xAF\x87\x98\x22"
+                             "\x6C\x26\xC0\x48\xD8\x0E\x61\xFA\x3F\x44\x6C\x3A\x7A\xAE\x85\xF8\xF8\x7C\x39\x4D"
+                             "\x9D\xE3\xDA\x41\x78\xEE\x9B\x0E\x9F\x7E\x19\x9D\xE6\x54\xCD\x80\x97\xC5\xF0\x29"
+                             "\xF1\x9E\xFC\x7C\x3E\x1F\x0E\x33\xBC\x7B\x48\x2A\x2B\x3E\x79\xD0\x22\x59\xB3\xA8"
+                             "\xFA\x10\xEF\x1E\x0F\x71\xEE\x3D\xC7\x83\x61\xD3\x06\x3E\x3B\xA7\xD9\x0F\x13\x2A"
+                             "\x2B\x3E\xCE\xA3\xEC\xE8\x76\x86\x9F\x0E\x43\xEC\xED\x95\x9D\x55\xF1\x6C\xEF\x1E"
+                             "\x0D\x87\x4F\x3E\x10\xEE\x82\x46\x4C\x60\x12\xF2\x63\x94\x4C\xE6\x1D\xE3\xC1\xEE"
+                             "\x3D\xC6";
 
 #define  HTTP_SCRIPT_ROOT       Decompress(HTTP_SCRIPT_ROOT_COMPRESSED,HTTP_SCRIPT_ROOT_SIZE).c_str()
\ No newline at end of file
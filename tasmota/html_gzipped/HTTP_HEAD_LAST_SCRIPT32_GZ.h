@@ -0,0 +1,33 @@
+/////////////////////////////////////////////////////////////////////
+// gzipped by tools/html-gzip/gzip-html-static.py
+/////////////////////////////////////////////////////////////////////
+
+const size_t HTTP_HEAD_LAST_SCRIPT32_GZ_SIZE = 531;
+#define      HTTP_HEAD_LAST_SCRIPT32_GZ_ETAG "d0e386a2"
+const char HTTP_HEAD_LAST_SCRIPT32_GZ[] PROGMEM = "\x1F\x8B\x08\x00\x00\x00\x00\x00\x02\x03\x8D\x92\x51\x6B\xDB\x30\x14\x85\xFF\x4A"
+                                                  "\xF6\x62\x49\xD4\x78\x6E\x56\xC6\x56\xA3\x86\x0C\xBA\xED\x61\x7B\x69\x33\x18\x84"
+                                                  "\x3C\xC8\xF6\x75\xA3\x4E\x91\x3D\xE9\x6A\xB1\x09\xF9\xEF\xBD\x56\x92\x76\xAC\xDB"
+                                                  "\x28\x06\x63\x7C\x8F\xBE\x7B\xCE\xB1\x9B\x60\x2B\xD4\xAD\x9D\xDC\xD7\x5C\xEC\x7E"
+                                                  "\x29\x37\x41\x99\xA7\x5A\xD6\x6D\x15\x36\x60\x31\xFB\x19\xC0\x0D\xB7\x60\xA0\xC2"
+                                                  "\xD6\xCD\x8D\xE1\x4C\xDB\x2E\x60\x5A\x06\xC4\xD6\xA6\x08\x3D\x2A\x07\x2A\xF5\x51"
+                                                  "\xC2\x44\xB1\x5D\x6B\x03\x5C\x67\x06\xEC\x1D\xAE\xAF\x24\x8A\x9D\x6E\xB8\x5E\xE2"
+                                                  "\x8A\x1E\xE8\xBE\x64\x56\x6D\x80\xAD\x64\x7C\x97\xAD\x95\x9F\x23\x3A\x4D\x3C\x20"
+                                                  "\x76\xCD\x44\x92\xF0\x57\x7F\x19\xC5\x53\x42\x88\xD9\x01\x42\xCA\xD5\xE5\xEF\xBC"
+                                                  "\x62\x8F\x67\x67\xC5\x7E\xDF\x9C\x12\xF9\x86\xFB\x17\x46\xCA\xD6\xCD\x0B\x9C\x67"
+                                                  "\x1E\x07\x03\x59\xAD\x7D\x67\xD4\x20\xFD\x8C\x95\xA6\xAD\x7E\xB0\x4B\x66\x5B\x0B"
+                                                  "\xEC\x64\x60\x6B\xF8\x7D\x2D\x8A\x27\x1F\x81\x13\x09\x4A\xCE\x9A\x37\x4C\xFC\x01"
+                                                  "\x39\x1E\x8D\xD3\xE9\xF3\xE9\x61\x41\x81\x59\xD3\xBA\x4D\xE6\x43\xB9\xD1\xC8\x45"
+                                                  "\xF1\x14\x32\x74\x66\xA4\x8F\x29\xBD\x91\x07\xDD\x92\x85\x29\x5B\x65\x0D\xA5\xF1"
+                                                  "\xCB\x9C\x6C\x1B\x5D\x01\xCF\xD3\x73\x51\x8C\x3A\x57\x4B\x0B\xDB\xC9\x47\x1A\xDF"
+                                                  "\x80\xAA\xC1\x11\xD0\xD5\x59\x6B\x4D\xAB\x6A\xC9\x85\xBC\x8A\xB8\xB2\x8C\xB2\x6F"
+                                                  "\xDA\xE2\xBB\xB9\x73\x6A\xE0\x24\x72\xE0\x83\x41\x51\x50\x2F\x65\x79\x2C\x4A\xCA"
+                                                  "\xF3\x24\x29\x4B\xDA\x24\x65\xDE\x5F\xBF\x17\xBB\xA6\x42\x32\x55\xEC\xC1\x78\xD8"
+                                                  "\x3D\xF3\x4E\x57\x24\xA9\x7A\xEE\x23\xF8\x43\x68\x1A\x72\xE1\x0D\xF9\x00\x0C\xCE"
+                                                  "\x4E\x1A\x45\x27\x49\xF7\x18\xF3\x40\x8C\xBE\xFA\x68\xEB\xFB\xD7\x2F\x9F\x11\xBB"
+                                                  "\x1B\xA0\x8F\xE9\x47\x6C\x9F\xB5\x1D\x58\xCE\x3E\x5D\x2F\x58\xCA\x5E\x87\x8B\x59"
+                                                  "\xB8\x90\x74\x2C\x51\x9D\x96\x2C\x45\x17\x20\x8A\xEC\xB8\x78\xF0\xA8\x10\xAA\xB5"
+                                                  "\xB2\x77\x70\x48\x4C\x81\xFA\xE8\x69\xB8\x1D\x47\x52\x5E\x24\x49\x9F\x8D\xB2\xE0"
+                                                  "\xA5\x9C\xE6\xF9\xB1\x63\x39\xAA\x7C\xD7\x5A\x0F\x0B\xFA\xF5\xC7\x22\x68\xCE\xA2"
+                                                  "\x61\x26\x3C\xE0\x42\x6F\xA0\x0D\xC8\x23\xF5\x54\x44\xFA\x36\x27\xC2\x49\x3C\x7A"
+                                                  "\x21\x6D\x78\xEC\x68\xF2\xFF\xED\xB4\xFB\x9F\xE0\x69\x04\x8F\x9D\x92\x1E\x6C\x3D"
+                                                  "\x16\xFC\x00\xA2\x86\xE3\xD0\xD4\x03\x00\x00";
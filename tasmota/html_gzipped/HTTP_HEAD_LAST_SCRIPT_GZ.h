@@ -0,0 +1,17 @@
+/////////////////////////////////////////////////////////////////////
+// gzipped by tools/html-gzip/gzip-html-static.py
+/////////////////////////////////////////////////////////////////////
+
+const size_t HTTP_HEAD_LAST_SCRIPT_GZ_SIZE = 218;
+#define      HTTP_HEAD_LAST_SCRIPT_GZ_ETAG "f788114f"
+const char HTTP_HEAD_LAST_SCRIPT_GZ[] PROGMEM = "\x1F\x8B\x08\x00\x00\x00\x00\x00\x02\x03\x8D\x8F\xC1\x6E\x02\x31\x0C\x44\x7F\x85"
+                                                "\x5E\x48\x22\x56\x51\xCF\xAC\x52\xC4\x37\x70\x44\x7B\x08\x1B\xA7\x6B\x1A\x1C\x48"
+                                                "\x1C\xE8\x0A\xED\xBF\x37\x5A\x84\xC4\xA1\x07\x2E\x96\xE5\x19\x3F\xCD\xF8\x42\x3D"
+                                                "\x63\xA4\xC5\xD1\x49\x75\xBF\xDA\xB4\x60\xF3\xD9\xA0\x71\xB1\x2F\x27\x20\xD6\x97"
+                                                "\x02\x69\xDC\x41\x80\x9E\x63\xDA\x86\x20\x05\xD2\xB9\x70\x73\x28\xCC\x91\x1A\x86"
+                                                "\x5F\xB6\x09\x6C\x93\x67\x8B\x50\xED\x6D\xC0\x00\x12\x75\x00\xFA\xE6\xE1\xCB\xB0"
+                                                "\xBA\xA3\x97\xB8\xE7\xAE\x2E\x75\xEE\x05\xD9\x13\x88\xCE\xCC\x37\x3D\xD8\xBC\x65"
+                                                "\x4E\x58\x79\x50\xD9\x4E\xA8\xE5\x52\x7E\xFC\x23\xCD\x5F\x4A\xA9\xCD\x03\x52\x9D"
+                                                "\xDD\xFA\x95\xD7\x4E\xBC\x5A\xB5\xD3\xE4\x9F\x8D\xB2\x97\xF9\xCD\x4A\x7A\xF0\x6F"
+                                                "\x24\xD7\x99\xC7\x00\xDA\x61\x3E\x07\x3B\x9A\xBC\x11\x87\x10\xFB\x1F\xB1\x16\x14"
+                                                "\x09\xC4\x33\xC0\x2D\xC8\xA3\x53\xED\x1F\x4F\x11\x88\xF7\x5A\x01\x00\x00";
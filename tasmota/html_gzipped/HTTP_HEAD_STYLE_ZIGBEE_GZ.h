@@ -0,0 +1,18 @@
+/////////////////////////////////////////////////////////////////////
+// gzipped by tools/html-gzip/gzip-html-static.py
+/////////////////////////////////////////////////////////////////////
+
+const size_t HTTP_HEAD_STYLE_ZIGBEE_GZ_SIZE = 228;
+#define      HTTP_HEAD_STYLE_ZIGBEE_GZ_ETAG "e515a7ae"
+const char HTTP_HEAD_STYLE_ZIGBEE_GZ[] PROGMEM = "\x1F\x8B\x08\x00\x00\x00\x00\x00\x02\x03\x85\x90\xC1\x4E\xC3\x30\x10\x44\x7F\x05"
+                                                 "\xF5\x04\x52\x5D\x91\x52\x71\x58\x1F\xF9\x12\x3B\xDE\x24\xAB\x1A\x6F\xB4\xDE\x94"
+                                                 "\x42\xC4\xBF\xB3\x4D\xDA\x0A\x4E\xDC\x46\x63\x7B\xE6\x8D\x77\x51\xE7\xC8\x67\x57"
+                                                 "\xE9\x8B\x4A\x0F\x91\x25\xA1\x38\x73\xFC\xC8\x95\x94\xB8\x80\x60\x0E\x4A\x27\xF4"
+                                                 "\x89\xEA\x98\xC3\x27\x50\xC9\x54\xD0\xC5\xCC\xED\xD1\x7F\x50\xD2\x01\xF6\xCF\xE3"
+                                                 "\xD9\x0F\x48\xFD\xA0\xD0\xEC\x4D\xAF\x41\x60\xF2\xA1\x72\xA6\x74\x35\x9C\x84\x44"
+                                                 "\x53\x85\x17\xBB\xF2\x1E\xA4\xA7\xE2\x32\x76\x0A\xCE\x8C\xEF\x5D\x54\x80\xD0\x29"
+                                                 "\xCA\x76\x91\x11\x3B\x16\x9C\x5B\x2E\x8A\x45\x61\xB3\xB9\x13\xAC\xD5\xFF\x70\x87"
+                                                 "\x68\xCD\x93\xE2\x8D\xEB\xF5\x82\x15\xDA\x63\x2F\x3C\x95\x04\xED\x24\x62\xB1\x6F"
+                                                 "\x9C\x59\xBC\xF2\x08\xCD\x0D\xE1\xDA\x2B\xCB\x2B\x77\xB8\xAF\xF9\x0D\xBF\xCE\x3E"
+                                                 "\xFC\xA1\x9E\x57\xF3\x14\xE4\xD1\xD9\xEF\x6C\x1B\x3B\x7E\xF2\xCB\xBE\x4B\xF6\x0F"
+                                                 "\xAE\xA7\x15\xE5\x6B\x01\x00\x00";
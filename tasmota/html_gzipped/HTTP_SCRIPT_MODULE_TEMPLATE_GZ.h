@@ -0,0 +1,26 @@
+/////////////////////////////////////////////////////////////////////
+// gzipped by tools/html-gzip/gzip-html-static.py
+/////////////////////////////////////////////////////////////////////
+
+const size_t HTTP_SCRIPT_MODULE_TEMPLATE_GZ_SIZE = 387;
+#define      HTTP_SCRIPT_MODULE_TEMPLATE_GZ_ETAG "5ad88225"
+const char HTTP_SCRIPT_MODULE_TEMPLATE_GZ[] PROGMEM = "\x1F\x8B\x08\x00\x00\x00\x00\x00\x02\x03\x5D\x51\xCB\x4E\xC3\x30\x10\xFC\x95\xAA"
+                                                      "\x48\xD8\x56\x5C\x37\x01\x71\xA0\xAE\xCB\x01\x21\x71\x00\x4E\xDC\x10\x87\x3C\x36"
+                                                      "\xC9\x0A\x63\xA7\xB1\x13\x81\xA2\xFE\x3B\x4E\x52\xA0\x70\xF4\xEC\x78\x66\x76\xB6"
+                                                      "\x4F\xDB\x85\x75\xBC\x76\xB2\xEC\x4C\xEE\xD1\x9A\x45\x0E\x14\xF9\x9E\x0D\xFD\x38"
+                                                      "\x52\x85\xCD\xBB\x77\x30\x5E\xE4\x2D\xA4\x1E\xEE\x34\x8C\x2F\x4A\x6C\x33\x92\x09"
+                                                      "\x93\x56\x78\xF8\xF0\xB7\xD6\xF8\x80\x2B\x94\x7B\x91\x36\x0D\x98\xE2\xB6\x46\x5D"
+                                                      "\x50\xCB\xE4\xE1\x47\xD9\x7A\x5A\x71\x37\x2B\xA7\xCA\x9D\xC7\x1F\x65\x09\x31\xCF"
+                                                      "\x54\xCC\x73\xDE\x70\xCD\xBD\xDA\x3B\x4A\xCE\x6A\x12\x55\x8C\x77\x13\x23\x8E\x93"
+                                                      "\x52\x6A\xE5\xC5\x6C\xE8\x84\x06\x53\xF9\x5A\x96\xB6\xA5\xA8\xB4\x44\x89\xAB\x15"
+                                                      "\x1B\x9A\x5F\xC6\x0B\xAE\x92\x57\xD1\xA4\x6D\xC8\xF3\x64\x0B\x90\x8D\x68\xE1\xDD"
+                                                      "\xF6\x30\x27\xFA\xCB\x0B\xF1\xB4\xAA\xFF\xA9\xC6\x12\xB7\x41\x39\x8A\xD8\x90\x87"
+                                                      "\xE1\x0B\xBE\x1E\xA3\x4A\x2C\x69\xAA\x54\xCE\x86\xEC\x07\x9F\x02\x66\xA1\x9C\x37"
+                                                      "\x79\x38\xB8\xDD\x4E\x5D\x1D\x55\x92\xA0\xA2\xB2\xA3\x0C\x50\x8A\xDB\x24\x66\x37"
+                                                      "\x94\x2C\x48\x84\x6C\x83\xDC\x07\x6F\xC8\x28\x99\xB6\x15\x7D\xAA\x3B\x50\x5D\x94"
+                                                      "\x48\x2F\x9C\xFF\xD4\x20\x7A\x74\x98\xA1\x46\xFF\xA9\x68\xB6\x0B\x5F\x09\xD9\x90"
+                                                      "\x1A\x8B\x02\x0C\x39\x29\xD5\xBD\x51\xC7\xAB\xEF\x73\x59\x17\x96\x6D\x74\x1A\x0C"
+                                                      "\xD7\x87\x8B\x75\xC5\x97\xDB\x79\xDD\xC5\x6C\x40\x96\xEC\x84\x70\x39\x11\xD6\x33"
+                                                      "\x63\xB7\x64\x72\xCC\x53\x4D\x79\xD0\x18\x68\xEF\x9F\x1F\x1F\x94\x3D\x41\x67\x11"
+                                                      "\x5A\x6D\xAF\xAF\xD9\xCD\xF7\x01\x37\x6E\xEC\x65\xC2\x86\xE3\x89\x43\x15\x5F\x25"
+                                                      "\x82\xD8\x5A\x5A\x02\x00\x00";
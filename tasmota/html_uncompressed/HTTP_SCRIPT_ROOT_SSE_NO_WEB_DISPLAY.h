@@ -1,20 +1,38 @@
 const char HTTP_SCRIPT_ROOT[] PROGMEM =
+  "var ft,es;"                            // es = EventSource, 0 if not available
+  "function ls(s){"
+    "eb('l1').innerHTML=s.replace(/{t}/g,\"<table style='width:100%%'>\")"
+                        ".replace(/{s}/g,\"<tr><th>\")"
+//                        ".replace(/{m}/g,\"</th><td>\")"
+                        ".replace(/{m}/g,\"</th><td style='width:20px;white-space:nowrap'>\")"  // I want a right justified column with left justified text
+                        ".replace(/{e}/g,\"</td></tr>\");"
+  "}"
   "function la(p){"
-    "if(typeof(EventSource)!==\"undefined\"){"
-      "var e=new EventSource('?m=1');"
-      "e.onmessage=event=>{"
-        "eb('l1').innerHTML=event.data.replace(/{t}/g,\"<table style='width:100%%'>\")"
-                                     ".replace(/{s}/g,\"<tr><th>\")"
-    //                                 ".replace(/{m}/g,\"</th><td>\")"
-                                     ".replace(/{m}/g,\"</th><td style='width:20px;white-space:nowrap'>\")"  // I want a right justified column with left justified text
-                                     ".replace(/{e}/g,\"</td></tr>\");"
+    "a=p||'';"
+    "clearTimeout(ft);clearTimeout(lt);"
+    "if(!a&&es!==0){"                     // Status is pushed by /events
+      "if(es==null){"
+        "if(typeof(EventSource)!==\"undefined\"){"
+          "es=new EventSource('events');"
+          "es.addEventListener('s',e=>ls(e.data));"
+          "es.onerror=()=>{if(es.readyState==2){es=0;la();}};"  // Refused by the device, fall back to polling
+          "return;"
+        "}"
+        "es=0;"
+      "}else{"
+        "return;"
       "}"
     "}"
-    "a=p||'';"
-    "clearTimeout(lt);"
     "if(x!=null){x.abort()}"             // Abort if no response within 2 seconds (happens on restart 1)
     "x=new XMLHttpRequest();"
+    "x.onreadystatechange=()=>{"
+      "if(x.readyState==4&&x.status==200){"
+        "ls(x.responseText);"
+        "clearTimeout(ft);clearTimeout(lt);"
+        "if(es===0){lt=setTimeout(la,%d);}"   // Settings.web_refresh
+      "}"
+    "};"
     "x.open('GET','.?m=1'+a,true);"      // ?m related to Webserver->hasArg("m")
     "x.send();"
-    "lt=setTimeout(la,2e4);"             // 20s failure timeout
+    "if(es===0){ft=setTimeout(la,2e4);}"  // 20s failure timeout
   "}";
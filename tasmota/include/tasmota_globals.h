@@ -105,6 +105,10 @@ String EthernetMacAddress(void);
  * Start ESP32 specific parameters - disable features not present in ESP32
 \*-------------------------------------------------------------------------------------------*/
 
+#ifdef USE_SETTINGS_JOURNAL
+#undef USE_SETTINGS_JOURNAL                        // ESP32 settings are stored in NVS which does its own wear leveling
+#endif
+
 #if CONFIG_IDF_TARGET_ESP32
 
 #ifdef CORE32SOLO1
@@ -555,6 +559,14 @@ bool first_device_group_is_local = true;
 #define PROFILE_FUNCTION(DRIVER, INDEX, FUNCTION, START)
 #endif  // USE_PROFILE_DRIVER
 
+#ifdef USE_PROFILE_STATS
+#define PROFILE_STATS_START(START) uint32_t START = (ProfileStats.stats) ? (micros() | 1) : 0
+#define PROFILE_STATS(TYPE, INDEX, FUNCTION, START) if (START) { ProfileStatsAdd(TYPE, INDEX, FUNCTION, START); }
+#else
+#define PROFILE_STATS_START(START)
+#define PROFILE_STATS(TYPE, INDEX, FUNCTION, START)
+#endif  // USE_PROFILE_STATS
+
 /*********************************************************************************************\
  * Macro for SetOption synonyms
  *
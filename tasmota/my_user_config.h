@@ -62,6 +62,7 @@
 
 #define SAVE_DATA              1                 // [SaveData] Save changed parameters to Flash (0 = disable, 1 - 3600 seconds)
 #define SAVE_STATE             true              // [SetOption0] Save changed power state to Flash (false = disable, true = enable)
+//#define USE_SETTINGS_JOURNAL                   // Save small changes as journal records in the first rotating flash page and compact when full (ESP8266 only, +1k code)
 #define BOOT_LOOP_OFFSET       1                 // [SetOption36] Number of boot loops before starting restoring defaults (0 = disable, 1..200 = boot loops offset)
 
 // -- Wi-Fi ---------------------------------------
@@ -179,6 +180,10 @@
 #define MQTT_TUYA_RECEIVED     false             // [SetOption66] Enable TuyaMcuReceived messages over Mqtt
 #define MQTT_TLS_ENABLED       false             // [SetOption103] Enable TLS mode (requires TLS version)
 #define MQTT_TLS_FINGERPRINT   false             // [SetOption132] Force TLS fingerprint validation instead of CA (requires TLS version)
+//#define USE_MQTT_QUEUE                           // Queue outbound MQTT messages, coalesce retained and STATE/SENSOR topics and send them batched from the main loop (+1k5 code)
+  #define MQTT_QUEUE_SIZE      16                // Max number of queued messages
+  #define MQTT_QUEUE_MEMORY    4096              // Max number of bytes used by queued topics and payloads
+  #define MQTT_QUEUE_BUDGET    5                 // Max number of milliseconds per loop used to send queued messages
 
 // -- HTTP ----------------------------------------
 #define WEB_SERVER             2                 // [WebServer] Web server (0 = Off, 1 = Start as User, 2 = Start as Admin)
@@ -1032,6 +1037,10 @@
 #define USE_ADC                                  // Add support for ADC on GPIO32 to GPIO39
 
 #define USE_NETWORK_LIGHT_SCHEMES                // Add support for light schemes via DDP (via UDP on port 4048)
+//  #define USE_NETWORK_LIGHT_E131                 // Add support for E1.31 (sACN) unicast on UDP port 5568 to DDP scheme
+//  #define USE_NETWORK_LIGHT_ARTNET               // Add support for Art-Net on UDP port 6454 to DDP scheme, if E1.31 is not used
+//  #define NETWORK_LIGHT_UNIVERSE  1              // First E1.31 or Art-Net universe
+//  #define NETWORK_LIGHT_MAX_SLEEP 10             // Max sleep in ms while the DDP scheme receives, frames are shown as they arrive
 
 //#define USE_SPI                                  // Add support for hardware SPI
 //#define USE_MI_ESP32                             // Add support for ESP32 as a BLE-bridge (+9k2 mem, +292k flash)
@@ -1120,6 +1129,8 @@
 //#define PROFILE_THRESHOLD            70          // Minimum duration in milliseconds to start logging
 //#define USE_PROFILE_DRIVER                       // Enable driver profiling
 //#define USE_PROFILE_FUNCTION                     // Enable driver function profiling
+//#define USE_PROFILE_STATS                        // Enable command Profile and web page /prf with per driver and function latency histograms (+2k code, RAM only when started)
+//  #define PROFILE_STATS_MIN_US      50           // Minimum duration in microseconds for a driver function to be recorded
 
 /*********************************************************************************************\
  * Optional firmware configurations
@@ -233,7 +233,8 @@ struct TasmotaGlobal_t {
   uint32_t blink_timer;                     // Power cycle timer
   uint32_t backlog_timer;                   // Timer for next command in backlog
   uint32_t loop_load_avg;                   // Indicative loop load average
-  uint32_t log_buffer_pointer;              // Index in log buffer
+  uint32_t log_buffer_pointer;              // Log buffer write position (lap << 16 | offset)
+  uint32_t log_buffer_tail;                 // Log buffer oldest log line position
   uint32_t uptime;                          // Counting every second until 4294967295 = 130 year
   uint32_t zc_time;                         // Zero-cross moment (microseconds)
   uint32_t zc_offset;                       // Zero cross moment offset due to monitoring chip processing (microseconds)
@@ -596,6 +597,7 @@ void setup(void) {
     s++;
   }
   snprintf_P(TasmotaGlobal.mqtt_topic, sizeof(TasmotaGlobal.mqtt_topic), ResolveToken(TasmotaGlobal.mqtt_topic).c_str());
+  TopicCacheReset();                                                 // Hostname and MQTT client are part of cached topics
 
   RtcInit();
   GpioInit();
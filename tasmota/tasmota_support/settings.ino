@@ -164,7 +164,7 @@ bool RtcRebootValid(void) {
  *                                      Next 32k is overwritten by OTA
  * 0x000F3000  0x000F6000  0x000F6000 - 4k Tasmota Quick Power Cycle counter (SETTINGS_LOCATION - CFG_ROTATES) - First four bytes only
  * 0x000F3FFF  0x000F6FFF  0x000F6FFF
- * 0x000F4000  0x000F7000  0x000F7000 - 4k First Tasmota rotating settings page
+ * 0x000F4000  0x000F7000  0x000F7000 - 4k First Tasmota rotating settings page = Settings journal page if USE_SETTINGS_JOURNAL
  *    ::::
  * 0x000FA000  0x000FD000  0x000FD000 - 4k Last Tasmota rotating settings page = Last page used by Core OTA (SETTINGS_LOCATION)
  * 0x000FAFFF  0x000FDFFF  0x000FDFFF
@@ -216,7 +216,8 @@ uint32_t SETTINGS_LOCATION = EEPROM_LOCATION;
 const uint8_t CFG_ROTATES = 7;      // Number of flash sectors used (handles uploads)
 
 uint32_t settings_location = EEPROM_LOCATION;
-uint32_t settings_crc32 = 0;
+uint32_t settings_flash_erases = 0;   // Flash sectors erased by settings save since restart
+uint32_t settings_flash_writes = 0;   // Flash writes by settings save since restart
 uint8_t *settings_buffer = nullptr;
 uint8_t config_xor_on_set = CONFIG_FILE_XOR;
 
@@ -474,6 +475,7 @@ bool SettingsConfigRestore(void) {
   if (valid_settings) {
     SettingsDefaultSet2();
     memcpy((char*)Settings +16, settings_buffer +16, config_len -16);
+    SettingsTextIndexReset();
     Settings->version = buffer_version;  // Restore version and auto upgrade after restart
   }
 
@@ -486,12 +488,28 @@ bool SettingsConfigRestore(void) {
  * Config Settings->text char array support
 \*********************************************************************************************/
 
-uint32_t GetSettingsTextLen(void) {
+uint16_t settings_text_index[SET_MAX];      // Offset of each text in Settings->text_pool
+bool settings_text_index_valid = false;
+
+// Invalidate the text offsets after Settings->text_pool has been replaced as a whole
+void SettingsTextIndexReset(void) {
+  settings_text_index_valid = false;
+  TopicCacheReset();
+}
+
+void SettingsTextIndexBuild(void) {
   char* position = Settings->text_pool;
-  for (uint32_t size = 0; size < SET_MAX; size++) {
+  for (uint32_t index = 0; index < SET_MAX; index++) {
+    settings_text_index[index] = position - Settings->text_pool;
     while (*position++ != '\0') { }
   }
-  return position - Settings->text_pool;
+  settings_text_index_valid = true;
+}
+
+uint32_t GetSettingsTextLen(void) {
+  if (!settings_text_index_valid) { SettingsTextIndexBuild(); }
+  uint32_t last = settings_text_index[SET_MAX -1];
+  return last + strlen(Settings->text_pool + last) +1;
 }
 
 bool settings_text_mutex = false;
@@ -516,22 +534,10 @@ bool SettingsUpdateText(uint32_t index, const char* replace_me) {
   uint32_t replace_len = strlen_P(replace_me);
   char replace[replace_len +1];
   memcpy_P(replace, replace_me, sizeof(replace));
-  uint32_t index_save = index;
 
-  uint32_t start_pos = 0;
-  uint32_t end_pos = 0;
-  char* position = Settings->text_pool;
-  for (uint32_t size = 0; size < SET_MAX; size++) {
-    while (*position++ != '\0') { }
-    if (1 == index) {
-      start_pos = position - Settings->text_pool;
-    }
-    else if (0 == index) {
-      end_pos = position - Settings->text_pool -1;
-    }
-    index--;
-  }
-  uint32_t char_len = position - Settings->text_pool;
+  uint32_t char_len = GetSettingsTextLen();        // Builds text offsets if needed
+  uint32_t start_pos = settings_text_index[index];
+  uint32_t end_pos = start_pos + strlen(Settings->text_pool + start_pos);
 
   uint32_t current_len = end_pos - start_pos;
   int diff = replace_len - current_len;
@@ -558,12 +564,19 @@ bool SettingsUpdateText(uint32_t index, const char* replace_me) {
     memmove_P(Settings->text_pool + start_pos, replace, replace_len);
     // Fill for future use
     memset(Settings->text_pool + char_len + diff, 0x00, settings_text_size - char_len - diff);
+    // Move offsets of following texts
+    if (diff != 0) {
+      for (uint32_t i = index +1; i < SET_MAX; i++) {
+        settings_text_index[i] += diff;
+      }
+    }
+    TopicCacheReset();
 
     settings_text_mutex = false;
   }
 
 #ifdef DEBUG_FUNC_SETTINGSUPDATETEXT
-  AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_CONFIG "CR %d/%d, Busy %d, Id %02d = \"%s\""), GetSettingsTextLen(), settings_text_size, settings_text_busy_count, index_save, replace);
+  AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_CONFIG "CR %d/%d, Busy %d, Id %02d = \"%s\""), GetSettingsTextLen(), settings_text_size, settings_text_busy_count, index, replace);
 #else
   AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_CONFIG "CR %d/%d, Busy %d"), GetSettingsTextLen(), settings_text_size, settings_text_busy_count);
 #endif
@@ -577,14 +590,162 @@ char* SettingsText(uint32_t index) {
   if (index >= SET_MAX) {
     position += settings_text_size -1;  // Setting not supported - internal error - return empty string
   } else {
-    SettingsUpdateFinished();
-    for (;index > 0; index--) {
-      while (*position++ != '\0') { }
-    }
+    if (settings_text_mutex) { SettingsUpdateFinished(); }
+    if (!settings_text_index_valid) { SettingsTextIndexBuild(); }
+    position += settings_text_index[index];
   }
   return position;
 }
 
+/*********************************************************************************************\
+ * Config dirty block tracking
+ *
+ * Settings are split in 64 blocks of 64 bytes. A fast hash per block replaces the full crc32
+ * to find changed blocks on every save. Only blocks that changed are written to the journal.
+\*********************************************************************************************/
+
+const uint32_t SETTINGS_BLOCK_SIZE = 64;
+const uint32_t SETTINGS_BLOCKS = sizeof(TSettings) / SETTINGS_BLOCK_SIZE;  // 64 blocks fit the dirty mask
+
+uint32_t settings_block_hash[SETTINGS_BLOCKS];
+
+uint32_t SettingsBlockHash(uint32_t block) {
+  // FNV-1a on 32-bit words
+  const uint32_t *data = (const uint32_t*)((uint8_t*)Settings + (block * SETTINGS_BLOCK_SIZE));
+  uint32_t hash = 2166136261;
+  for (uint32_t i = 0; i < SETTINGS_BLOCK_SIZE / 4; i++) {
+    hash = (hash ^ data[i]) * 16777619;
+  }
+  return hash;
+}
+
+uint64_t SettingsDirtyBlocks(void) {
+  uint64_t dirty = 0;
+  for (uint32_t block = 0; block < SETTINGS_BLOCKS; block++) {
+    if (SettingsBlockHash(block) != settings_block_hash[block]) {
+      dirty |= (1ULL << block);
+    }
+  }
+  return dirty;
+}
+
+void SettingsDirtyClear(void) {
+  for (uint32_t block = 0; block < SETTINGS_BLOCKS; block++) {
+    settings_block_hash[block] = SettingsBlockHash(block);
+  }
+}
+
+#ifdef USE_SETTINGS_JOURNAL
+/*********************************************************************************************\
+ * Config journal - ESP8266 only
+ *
+ * The lowest rotating settings page holds changed blocks appended to the last saved settings page:
+ *   header  - magic, save_flag and cfg_crc32 of the settings page the journal applies to
+ *   records - offset and length (uint32_t), 64 bytes of settings data and crc32 of both
+ * Records are written to erased flash without erase until the page is full. Then all settings are
+ * saved to the next rotating page as before (compaction) and a new journal is started.
+\*********************************************************************************************/
+
+const uint32_t SETTINGS_JOURNAL_MAGIC = 0x4A534154;       // "TASJ"
+const uint32_t SETTINGS_JOURNAL_HEADER = 12;
+const uint32_t SETTINGS_JOURNAL_RECORD = 4 + SETTINGS_BLOCK_SIZE + 4;
+const uint32_t SETTINGS_JOURNAL_MAX_BLOCKS = 16;          // Save more changed blocks as full settings page
+
+struct {
+  uint32_t save_flag;                                     // Settings page this journal applies to
+  uint32_t crc32;
+  uint16_t used;                                          // Bytes used in journal page (0 = not started)
+  bool valid;                                             // Settings page is in flash
+} SettingsJournal;
+
+uint32_t SettingsJournalSector(void) {
+  return SETTINGS_LOCATION - CFG_ROTATES +1;              // Lowest rotating settings page
+}
+
+void SettingsJournalStart(bool valid) {
+  SettingsJournal.save_flag = Settings->save_flag;
+  SettingsJournal.crc32 = Settings->cfg_crc32;
+  SettingsJournal.used = 0;
+  SettingsJournal.valid = valid;
+}
+
+void SettingsJournalLoad(void) {
+  // Replay journal records on top of just loaded settings page
+  if (settings_location == SettingsJournalSector()) {
+    SettingsJournalStart(false);                          // Base page sits in the journal page (upgrade) - rotate before journaling
+    return;
+  }
+  SettingsJournalStart(true);
+  const uint32_t address = SettingsJournalSector() * SPI_FLASH_SEC_SIZE;
+  uint32_t record[SETTINGS_JOURNAL_RECORD / 4];
+  ESP.flashRead(address, (uint32*)record, SETTINGS_JOURNAL_HEADER);
+  if ((record[0] != SETTINGS_JOURNAL_MAGIC) || (record[1] != SettingsJournal.save_flag) || (record[2] != SettingsJournal.crc32)) {
+    return;                                               // No journal or journal of another settings page
+  }
+  uint32_t used = SETTINGS_JOURNAL_HEADER;
+  uint32_t records = 0;
+  while (used + SETTINGS_JOURNAL_RECORD <= SPI_FLASH_SEC_SIZE) {
+    ESP.flashRead(address + used, (uint32*)record, SETTINGS_JOURNAL_RECORD);
+    if (0xFFFFFFFF == record[0]) { break; }               // End of journal
+    uint32_t offset = record[0] & 0xFFFF;
+    uint32_t length = record[0] >> 16;
+    if ((length != SETTINGS_BLOCK_SIZE) || (offset + length > sizeof(TSettings)) ||
+        (record[(SETTINGS_JOURNAL_RECORD / 4) -1] != GetCfgCrc32((uint8_t*)record, SETTINGS_JOURNAL_RECORD -4))) {
+      used = SPI_FLASH_SEC_SIZE;                          // Interrupted write - compact on next save
+      break;
+    }
+    memcpy((uint8_t*)Settings + offset, &record[1], length);
+    used += SETTINGS_JOURNAL_RECORD;
+    records++;
+  }
+  SettingsJournal.used = used;
+  AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_CONFIG "Journal %d record(s)"), records);
+}
+
+bool SettingsJournalSave(uint64_t dirty) {
+  if (!SettingsJournal.valid || TasmotaGlobal.stop_flash_rotate) { return false; }
+
+  uint32_t blocks = 0;
+  for (uint32_t block = 0; block < SETTINGS_BLOCKS; block++) {
+    if ((dirty >> block) & 1) { blocks++; }
+  }
+  uint32_t used = (SettingsJournal.used) ? SettingsJournal.used : SETTINGS_JOURNAL_HEADER;
+  if ((blocks > SETTINGS_JOURNAL_MAX_BLOCKS) || (used + (blocks * SETTINGS_JOURNAL_RECORD) > SPI_FLASH_SEC_SIZE)) {
+    return false;                                         // Journal full - save all settings
+  }
+
+  const uint32_t sector = SettingsJournalSector();
+  const uint32_t address = sector * SPI_FLASH_SEC_SIZE;
+  uint32_t record[SETTINGS_JOURNAL_RECORD / 4];
+  if (0 == SettingsJournal.used) {
+    if (!ESP.flashEraseSector(sector)) { return false; }
+    settings_flash_erases++;
+    record[0] = SETTINGS_JOURNAL_MAGIC;
+    record[1] = SettingsJournal.save_flag;
+    record[2] = SettingsJournal.crc32;
+    ESP.flashWrite(address, (uint32*)record, SETTINGS_JOURNAL_HEADER);
+    settings_flash_writes++;
+  }
+  for (uint32_t block = 0; block < SETTINGS_BLOCKS; block++) {
+    if (!((dirty >> block) & 1)) { continue; }
+    uint32_t offset = block * SETTINGS_BLOCK_SIZE;
+    record[0] = offset | (SETTINGS_BLOCK_SIZE << 16);
+    memcpy(&record[1], (uint8_t*)Settings + offset, SETTINGS_BLOCK_SIZE);
+    record[(SETTINGS_JOURNAL_RECORD / 4) -1] = GetCfgCrc32((uint8_t*)record, SETTINGS_JOURNAL_RECORD -4);
+    if (!ESP.flashWrite(address + used, (uint32*)record, SETTINGS_JOURNAL_RECORD)) {
+      SettingsJournal.used = SPI_FLASH_SEC_SIZE;          // Compact now
+      return false;
+    }
+    settings_flash_writes++;
+    used += SETTINGS_JOURNAL_RECORD;
+    settings_block_hash[block] = SettingsBlockHash(block);
+  }
+  SettingsJournal.used = used;
+  AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_CONFIG "Journal %d block(s), " D_BYTES " %d/%d"), blocks, used, SPI_FLASH_SEC_SIZE);
+  return true;
+}
+#endif  // USE_SETTINGS_JOURNAL
+
 /*********************************************************************************************\
  * Config Save - Save parameters to Flash ONLY if any parameter has changed
 \*********************************************************************************************/
@@ -611,58 +772,77 @@ void SettingsSave(uint8_t rotate) {
   XsnsCall(FUNC_SAVE_SETTINGS);
   XdrvCall(FUNC_SAVE_SETTINGS);
   UpdateBackwardCompatibility();
-  if ((GetSettingsCrc32() != settings_crc32) || rotate) {
-    if (1 == rotate) {                                 // Use eeprom flash slot only and disable flash rotate from now on (upgrade)
-      TasmotaGlobal.stop_flash_rotate = 1;
-    }
-
-    if (TasmotaGlobal.stop_flash_rotate || (2 == rotate)) {  // Use eeprom flash slot and erase next flash slots if stop_flash_rotate is off (default)
-      settings_location = EEPROM_LOCATION;
-    } else {                                           // Rotate flash slots
-      if (settings_location == EEPROM_LOCATION) {
-        settings_location = SETTINGS_LOCATION;
-      } else {
-        settings_location--;
+  uint64_t dirty = SettingsDirtyBlocks();
+  if (dirty || rotate) {
+#ifdef USE_COUNTER
+    CounterInterruptDisable(true);
+#endif
+    bool journaled = false;
+#ifdef USE_SETTINGS_JOURNAL
+    journaled = (!rotate && SettingsJournalSave(dirty));  // Append changed blocks to journal
+#endif  // USE_SETTINGS_JOURNAL
+    if (!journaled) {
+      if (1 == rotate) {                                 // Use eeprom flash slot only and disable flash rotate from now on (upgrade)
+        TasmotaGlobal.stop_flash_rotate = 1;
       }
-      if (settings_location <= (SETTINGS_LOCATION - CFG_ROTATES)) {
+
+      if (TasmotaGlobal.stop_flash_rotate || (2 == rotate)) {  // Use eeprom flash slot and erase next flash slots if stop_flash_rotate is off (default)
         settings_location = EEPROM_LOCATION;
+      } else {                                           // Rotate flash slots
+        if (settings_location == EEPROM_LOCATION) {
+          settings_location = SETTINGS_LOCATION;
+        } else {
+          settings_location--;
+        }
+#ifdef USE_SETTINGS_JOURNAL
+        if (settings_location <= SettingsJournalSector()) {   // Lowest rotating page holds the journal
+#else
+        if (settings_location <= (SETTINGS_LOCATION - CFG_ROTATES)) {
+#endif  // USE_SETTINGS_JOURNAL
+          settings_location = EEPROM_LOCATION;
+        }
       }
-    }
 
-    Settings->save_flag++;
-    if (UtcTime() > START_VALID_TIME) {
-      Settings->cfg_timestamp = UtcTime();
-    } else {
-      Settings->cfg_timestamp++;
-    }
-    Settings->cfg_size = sizeof(TSettings);
-    Settings->cfg_crc = GetSettingsCrc();               // Keep for backward compatibility in case of fall-back just after upgrade
-    Settings->cfg_crc32 = GetSettingsCrc32();
-#ifdef USE_COUNTER
-    CounterInterruptDisable(true);
-#endif
+      Settings->save_flag++;
+      if (UtcTime() > START_VALID_TIME) {
+        Settings->cfg_timestamp = UtcTime();
+      } else {
+        Settings->cfg_timestamp++;
+      }
+      Settings->cfg_size = sizeof(TSettings);
+      Settings->cfg_crc = GetSettingsCrc();               // Keep for backward compatibility in case of fall-back just after upgrade
+      Settings->cfg_crc32 = GetSettingsCrc32();
 #ifdef ESP8266
 #ifdef USE_UFILESYS
-    TfsSaveFile(TASM_FILE_SETTINGS, (const uint8_t*)Settings, sizeof(TSettings));
+      TfsSaveFile(TASM_FILE_SETTINGS, (const uint8_t*)Settings, sizeof(TSettings));
 #endif  // USE_UFILESYS
-    if (ESP.flashEraseSector(settings_location)) {
-      ESP.flashWrite(settings_location * SPI_FLASH_SEC_SIZE, (uint32*)Settings, sizeof(TSettings));
-    }
+      bool saved = ESP.flashEraseSector(settings_location);
+      settings_flash_erases++;
+      if (saved) {
+        saved = ESP.flashWrite(settings_location * SPI_FLASH_SEC_SIZE, (uint32*)Settings, sizeof(TSettings));
+        settings_flash_writes++;
+      }
 
-    if (!TasmotaGlobal.stop_flash_rotate && rotate) {  // SetOption12 - (Settings) Switch between dynamic (0) or fixed (1) slot flash save location
-      for (uint32_t i = 0; i < CFG_ROTATES; i++) {
-        ESP.flashEraseSector(SETTINGS_LOCATION -i);    // Delete previous configurations by resetting to 0xFF
-        delay(1);
+      if (!TasmotaGlobal.stop_flash_rotate && rotate) {  // SetOption12 - (Settings) Switch between dynamic (0) or fixed (1) slot flash save location
+        for (uint32_t i = 0; i < CFG_ROTATES; i++) {
+          ESP.flashEraseSector(SETTINGS_LOCATION -i);    // Delete previous configurations by resetting to 0xFF
+          settings_flash_erases++;
+          delay(1);
+        }
       }
-    }
-    AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_CONFIG D_SAVED_TO_FLASH_AT " %X, " D_COUNT " %d, " D_BYTES " %d"), settings_location, Settings->save_flag, sizeof(TSettings));
+#ifdef USE_SETTINGS_JOURNAL
+      SettingsJournalStart(saved);                       // Next changes go to a new journal
+#endif  // USE_SETTINGS_JOURNAL
+      AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_CONFIG D_SAVED_TO_FLASH_AT " %X, " D_COUNT " %d, " D_BYTES " %d"), settings_location, Settings->save_flag, sizeof(TSettings));
 #endif  // ESP8266
 #ifdef ESP32
-    SettingsWrite(Settings, sizeof(TSettings));
-    AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_CONFIG "Saved, " D_COUNT " %d, " D_BYTES " %d"), Settings->save_flag, sizeof(TSettings));
+      SettingsWrite(Settings, sizeof(TSettings));
+      settings_flash_writes++;
+      AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_CONFIG "Saved, " D_COUNT " %d, " D_BYTES " %d"), Settings->save_flag, sizeof(TSettings));
 #endif  // ESP32
 
-    settings_crc32 = Settings->cfg_crc32;
+      SettingsDirtyClear();
+    }
   }
 #endif  // FIRMWARE_MINIMAL
   RtcSettingsSave();
@@ -671,6 +851,7 @@ void SettingsSave(uint8_t rotate) {
 #endif
 }
 void SettingsLoad(void) {
+  SettingsTextIndexReset();                                    // Text pool is replaced by loaded settings
 #ifdef ESP8266
   // Load configuration from optional file and flash (eeprom and 7 additonal slots) if first valid load does not stop_flash_rotate
   // Activated with version 8.4.0.2 - Fails to read any config before version 6.6.0.11
@@ -713,6 +894,9 @@ void SettingsLoad(void) {
       ESP.flashRead(settings_location * SPI_FLASH_SEC_SIZE, (uint32*)Settings, sizeof(TSettings));
       AddLog(LOG_LEVEL_NONE, PSTR(D_LOG_CONFIG D_LOADED_FROM_FLASH_AT " %X, " D_COUNT " %lu"), settings_location, Settings->save_flag);
     }
+#ifdef USE_SETTINGS_JOURNAL
+    SettingsJournalLoad();
+#endif  // USE_SETTINGS_JOURNAL
   }
 #endif  // ESP8266
 
@@ -729,6 +913,9 @@ void SettingsLoad(void) {
 #ifndef FIRMWARE_MINIMAL
   if ((0 == settings_location) || (Settings->cfg_holder != (uint16_t)CFG_HOLDER)) {  // Init defaults if cfg_holder differs from user settings in my_user_config.h
 //  if ((0 == settings_location) || (Settings->cfg_size != sizeof(TSettings)) || (Settings->cfg_holder != (uint16_t)CFG_HOLDER)) {  // Init defaults if cfg_holder differs from user settings in my_user_config.h
+#ifdef USE_SETTINGS_JOURNAL
+    SettingsJournal.valid = false;                             // Settings below are not in a flash page
+#endif  // USE_SETTINGS_JOURNAL
 #ifdef USE_UFILESYS
     if (TfsLoadFile(TASM_FILE_SETTINGS_LKG, (uint8_t*)Settings, sizeof(TSettings)) && (Settings->cfg_crc32 == GetSettingsCrc32())) {
       settings_location = 1;
@@ -739,8 +926,9 @@ void SettingsLoad(void) {
       SettingsDefault();
     }
   }
-  settings_crc32 = GetSettingsCrc32();
+  SettingsDirtyClear();
 #endif  // FIRMWARE_MINIMAL
+  SettingsTextIndexReset();
 
   RtcSettingsLoad(1);
 }
@@ -822,6 +1010,7 @@ void SettingsDefault(void) {
 
 void SettingsDefaultSet1(void) {
   memset(Settings, 0x00, sizeof(TSettings));
+  SettingsTextIndexReset();
 
   Settings->cfg_holder = (uint16_t)CFG_HOLDER;
   Settings->cfg_size = sizeof(TSettings);
@@ -954,6 +954,74 @@ int GetCommandCode(char* destination, size_t destination_size, const char* needl
   return result;
 }
 
+/*********************************************************************************************\
+ * Command cache
+ *
+ * Remembers for recently used commands which command table they were found in, at which
+ * position, and which driver or sensor claimed them. CommandHandler() then calls that driver
+ * directly and DecodeCommand() compares a single entry instead of scanning the whole table.
+ * A hit is always verified against the command table, a stale entry only costs a full scan.
+ * Commands not decoded from a table (i.e. registered at runtime by Berry) are never cached.
+\*********************************************************************************************/
+
+#ifndef COMMAND_CACHE_SIZE
+#ifdef ESP8266
+#define COMMAND_CACHE_SIZE      16          // Number of cached commands (power of 2)
+#else
+#define COMMAND_CACHE_SIZE      32          // Number of cached commands (power of 2)
+#endif
+#endif
+
+enum CommandCacheOwners { CMND_OWNER_NONE, CMND_OWNER_CORE, CMND_OWNER_XDRV, CMND_OWNER_XSNS };
+
+typedef struct {
+  uint32_t hash;                            // Hash of command name (upper case, without index)
+  const char* haystack;                     // Command table the command was found in
+  uint16_t offset;                          // Offset of the command in haystack
+  uint16_t code;                            // Command code as returned by GetCommandCode()
+  uint8_t owner;                            // CommandCacheOwners
+  uint8_t slot;                             // Position in xdrv or xsns list
+  uint8_t berry_slot;                       // Position of Berry in xdrv list, 0xFF if not present
+} CommandCacheEntry_t;
+
+struct {
+  CommandCacheEntry_t entry[COMMAND_CACHE_SIZE];
+  CommandCacheEntry_t found;                // Collected during dispatch of current command
+} CommandCache;
+
+uint32_t CommandCacheHash(const char* command) {
+  uint32_t hash = 2166136261;               // FNV-1a
+  while (*command) {
+    hash ^= (uint8_t)*command++;
+    hash *= 16777619;
+  }
+  return hash;
+}
+
+int DecodeCommandCode(char* destination, size_t destination_size, const char* needle, const char* haystack) {
+  // GetCommandCode() with a shortcut through the command cache
+  CommandCacheEntry_t* entry = &CommandCache.entry[CommandCache.found.hash & (COMMAND_CACHE_SIZE -1)];
+  if ((entry->hash == CommandCache.found.hash) && (entry->haystack == haystack)) {
+    if (0 == GetCommandCode(destination, destination_size, needle, haystack + entry->offset)) {
+      CommandCache.found.haystack = haystack;
+      CommandCache.found.offset = entry->offset;
+      CommandCache.found.code = entry->code;
+      return entry->code;
+    }
+  }
+  int command_code = GetCommandCode(destination, destination_size, needle, haystack);
+  if (command_code > 0) {
+    const char* read = haystack;
+    for (uint32_t i = command_code; i > 0; i--) {
+      while (pgm_read_byte(read++) != '|');   // Skip previous commands
+    }
+    CommandCache.found.haystack = haystack;
+    CommandCache.found.offset = read - haystack;
+    CommandCache.found.code = command_code;
+  }
+  return command_code;
+}
+
 bool DecodeCommand(const char* haystack, void (* const MyCommand[])(void), const uint8_t *synonyms = nullptr);
 bool DecodeCommand(const char* haystack, void (* const MyCommand[])(void), const uint8_t *synonyms) {
   GetTextIndexed(XdrvMailbox.command, CMDSZ, 0, haystack);  // Get prefix if available
@@ -966,7 +1034,7 @@ bool DecodeCommand(const char* haystack, void (* const MyCommand[])(void), const
     }
   }
   size_t syn_count = synonyms ? pgm_read_byte(synonyms) : 0;
-  int command_code = GetCommandCode(XdrvMailbox.command + prefix_length, CMDSZ, XdrvMailbox.topic + prefix_length, haystack);
+  int command_code = DecodeCommandCode(XdrvMailbox.command + prefix_length, CMDSZ, XdrvMailbox.topic + prefix_length, haystack);
   if (command_code > 0) {                                   // Skip prefix
     if (command_code > syn_count) {
       // We passed the synonyms zone, it's a regular command
@@ -1108,6 +1176,57 @@ char* ResponseGetTime(uint32_t format, char* time_str)
   return time_str;
 }
 
+/*********************************************************************************************\
+ * Response streaming
+ *
+ * While a sink is set by ResponseStreamBegin() the Response functions hand the response to
+ * the sink in chunks of at least RESPONSE_STREAM_CHUNK characters and clear the buffer, so
+ * large responses are neither buffered whole nor truncated. Only for writers that do not
+ * read back ResponseData(). A publish sink receives every payload passed to
+ * MqttPublishPayload() or MqttStreamPublish() while set, i.e. command results without the log
+ * buffer size limit. A streamed payload arrives in parts, first and last mark its ends.
+\*********************************************************************************************/
+
+#ifndef RESPONSE_STREAM_CHUNK
+#define RESPONSE_STREAM_CHUNK        400      // Minimum number of characters handed to the sink at once
+#endif
+
+struct {
+  void (*sink)(const char* data, uint32_t length) = nullptr;
+  void (*publish)(const char* data, uint32_t length, bool first, bool last) = nullptr;
+  uint32_t length;                            // Characters handed to sink
+} ResponseStream;
+
+void ResponseStreamFlush(void) {
+  if (!ResponseStream.sink) { return; }
+  uint32_t length = ResponseLength();
+  if (!length) { return; }
+  ResponseStream.sink(ResponseData(), length);
+  ResponseStream.length += length;
+  ResponseClear();
+}
+
+void ResponseStreamCheck(void) {
+  if (ResponseStream.sink && (ResponseLength() >= RESPONSE_STREAM_CHUNK)) {
+    ResponseStreamFlush();
+  }
+}
+
+void ResponseStreamBegin(void (*sink)(const char* data, uint32_t length)) {
+  ResponseClear();
+  ResponseStream.sink = sink;
+  ResponseStream.length = 0;
+}
+
+uint32_t ResponseStreamEnd(void) {
+  // Returns total number of characters streamed
+  ResponseStreamFlush();
+  ResponseStream.sink = nullptr;
+  return ResponseStream.length;
+}
+
+/*********************************************************************************************/
+
 char* ResponseData(void) {
 #ifdef MQTT_DATA_STRING
   return (char*)TasmotaGlobal.mqtt_data.c_str();
@@ -1154,6 +1273,7 @@ void ResponseJsonStart(void) {
 int Response_P(const char* format, ...)        // Content send snprintf_P char data
 {
   // This uses char strings. Be aware of sending %% if % is needed
+  ResponseStreamFlush();                       // Keep streamed content
 #ifdef MQTT_DATA_STRING
   va_list arg;
   va_start(arg, format);
@@ -1165,12 +1285,14 @@ int Response_P(const char* format, ...)        // Content send snprintf_P char d
   } else {
     TasmotaGlobal.mqtt_data = "";
   }
+  ResponseStreamCheck();
   return TasmotaGlobal.mqtt_data.length();
 #else
   va_list args;
   va_start(args, format);
   int len = ext_vsnprintf_P(TasmotaGlobal.mqtt_data, ResponseSize(), format, args);
   va_end(args);
+  ResponseStreamCheck();
   return len;
 #endif
 }
@@ -1178,6 +1300,7 @@ int Response_P(const char* format, ...)        // Content send snprintf_P char d
 int ResponseTime_P(const char* format, ...)    // Content send snprintf_P char data
 {
   // This uses char strings. Be aware of sending %% if % is needed
+  ResponseStreamFlush();                       // Keep streamed content
 #ifdef MQTT_DATA_STRING
   char timestr[100];
   TasmotaGlobal.mqtt_data = ResponseGetTime(Settings->flag2.time_format, timestr);
@@ -1190,6 +1313,7 @@ int ResponseTime_P(const char* format, ...)    // Content send snprintf_P char d
     TasmotaGlobal.mqtt_data += mqtt_data;
     free(mqtt_data);
   }
+  ResponseStreamCheck();
   return TasmotaGlobal.mqtt_data.length();
 #else
   va_list args;
@@ -1200,6 +1324,7 @@ int ResponseTime_P(const char* format, ...)    // Content send snprintf_P char d
   int mlen = ResponseLength();
   int len = ext_vsnprintf_P(TasmotaGlobal.mqtt_data + mlen, ResponseSize() - mlen, format, args);
   va_end(args);
+  ResponseStreamCheck();
   return len + mlen;
 #endif
 }
@@ -1216,6 +1341,7 @@ int ResponseAppend_P(const char* format, ...)  // Content send snprintf_P char d
     TasmotaGlobal.mqtt_data += mqtt_data;
     free(mqtt_data);
   }
+  ResponseStreamCheck();
   return TasmotaGlobal.mqtt_data.length();
 #else
   va_list args;
@@ -1223,6 +1349,7 @@ int ResponseAppend_P(const char* format, ...)  // Content send snprintf_P char d
   int mlen = ResponseLength();
   int len = ext_vsnprintf_P(TasmotaGlobal.mqtt_data + mlen, ResponseSize() - mlen, format, args);
   va_end(args);
+  ResponseStreamCheck();
   return len + mlen;
 #endif
 }
@@ -2455,7 +2582,7 @@ void SetSyslog(uint32_t loglevel)
 void SyslogAsync(bool refresh) {
   static IPAddress syslog_host_addr;      // Syslog host IP address
   static uint32_t syslog_host_hash = 0;   // Syslog host name hash
-  static uint32_t index = 1;
+  static uint32_t index = 0;                 // Initial start, dump all
 
   if (!TasmotaGlobal.syslog_level || TasmotaGlobal.global_state.network_down) { return; }
   if (refresh && !NeedLogRefresh(TasmotaGlobal.syslog_level, index)) { return; }
@@ -2512,73 +2639,166 @@ void SyslogAsync(bool refresh) {
   }
 }
 
+/*********************************************************************************************\
+ * Log buffer
+ *
+ * Ring buffer of records [length low][length high][loglevel][log data]['\1'] where length
+ * counts log data including the delimiter. A zero length, or less than three bytes left,
+ * marks the end of a lap. Positions are (lap << 16 | offset) and grow with every record.
+ * TasmotaGlobal.log_buffer_tail holds the oldest record and log_buffer_pointer the next free
+ * position. Writers serialize on log_buffer_mutex. Readers keep their own position, never
+ * lock and skip forward to the tail if a record was overwritten while being read.
+\*********************************************************************************************/
+
+uint32_t LogBufferLength(uint32_t position) {
+  uint32_t offset = position & 0xFFFF;
+  if (offset +3 > LOG_BUFFER_SIZE) { return 0; }  // End of lap
+  return (uint8_t)TasmotaGlobal.log_buffer[offset] | ((uint8_t)TasmotaGlobal.log_buffer[offset +1] << 8);
+}
+
+uint32_t LogBufferNext(uint32_t position) {
+  uint32_t length = LogBufferLength(position);
+  if (length) {
+    return position +3 + length;
+  }
+  uint32_t lap = ((position >> 16) +1) & 0xFFFF;
+  if (!lap) { lap++; }                     // Position 0 is reserved for dump all
+  return lap << 16;
+}
+
+int32_t LogBufferBytes(uint32_t from, uint32_t to) {
+  uint32_t laps = ((to >> 16) - (from >> 16)) & 0xFFFF;
+  return (laps * LOG_BUFFER_SIZE) + (to & 0xFFFF) - (from & 0xFFFF);
+}
+
+bool LogBufferValid(uint32_t position, uint32_t head) {
+  // Check that a reader supplied position between tail and head is the start of a record
+  uint32_t length = LogBufferLength(position);
+  if (!length) { return true; }            // End of lap
+  uint32_t offset = position & 0xFFFF;
+  if (offset +3 + length > LOG_BUFFER_SIZE) { return false; }
+  if (LogBufferBytes(position, head) < (int32_t)(3 + length)) { return false; }
+  char loglevel = TasmotaGlobal.log_buffer[offset +2];
+  if ((loglevel < '0') || (loglevel > '9')) { return false; }
+  return ('\1' == TasmotaGlobal.log_buffer[offset +2 + length]);
+}
+
 bool NeedLogRefresh(uint32_t req_loglevel, uint32_t index) {
   if (!TasmotaGlobal.log_buffer) { return false; }  // Leave now if there is no buffer available
 
-#ifdef ESP32
-  // this takes the mutex, and will be release when the class is destroyed -
-  // i.e. when the functon leaves  You CAN call mutex.give() to leave early.
-  TasAutoMutex mutex((SemaphoreHandle_t *)&TasmotaGlobal.log_buffer_mutex);
-#endif  // ESP32
+  uint32_t tail = __atomic_load_n(&TasmotaGlobal.log_buffer_tail, __ATOMIC_ACQUIRE);
+  uint32_t head = __atomic_load_n(&TasmotaGlobal.log_buffer_pointer, __ATOMIC_ACQUIRE);
 
   // Skip initial buffer fill
-  if (strlen(TasmotaGlobal.log_buffer) < LOG_BUFFER_SIZE / 2) { return false; }
+  if (LogBufferBytes(tail, head) < LOG_BUFFER_SIZE / 2) { return false; }
 
   char* line;
   size_t len;
   if (!GetLog(req_loglevel, &index, &line, &len)) { return false; }
-  return ((line - TasmotaGlobal.log_buffer) < LOG_BUFFER_SIZE / 4);
+  return (LogBufferBytes(tail, index) < LOG_BUFFER_SIZE / 4);
 }
 
 bool GetLog(uint32_t req_loglevel, uint32_t* index_p, char** entry_pp, size_t* len_p) {
   if (!TasmotaGlobal.log_buffer) { return false; }  // Leave now if there is no buffer available
   if (TasmotaGlobal.uptime < 3) { return false; }   // Allow time to setup correct log level
+  if (!req_loglevel) { return false; }
 
   uint32_t index = *index_p;
-  if (!req_loglevel || (index == TasmotaGlobal.log_buffer_pointer)) { return false; }
-
-#ifdef ESP32
-  // this takes the mutex, and will be release when the class is destroyed -
-  // i.e. when the functon leaves  You CAN call mutex.give() to leave early.
-  TasAutoMutex mutex((SemaphoreHandle_t *)&TasmotaGlobal.log_buffer_mutex);
-#endif  // ESP32
-
+  bool verify = true;                      // Position from the reader, i.e. a web client
   if (!index) {                            // Dump all
-    index = TasmotaGlobal.log_buffer[0];
+    index = __atomic_load_n(&TasmotaGlobal.log_buffer_tail, __ATOMIC_ACQUIRE);
   }
 
-  do {
-    size_t len = 0;
-    uint32_t loglevel = 0;
-    char* entry_p = TasmotaGlobal.log_buffer;
-    do {
-      uint32_t cur_idx = *entry_p;
-      entry_p++;
-      size_t tmp = strchrspn(entry_p, '\1');
-      tmp++;                               // Skip terminating '\1'
-      if (cur_idx == index) {              // Found the requested entry
-        loglevel = *entry_p - '0';
-        entry_p++;                         // Skip loglevel
-        len = tmp -1;
-        break;
+  while (true) {
+    uint32_t tail = __atomic_load_n(&TasmotaGlobal.log_buffer_tail, __ATOMIC_ACQUIRE);
+    uint32_t head = __atomic_load_n(&TasmotaGlobal.log_buffer_pointer, __ATOMIC_ACQUIRE);
+    if ((int32_t)(head - tail) < 0) { break; }    // Writer busy dropping all records, try again later
+    if ((index - tail) > (head - tail)) {  // Overwritten or unknown position
+      index = tail;
+    }
+    if (index == head) { break; }
+    if (verify) {
+      verify = false;
+      if ((index != tail) && !LogBufferValid(index, head)) {
+        index = tail;                      // Not at a record start
+        continue;
       }
-      entry_p += tmp;
-    } while (entry_p < TasmotaGlobal.log_buffer + LOG_BUFFER_SIZE && *entry_p != '\0');
-    index++;
-    if (index > 255) { index = 1; }        // Skip 0 as it is not allowed
-    *index_p = index;
+    }
+
+    uint32_t len = LogBufferLength(index);
+    char* entry_p = TasmotaGlobal.log_buffer + (index & 0xFFFF) +2;
+    uint32_t loglevel = (len) ? *entry_p - '0' : 0;
+    uint32_t next = LogBufferNext(index);
+
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    uint32_t new_tail = __atomic_load_n(&TasmotaGlobal.log_buffer_tail, __ATOMIC_RELAXED);
+    if ((index - tail) < (new_tail - tail)) {  // Record overwritten while reading it
+      index = new_tail;
+      continue;
+    }
+
+    index = next;
     if ((len > 0) &&
         (loglevel <= req_loglevel) &&
         (TasmotaGlobal.masterlog_level <= req_loglevel)) {
-      *entry_pp = entry_p;
+      *index_p = index;
+      *entry_pp = entry_p +1;              // Skip loglevel
       *len_p = len;
       return true;
     }
-    delay(0);
-  } while (index != TasmotaGlobal.log_buffer_pointer);
+  }
+  *index_p = index;
   return false;
 }
 
+void LogBufferWrite(uint32_t loglevel, const char* mxtime, const char* log_data, const char* log_data_payload, const char* log_data_retained) {
+  // Append record, caller holds log_buffer_mutex and keeps the record below MAX_LOGSZ
+  uint32_t mxtime_len = strlen(mxtime);
+  uint32_t log_data_len = strlen(log_data);
+  uint32_t log_data_payload_len = strlen(log_data_payload);
+  uint32_t log_data_retained_len = strlen(log_data_retained);
+  uint32_t length = mxtime_len + log_data_len + log_data_payload_len + log_data_retained_len +1;  // 1 = '\1'
+
+  uint32_t head = TasmotaGlobal.log_buffer_pointer;
+  uint32_t tail = TasmotaGlobal.log_buffer_tail;
+  uint32_t start = head;
+  if ((head & 0xFFFF) +3 + length > LOG_BUFFER_SIZE) {  // No room left in this lap
+    while ((tail >> 16) != (head >> 16)) {
+      tail = LogBufferNext(tail);        // Remove remaining log lines of previous lap
+    }
+    start = LogBufferNext(start | 0xFFFF);  // Start of next lap
+  }
+  uint32_t end = (start & 0xFFFF) +3 + length;
+  while ((tail != head) && ((tail >> 16) != (start >> 16)) && ((tail & 0xFFFF) < end)) {
+    tail = LogBufferNext(tail);          // Remove oldest log line
+  }
+  if (tail == head) { tail = start; }
+  __atomic_store_n(&TasmotaGlobal.log_buffer_tail, tail, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);  // Publish new tail before overwriting old log lines
+
+  if (start != head) {
+    uint32_t offset = head & 0xFFFF;
+    if (offset +3 <= LOG_BUFFER_SIZE) {
+      TasmotaGlobal.log_buffer[offset] = 0;  // End of lap marker
+      TasmotaGlobal.log_buffer[offset +1] = 0;
+    }
+  }
+  char* entry_p = TasmotaGlobal.log_buffer + (start & 0xFFFF);
+  *entry_p++ = length;
+  *entry_p++ = length >> 8;
+  *entry_p++ = '0' + loglevel;
+  memcpy(entry_p, mxtime, mxtime_len);
+  entry_p += mxtime_len;
+  memcpy(entry_p, log_data, log_data_len);
+  entry_p += log_data_len;
+  memcpy(entry_p, log_data_payload, log_data_payload_len);
+  entry_p += log_data_payload_len;
+  memcpy(entry_p, log_data_retained, log_data_retained_len);
+  entry_p += log_data_retained_len;
+  *entry_p = '\1';
+  __atomic_store_n(&TasmotaGlobal.log_buffer_pointer, start +3 + length, __ATOMIC_RELEASE);
+}
+
 void AddLogData(uint32_t loglevel, const char* log_data, const char* log_data_payload = nullptr, const char* log_data_retained = nullptr) {
   if (!TasmotaGlobal.enable_logging) { return; }
   // Store log_data in buffer
@@ -2626,8 +2846,8 @@ void AddLogData(uint32_t loglevel, const char* log_data, const char* log_data_pa
 
   if ((loglevel <= highest_loglevel) &&    // Log only when needed
       (TasmotaGlobal.masterlog_level <= highest_loglevel)) {
-    // Delimited, zero-terminated buffer of log lines.
-    // Each entry has this format: [index][loglevel][log data]['\1']
+    // Ring buffer of log lines.
+    // Each entry has this format: [length low][length high][loglevel][log data]['\1']
 
     // Truncate log messages longer than MAX_LOGSZ which is the log buffer size minus 64 spare
     uint32_t log_data_len = strlen(log_data) + strlen(log_data_payload) + strlen(log_data_retained);
@@ -2640,26 +2860,76 @@ void AddLogData(uint32_t loglevel, const char* log_data, const char* log_data_pa
       log_data_retained = empty;
     }
 
-    TasmotaGlobal.log_buffer_pointer &= 0xFF;
-    if (!TasmotaGlobal.log_buffer_pointer) {
-      TasmotaGlobal.log_buffer_pointer++;  // Index 0 is not allowed as it is the end of char string
-    }
-    while (TasmotaGlobal.log_buffer_pointer == TasmotaGlobal.log_buffer[0] ||  // If log already holds the next index, remove it
-           strlen(TasmotaGlobal.log_buffer) + strlen(log_data) + strlen(log_data_payload) + strlen(log_data_retained) + strlen(mxtime) + 4 > LOG_BUFFER_SIZE)  // 4 = log_buffer_pointer + '\1' + '\0'
-    {
-      char* it = TasmotaGlobal.log_buffer;
-      it++;                                // Skip log_buffer_pointer
-      it += strchrspn(it, '\1');           // Skip log line
-      it++;                                // Skip delimiting "\1"
-      memmove(TasmotaGlobal.log_buffer, it, LOG_BUFFER_SIZE -(it-TasmotaGlobal.log_buffer));  // Move buffer forward to remove oldest log line
-    }
-    snprintf_P(TasmotaGlobal.log_buffer, LOG_BUFFER_SIZE, PSTR("%s%c%c%s%s%s%s\1"),
-      TasmotaGlobal.log_buffer, TasmotaGlobal.log_buffer_pointer++, '0'+loglevel, mxtime, log_data, log_data_payload, log_data_retained);
-    TasmotaGlobal.log_buffer_pointer &= 0xFF;
-    if (!TasmotaGlobal.log_buffer_pointer) {
-      TasmotaGlobal.log_buffer_pointer++;  // Index 0 is not allowed as it is the end of char string
+    LogBufferWrite(loglevel, mxtime, log_data, log_data_payload, log_data_retained);
+  }
+}
+
+/*********************************************************************************************\
+ * Log stream
+ *
+ * A payload too long for one log record is logged as consecutive records of up to
+ * LOG_STREAM_PART characters instead of being truncated. The first record carries the
+ * log_data prefix, the last one the retained note.
+\*********************************************************************************************/
+
+#define LOG_STREAM_PART        (MAX_LOGSZ - TOPSZ - 32)  // Room for "MQT: " + topic + " = " + " (retained)"
+
+struct {
+  const char* log_data = nullptr;             // Prefix until the first record is written
+  char* part = nullptr;                       // LOG_STREAM_PART +1 characters
+  uint32_t length = 0;                        // Characters in part
+  uint32_t loglevel = 0;
+} LogStream;
+
+void LogStreamRecord(const char* log_data_retained) {
+  LogStream.part[LogStream.length] = '\0';
+  AddLogData(LogStream.loglevel, (LogStream.log_data) ? LogStream.log_data : "", LogStream.part, log_data_retained);
+  LogStream.log_data = nullptr;
+  LogStream.length = 0;
+}
+
+void LogStreamBegin(uint32_t loglevel, const char* log_data) {
+  // log_data must stay valid until LogStreamEnd()
+  LogStream.loglevel = loglevel;
+  LogStream.log_data = log_data;
+  LogStream.length = 0;
+  LogStream.part = (char*)malloc(LOG_STREAM_PART +1);
+}
+
+void LogStreamWrite(const char* data, uint32_t length) {
+  if (!LogStream.part) { return; }
+  while (length) {
+    if (LOG_STREAM_PART == LogStream.length) {
+      LogStreamRecord(nullptr);               // Only write a full part when more follows, the last one carries the retained note
     }
+    uint32_t size = LOG_STREAM_PART - LogStream.length;
+    if (size > length) { size = length; }
+    memcpy(LogStream.part + LogStream.length, data, size);
+    LogStream.length += size;
+    data += size;
+    length -= size;
+  }
+}
+
+void LogStreamEnd(const char* log_data_retained) {
+  if (!LogStream.part) {                      // Out of memory
+    AddLogData(LogStream.loglevel, LogStream.log_data, "...", log_data_retained);
+    return;
+  }
+  LogStreamRecord(log_data_retained);
+  free(LogStream.part);
+  LogStream.part = nullptr;
+}
+
+void AddLogPayload(uint32_t loglevel, const char* log_data, const char* payload, uint32_t length, const char* log_data_retained) {
+  // Log payload of any length, in consecutive records if it does not fit in one
+  if (length <= LOG_STREAM_PART) {
+    AddLogData(loglevel, log_data, payload, log_data_retained);
+    return;
   }
+  LogStreamBegin(loglevel, log_data);
+  LogStreamWrite(payload, length);
+  LogStreamEnd(log_data_retained);
 }
 
 void AddLog(uint32_t loglevel, PGM_P formatP, ...) {
@@ -44,6 +44,9 @@ const char kTasmotaCommands[] PROGMEM = "|"  // No prefix
 #endif  // USE_DEVICE_GROUPS_SEND
   D_CMND_DEVGROUP_SHARE "|" D_CMND_DEVGROUPSTATUS "|" D_CMND_DEVGROUP_TIE "|"
 #endif  // USE_DEVICE_GROUPS
+#ifdef USE_PROFILE_STATS
+  D_CMND_PROFILE "|"
+#endif  // USE_PROFILE_STATS
   D_CMND_SETSENSOR "|" D_CMND_SENSOR "|" D_CMND_DRIVER "|" D_CMND_JSON
 #ifdef ESP32
    "|Info|" D_CMND_TOUCH_CAL "|" D_CMND_TOUCH_THRES "|" D_CMND_TOUCH_NUM "|" D_CMND_CPU_FREQUENCY
@@ -79,6 +82,9 @@ void (* const TasmotaCommand[])(void) PROGMEM = {
 #endif  // USE_DEVICE_GROUPS_SEND
   &CmndDevGroupShare, &CmndDevGroupStatus, &CmndDevGroupTie,
 #endif  // USE_DEVICE_GROUPS
+#ifdef USE_PROFILE_STATS
+  &CmndProfile,
+#endif  // USE_PROFILE_STATS
   &CmndSetSensor, &CmndSensor, &CmndDriver, &CmndJson
 #ifdef ESP32
   , &CmndInfo, &CmndTouchCal, &CmndTouchThres, &CmndTouchNum, &CmndCpuFrequency
@@ -352,6 +358,62 @@ void ExecuteCommand(const char *cmnd, uint32_t source)
 
 /********************************************************************************************/
 
+bool CommandCacheCall(uint32_t index) {
+  // Call the owner of a cached command, returns false if it did not claim the command
+  CommandCacheEntry_t* entry = &CommandCache.entry[index];
+  switch (entry->owner) {
+    case CMND_OWNER_CORE:
+      CommandCache.found.owner = CMND_OWNER_CORE;
+      return DecodeCommand(kTasmotaCommands, TasmotaCommand, kTasmotaSynonyms);
+    case CMND_OWNER_XDRV:
+    case CMND_OWNER_XSNS:
+#ifdef USE_BERRY
+      // Berry can register commands at runtime, they take precedence over later drivers and sensors
+      if ((entry->berry_slot != 0xFF) && ((CMND_OWNER_XSNS == entry->owner) || (entry->slot > entry->berry_slot))) {
+        if (XdrvCallSlot(entry->berry_slot, FUNC_COMMAND)) { return true; }
+      }
+#endif  // USE_BERRY
+      CommandCache.found.owner = entry->owner;
+      CommandCache.found.slot = entry->slot;
+      if (CMND_OWNER_XDRV == entry->owner) {
+        return XdrvCallSlot(entry->slot, FUNC_COMMAND);
+      }
+      return XsnsCallSlot(entry->slot, FUNC_COMMAND);
+  }
+  return false;
+}
+
+bool CommandDispatch(void) {
+  // Offer command in XdrvMailbox to core, drivers and sensors until one claims it
+  CommandCacheEntry_t found_save = CommandCache.found;  // Commands can execute other commands
+  memset(&CommandCache.found, 0, sizeof(CommandCache.found));
+  uint32_t hash = CommandCacheHash(XdrvMailbox.topic);
+  CommandCache.found.hash = hash;
+
+  uint32_t index = hash & (COMMAND_CACHE_SIZE -1);
+  bool result = ((CommandCache.entry[index].hash == hash) && CommandCacheCall(index));
+  if (!result) {
+    memset(&CommandCache.found, 0, sizeof(CommandCache.found));
+    CommandCache.found.hash = hash;
+    if (DecodeCommand(kTasmotaCommands, TasmotaCommand, kTasmotaSynonyms)) {
+      CommandCache.found.owner = CMND_OWNER_CORE;
+      result = true;
+    } else {
+      result = (XdrvCall(FUNC_COMMAND) || XsnsCall(FUNC_COMMAND));  // Sets owner and slot when claimed
+    }
+  }
+  if (result && CommandCache.found.haystack && CommandCache.found.owner) {
+#ifdef USE_BERRY
+    CommandCache.found.berry_slot = XdrvSlot(52);           // Resolved once per cache entry, -1 becomes 0xFF
+#endif  // USE_BERRY
+    CommandCache.entry[index] = CommandCache.found;
+  }
+  CommandCache.found = found_save;
+  return result;
+}
+
+/********************************************************************************************/
+
 // topicBuf:                    /power1  dataBuf: toggle  = Console command
 // topicBuf:        cmnd/tasmota/power1  dataBuf: toggle  = Mqtt command using topic
 // topicBuf:       cmnd/tasmotas/power1  dataBuf: toggle  = Mqtt command using a group topic
@@ -444,21 +506,13 @@ void CommandHandler(char* topicBuf, char* dataBuf, uint32_t data_len)
 #ifdef USE_SCRIPT_SUB_COMMAND
   // allow overwrite tasmota cmds
     if (!Script_SubCmd()) {
-      if (!DecodeCommand(kTasmotaCommands, TasmotaCommand, kTasmotaSynonyms)) {
-        if (!XdrvCall(FUNC_COMMAND)) {
-          if (!XsnsCall(FUNC_COMMAND)) {
-            type = nullptr;  // Unknown command
-          }
-        }
+      if (!CommandDispatch()) {
+        type = nullptr;  // Unknown command
       }
     }
 #else  // USE_SCRIPT_SUB_COMMAND
-    if (!DecodeCommand(kTasmotaCommands, TasmotaCommand, kTasmotaSynonyms)) {
-      if (!XdrvCall(FUNC_COMMAND)) {
-        if (!XsnsCall(FUNC_COMMAND)) {
-          type = nullptr;  // Unknown command
-        }
-      }
+    if (!CommandDispatch()) {
+      type = nullptr;  // Unknown command
     }
 #endif  // USE_SCRIPT_SUB_COMMAND
 
@@ -644,18 +698,20 @@ void CmndPower(void)
 }
 
 void CmndStatusResponse(uint32_t index) {
-  static String all_status = (const char*) nullptr;
-
   if (0 == XdrvMailbox.index) {  // Command status0
+    // Stream all sections as one message {"Status":{..},"StatusPRM":{..},...} and process rules per section
     if (99 == index) {
-      all_status.replace("}{", ",");
+      MqttStreamSink("}", 1);
       char cmnd_status[10];  // STATUS11
       snprintf_P(cmnd_status, sizeof(cmnd_status), PSTR(D_CMND_STATUS "0"));
-      MqttPublishPayloadPrefixTopicRulesProcess_P(STAT, cmnd_status, all_status.c_str());
-      all_status = (const char*) nullptr;
+      MqttStreamPublishPrefixTopic_P(STAT, cmnd_status);
     } else {
-      if (0 == index) { all_status = ""; }
-      all_status += ResponseData();
+      if (0 == index) { MqttStreamClear(); }
+      uint32_t length = ResponseLength();
+      if ((length < 2) || (ResponseData()[0] != '{')) { return; }
+      MqttStreamSink((MqttStream.length) ? "," : "{", 1);
+      MqttStreamSink(ResponseData() +1, length -2);  // Without outer braces
+      XdrvRulesProcess(0);
     }
   }
   else if (index < 99) {
@@ -717,14 +773,15 @@ void CmndStatus(void)
   if ((0 == payload) || (1 == payload)) {
     Response_P(PSTR("{\"" D_CMND_STATUS D_STATUS1_PARAMETER "\":{\"" D_JSON_BAUDRATE "\":%d,\"" D_CMND_SERIALCONFIG "\":\"%s\",\"" D_CMND_GROUPTOPIC "\":\"%s\",\"" D_CMND_OTAURL "\":\"%s\",\""
                           D_JSON_RESTARTREASON "\":\"%s\",\"" D_JSON_UPTIME "\":\"%s\",\"" D_JSON_STARTUPUTC "\":\"%s\",\"" D_CMND_SLEEP "\":%d,\""
-                          D_JSON_CONFIG_HOLDER "\":%d,\"" D_JSON_BOOTCOUNT "\":%d,\"BCResetTime\":\"%s\",\"" D_JSON_SAVECOUNT "\":%d"
+                          D_JSON_CONFIG_HOLDER "\":%d,\"" D_JSON_BOOTCOUNT "\":%d,\"BCResetTime\":\"%s\",\"" D_JSON_SAVECOUNT "\":%d,\"SaveErases\":%d,\"SaveWrites\":%d"
 #ifdef ESP8266
                           ",\"" D_JSON_SAVEADDRESS "\":\"%X\""
 #endif
                           "}}"),
                           TasmotaGlobal.baudrate, GetSerialConfig().c_str(), SettingsText(SET_MQTT_GRP_TOPIC), SettingsText(SET_OTAURL),
                           GetResetReason().c_str(), GetUptime().c_str(), GetDateAndTime(DT_RESTART).c_str(), Settings->sleep,
-                          Settings->cfg_holder, Settings->bootcount, GetDateAndTime(DT_BOOTCOUNT).c_str(), Settings->save_flag
+                          Settings->cfg_holder, Settings->bootcount, GetDateAndTime(DT_BOOTCOUNT).c_str(), Settings->save_flag,
+                          settings_flash_erases, settings_flash_writes
 #ifdef ESP8266
                           , GetSettingsAddress()
 #endif
@@ -813,9 +870,13 @@ void CmndStatus(void)
 
   if (((0 == payload) || (6 == payload)) && Settings->flag.mqtt_enabled) {  // SetOption3 - Enable MQTT
     Response_P(PSTR("{\"" D_CMND_STATUS D_STATUS6_MQTT "\":{\"" D_CMND_MQTTHOST "\":\"%s\",\"" D_CMND_MQTTPORT "\":%d,\"" D_CMND_MQTTCLIENT D_JSON_MASK "\":\"%s\",\""
-                          D_CMND_MQTTCLIENT "\":\"%s\",\"" D_CMND_MQTTUSER "\":\"%s\",\"" D_JSON_MQTT_COUNT "\":%d,\"MAX_PACKET_SIZE\":%d,\"KEEPALIVE\":%d,\"SOCKET_TIMEOUT\":%d}}"),
+                          D_CMND_MQTTCLIENT "\":\"%s\",\"" D_CMND_MQTTUSER "\":\"%s\",\"" D_JSON_MQTT_COUNT "\":%d,\"MAX_PACKET_SIZE\":%d,\"KEEPALIVE\":%d,\"SOCKET_TIMEOUT\":%d"),
                           SettingsText(SET_MQTT_HOST), Settings->mqtt_port, EscapeJSONString(SettingsText(SET_MQTT_CLIENT)).c_str(),
                           TasmotaGlobal.mqtt_client, EscapeJSONString(SettingsText(SET_MQTT_USER)).c_str(), MqttConnectCount(), MQTT_MAX_PACKET_SIZE, Settings->mqtt_keepalive, Settings->mqtt_socket_timeout);
+#ifdef USE_MQTT_QUEUE
+    MqttQueueShow();
+#endif  // USE_MQTT_QUEUE
+    ResponseJsonEndEnd();
     CmndStatusResponse(6);
   }
 
@@ -1683,9 +1744,12 @@ void CmndGpio(void)
 }
 
 void ShowGpios(const uint16_t *NiceList, uint32_t size, uint32_t offset, uint32_t &lines) {
+  // Stream the whole list as one message
   uint32_t ridx;
   uint32_t midx;
-  bool jsflg = false;
+  MqttStreamClear();
+  ResponseStreamBegin(MqttStreamSink);
+  Response_P(PSTR("{\"" D_CMND_GPIOS "%d\":{"), lines);
   for (uint32_t i = offset; i < size; i++) {  // Skip ADC_NONE
     if (NiceList == nullptr) {
       ridx = AGPIO(i);
@@ -1694,20 +1758,13 @@ void ShowGpios(const uint16_t *NiceList, uint32_t size, uint32_t offset, uint32_
       ridx = pgm_read_word(NiceList + i) & 0xFFE0;
       midx = BGPIO(ridx);
     }
-    if (!jsflg) {
-      Response_P(PSTR("{\"" D_CMND_GPIOS "%d\":{"), lines);
-    } else {
-      ResponseAppend_P(PSTR(","));
-    }
-    jsflg = true;
     char stemp1[TOPSZ];
-    if ((ResponseAppend_P(PSTR("\"%d\":\"%s\""), ridx, GetTextIndexed(stemp1, sizeof(stemp1), midx, kSensorNames)) > (MAX_LOGSZ - TOPSZ)) || (i == size -1)) {
-      ResponseJsonEndEnd();
-      MqttPublishPrefixTopicRulesProcess_P(RESULT_OR_STAT, XdrvMailbox.command);
-      jsflg = false;
-      lines++;
-    }
+    ResponseAppend_P(PSTR("%s\"%d\":\"%s\""), (i > offset) ? "," : "", ridx, GetTextIndexed(stemp1, sizeof(stemp1), midx, kSensorNames));
   }
+  ResponseJsonEndEnd();
+  ResponseStreamEnd();
+  MqttStreamPublishPrefixTopic_P(RESULT_OR_STAT, XdrvMailbox.command);
+  lines++;
 }
 
 void CmndGpios(void)
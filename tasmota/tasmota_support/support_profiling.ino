@@ -50,25 +50,29 @@
  * Profiling services
 \*********************************************************************************************/
 
-#ifdef USE_PROFILING
-
-#ifndef PROFILE_THRESHOLD
-#define PROFILE_THRESHOLD            70       // Minimum duration in milliseconds to start logging
-#endif
+#if defined(USE_PROFILING) || defined(USE_PROFILE_STATS)
 
 // Below needs to be inline with enum XsnsFunctions
-const char kXSnsFunctions[] PROGMEM = "SETTINGS_OVERRIDE|PIN_STATE|MODULE_INIT|PRE_INIT|INIT|"
+const char kXSnsFunctions[] PROGMEM = "SETTINGS_OVERRIDE|PIN_STATE|I2C_INIT|MODULE_INIT|PRE_INIT|INIT|"
                                       "LOOP|EVERY_50_MSECOND|EVERY_100_MSECOND|EVERY_200_MSECOND|EVERY_250_MSECOND|EVERY_SECOND|"
                                       "SAVE_SETTINGS|SAVE_AT_MIDNIGHT|SAVE_BEFORE_RESTART|"
-                                      "AFTER_TELEPERIOD|JSON_APPEND|WEB_SENSOR|COMMAND|COMMAND_SENSOR|COMMAND_DRIVER|"
-                                      "MQTT_SUBSCRIBE|MQTT_INIT|MQTT_DATA|"
+                                      "AFTER_TELEPERIOD|JSON_APPEND|WEB_SENSOR|WEB_COL_SENSOR|COMMAND|COMMAND_SENSOR|COMMAND_DRIVER|"
+                                      "MQTT_SUBSCRIBE|MQTT_INIT|MQTT_DATA|MQTT_DATA_STREAM|"
                                       "SET_POWER|SET_DEVICE_POWER|SHOW_SENSOR|ANY_KEY|"
                                       "ENERGY_EVERY_SECOND|ENERGY_RESET|"
-                                      "RULES_PROCESS|TELEPERIOD_RULES_PROCESS|SERIAL|FREE_MEM|BUTTON_PRESSED|"
+                                      "RULES_PROCESS|TELEPERIOD_RULES_PROCESS|SERIAL|FREE_MEM|BUTTON_PRESSED|BUTTON_MULTI_PRESSED|"
                                       "WEB_ADD_BUTTON|WEB_ADD_CONSOLE_BUTTON|WEB_ADD_MANAGEMENT_BUTTON|WEB_ADD_MAIN_BUTTON|"
-                                      "WEB_ADD_HANDLER|SET_CHANNELS|SET_SCHEME|HOTPLUG_SCAN|"
+                                      "WEB_GET_ARG|WEB_ADD_HANDLER|SET_CHANNELS|SET_SCHEME|HOTPLUG_SCAN|TIME_SYNCED|"
                                       "DEVICE_GROUP_ITEM";
 
+#endif  // USE_PROFILING || USE_PROFILE_STATS
+
+#ifdef USE_PROFILING
+
+#ifndef PROFILE_THRESHOLD
+#define PROFILE_THRESHOLD            70       // Minimum duration in milliseconds to start logging
+#endif
+
 #ifdef USE_PROFILE_DRIVER
 void AddLogDriver(const char *driver, uint8_t function, uint32_t start) {
   uint32_t profile_millis = millis() - start;
@@ -90,3 +94,236 @@ void AddLogFunction(const char *driver, uint8_t index, uint8_t function, uint32_
 #endif  // USE_PROFILE_DRIVER
 
 #endif  // USE_PROFILING
+
+/*********************************************************************************************\
+ * Profiling statistics
+ *
+ * Per driver and function call counts, total and maximum duration and a log2 histogram in
+ * microseconds, collected in XdrvCall(), XsnsCall(), XnrgCall() and XlgtCall().
+ * Energy and light driver calls are nested in xdrv_03 and xdrv_04 and also counted there.
+ *
+ * To keep memory low a driver/function pair is only recorded from its first call lasting
+ * at least PROFILE_STATS_MIN_US, while the totals per function include all calls.
+ * Memory is only allocated while profiling is started.
+ *
+ * Profile       - Show status and top 10 driver functions by total time
+ * Profile 1     - Start (or restart) profiling
+ * Profile 2     - Reset statistics
+ * Profile 0     - Stop profiling and free memory
+ * http://<ip>/prf - All statistics in JSON
+\*********************************************************************************************/
+
+#ifdef USE_PROFILE_STATS
+
+#ifndef PROFILE_STATS_MIN_US
+#define PROFILE_STATS_MIN_US         50       // Minimum duration in microseconds for a driver function to be recorded
+#endif
+#ifndef PROFILE_STATS_SIZE
+#ifdef ESP8266
+#define PROFILE_STATS_SIZE           64       // Number of driver/function pairs (power of 2)
+#else
+#define PROFILE_STATS_SIZE           256      // Number of driver/function pairs (power of 2)
+#endif
+#endif
+#define PROFILE_STATS_BUCKETS        16       // Log2 histogram buckets, from below 2us to 32ms and above
+#define PROFILE_STATS_FUNCTIONS      (FUNC_DEVICE_GROUP_ITEM +1)
+#define PROFILE_STATS_TOP            10
+
+enum ProfileStatsTypes { PRF_NONE, PRF_XDRV, PRF_XSNS, PRF_XNRG, PRF_XLGT };
+
+typedef struct {
+  uint8_t type;                               // ProfileStatsTypes, PRF_NONE if entry is free
+  uint8_t index;                              // Position in xdrv or xsns list, or xnrg or xlgt driver number
+  uint8_t function;                           // FUNC_*
+  uint32_t count;
+  uint32_t max;                               // Microseconds
+  uint64_t total;                             // Microseconds
+  uint16_t histogram[PROFILE_STATS_BUCKETS];
+} ProfileStat_t;
+
+struct {
+  ProfileStat_t *stats = nullptr;             // Allocated while profiling is started
+  uint64_t *function_total = nullptr;         // Microseconds per function, all drivers
+  uint32_t *function_count = nullptr;
+  uint32_t start;                             // Uptime at start or reset
+  uint16_t used;
+  uint16_t dropped;                           // Pairs not recorded as table is full
+} ProfileStats;
+
+void ProfileStatsAdd(uint32_t type, uint32_t index, uint32_t function, uint32_t start) {
+  if (!ProfileStats.stats) { return; }        // Stopped by command Profile 0 from within the measured call
+  uint32_t duration = micros() - start;
+  if (function >= PROFILE_STATS_FUNCTIONS) { return; }
+  ProfileStats.function_total[function] += duration;
+  ProfileStats.function_count[function]++;
+
+  uint32_t hash = ((type << 16) | (index << 8) | function) * 0x9E3779B1;
+  uint32_t i = (hash >> 16) & (PROFILE_STATS_SIZE -1);
+  ProfileStat_t *stat;
+  while (true) {
+    stat = &ProfileStats.stats[i];
+    if (PRF_NONE == stat->type) {
+      if (duration < PROFILE_STATS_MIN_US) { return; }          // Not worth recording yet
+      if (ProfileStats.used >= PROFILE_STATS_SIZE * 3 / 4) {     // Keep probing short
+        ProfileStats.dropped++;
+        return;
+      }
+      stat->type = type;
+      stat->index = index;
+      stat->function = function;
+      ProfileStats.used++;
+      break;
+    }
+    if ((stat->type == type) && (stat->index == index) && (stat->function == function)) { break; }
+    i = (i +1) & (PROFILE_STATS_SIZE -1);
+  }
+
+  stat->count++;
+  stat->total += duration;
+  if (duration > stat->max) { stat->max = duration; }
+  uint32_t bucket = (duration < 2) ? 0 : 31 - __builtin_clz(duration);
+  if (bucket >= PROFILE_STATS_BUCKETS) { bucket = PROFILE_STATS_BUCKETS -1; }
+  if (stat->histogram[bucket] < 0xFFFF) { stat->histogram[bucket]++; }
+}
+
+void ProfileStatsReset(void) {
+  memset(ProfileStats.stats, 0, PROFILE_STATS_SIZE * sizeof(ProfileStat_t));
+  memset(ProfileStats.function_total, 0, PROFILE_STATS_FUNCTIONS * sizeof(uint64_t));
+  memset(ProfileStats.function_count, 0, PROFILE_STATS_FUNCTIONS * sizeof(uint32_t));
+  ProfileStats.used = 0;
+  ProfileStats.dropped = 0;
+  ProfileStats.start = UpTime();
+}
+
+void ProfileStatsStop(void) {
+  ProfileStat_t *stats = ProfileStats.stats;
+  ProfileStats.stats = nullptr;               // Stop recording first
+  free(stats);
+  free(ProfileStats.function_total);
+  ProfileStats.function_total = nullptr;
+  free(ProfileStats.function_count);
+  ProfileStats.function_count = nullptr;
+}
+
+bool ProfileStatsStart(void) {
+  if (ProfileStats.stats) {
+    ProfileStatsReset();
+    return true;
+  }
+  ProfileStats.function_total = (uint64_t*)malloc(PROFILE_STATS_FUNCTIONS * sizeof(uint64_t));
+  ProfileStats.function_count = (uint32_t*)malloc(PROFILE_STATS_FUNCTIONS * sizeof(uint32_t));
+  ProfileStat_t *stats = (ProfileStat_t*)malloc(PROFILE_STATS_SIZE * sizeof(ProfileStat_t));
+  if (!stats || !ProfileStats.function_total || !ProfileStats.function_count) {
+    free(stats);
+    ProfileStatsStop();
+    return false;
+  }
+  ProfileStats.stats = stats;
+  ProfileStatsReset();                        // Recording starts with next driver call
+  return true;
+}
+
+char* ProfileStatsName(char* name, size_t size, uint32_t type, uint32_t index) {
+  switch (type) {
+    case PRF_XDRV: snprintf_P(name, size, PSTR("xdrv_%02d"), XdrvIndex(index)); break;
+    case PRF_XSNS: snprintf_P(name, size, PSTR("xsns_%02d"), XsnsIndex(index)); break;
+    case PRF_XNRG: snprintf_P(name, size, PSTR("xnrg_%02d"), index); break;
+    case PRF_XLGT: snprintf_P(name, size, PSTR("xlgt_%02d"), index); break;
+    default: name[0] = '\0';
+  }
+  return name;
+}
+
+// Entry as JSON object, for Response or web page
+String ProfileStatsJson(uint32_t entry, bool histogram) {
+  const ProfileStat_t *stat = &ProfileStats.stats[entry];
+  char name[10];
+  char function[28];
+  char line[160];
+  snprintf_P(line, sizeof(line), PSTR("{\"Id\":\"%s\",\"Func\":\"%s\",\"Count\":%u,\"TotalMs\":%u,\"AvgUs\":%u,\"MaxUs\":%u"),
+    ProfileStatsName(name, sizeof(name), stat->type, stat->index),
+    GetTextIndexed(function, sizeof(function), stat->function, kXSnsFunctions),
+    stat->count, (uint32_t)(stat->total / 1000), (stat->count) ? (uint32_t)(stat->total / stat->count) : 0, stat->max);
+  String json = line;
+  if (histogram) {
+    json += F(",\"Hist\":[");
+    for (uint32_t i = 0; i < PROFILE_STATS_BUCKETS; i++) {
+      if (i) { json += ','; }
+      json += stat->histogram[i];
+    }
+    json += ']';
+  }
+  json += '}';
+  return json;
+}
+
+void ProfileStatsResponse(bool all) {
+  Response_P(PSTR("{\"" D_CMND_PROFILE "\":{\"State\":\"%s\""), GetStateText(ProfileStats.stats != nullptr));
+  if (ProfileStats.stats) {
+    ResponseAppend_P(PSTR(",\"Duration\":%u,\"Threshold\":%u,\"Entries\":%u,\"Dropped\":%u"),
+      UpTime() - ProfileStats.start, PROFILE_STATS_MIN_US, ProfileStats.used, ProfileStats.dropped);
+    if (all) {
+      ResponseAppend_P(PSTR(",\"Functions\":{"));
+      bool first = true;
+      char function[28];
+      for (uint32_t i = 0; i < PROFILE_STATS_FUNCTIONS; i++) {
+        if (0 == ProfileStats.function_count[i]) { continue; }
+        ResponseAppend_P(PSTR("%s\"%s\":{\"Count\":%u,\"TotalMs\":%u}"), (first) ? "" : ",",
+          GetTextIndexed(function, sizeof(function), i, kXSnsFunctions), ProfileStats.function_count[i], (uint32_t)(ProfileStats.function_total[i] / 1000));
+        first = false;
+      }
+      ResponseAppend_P(PSTR("},\"Drivers\":["));
+      first = true;
+      for (uint32_t i = 0; i < PROFILE_STATS_SIZE; i++) {
+        if (PRF_NONE == ProfileStats.stats[i].type) { continue; }
+        ResponseAppend_P(PSTR("%s%s"), (first) ? "" : ",", ProfileStatsJson(i, true).c_str());
+        first = false;
+      }
+    } else {
+      ResponseAppend_P(PSTR(",\"Top\":["));
+      // Top entries by total time, selected without sorting the table
+      uint64_t below = UINT64_MAX;
+      for (uint32_t n = 0; n < PROFILE_STATS_TOP; n++) {
+        int32_t top = -1;
+        for (uint32_t i = 0; i < PROFILE_STATS_SIZE; i++) {
+          const ProfileStat_t *stat = &ProfileStats.stats[i];
+          if ((PRF_NONE == stat->type) || (stat->total >= below)) { continue; }
+          if ((top < 0) || (stat->total > ProfileStats.stats[top].total)) { top = i; }
+        }
+        if (top < 0) { break; }
+        below = ProfileStats.stats[top].total;
+        ResponseAppend_P(PSTR("%s%s"), (n) ? "," : "", ProfileStatsJson(top, false).c_str());
+      }
+    }
+    ResponseAppend_P(PSTR("]"));
+  }
+  ResponseJsonEndEnd();
+}
+
+void CmndProfile(void) {
+  switch (XdrvMailbox.payload) {
+    case 0: ProfileStatsStop(); break;
+    case 1:
+      if (!ProfileStatsStart()) {
+        ResponseCmndChar_P(PSTR(D_JSON_MEMORY_ERROR));
+        return;
+      }
+      break;
+    case 2: if (ProfileStats.stats) { ProfileStatsReset(); } break;
+  }
+  ProfileStatsResponse(false);
+}
+
+#ifdef USE_WEBSERVER
+void HandleProfileStats(void) {
+  if (!HttpCheckPriviledgedAccess()) { return; }
+
+  WSContentBegin(200, CT_APP_JSON);
+  ResponseStreamBegin(WSResponseSink);        // All entries may exceed the response buffer
+  ProfileStatsResponse(true);
+  ResponseStreamEnd();
+  WSContentEnd();
+}
+#endif  // USE_WEBSERVER
+
+#endif  // USE_PROFILE_STATS
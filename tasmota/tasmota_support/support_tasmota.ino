@@ -88,22 +88,36 @@ String ResolveToken(const char* input) {
   return resolved;
 }
 
-char* GetTopic_P(char *stopic, uint32_t prefix, const char *topic, const char* subtopic)
+/*********************************************************************************************\
+ * Topic cache
+ *
+ * Full topics without subtopic are cached per prefix and topic. The cache is reset on any
+ * Settings text change as FullTopic, Topic, GroupTopic, Prefix and Hostname are all texts.
+\*********************************************************************************************/
+
+#ifdef ESP8266
+const uint32_t TOPIC_CACHE_SIZE = 4;
+#else
+const uint32_t TOPIC_CACHE_SIZE = 8;
+#endif
+
+struct {
+  String topic;
+  String fulltopic;                           // Resolved full topic ending with a slash
+  uint8_t key;                                // Prefix and fallback flag +1 (0 = unused)
+} TopicCache[TOPIC_CACHE_SIZE];
+uint8_t topic_cache_next = 0;
+
+void TopicCacheReset(void) {
+  for (uint32_t i = 0; i < TOPIC_CACHE_SIZE; i++) {
+    TopicCache[i].key = 0;
+  }
+}
+
+String GetFullTopic_P(uint32_t prefix, const char *topic)
 {
-  /* prefix 0 = Cmnd
-     prefix 1 = Stat
-     prefix 2 = Tele
-     prefix 4 = Cmnd fallback
-     prefix 5 = Stat fallback
-     prefix 6 = Tele fallback
-     prefix 8 = Cmnd topic
-     prefix 9 = Stat topic
-     prefix 10 = Tele topic
-  */
-  char romram[CMDSZ];
   String fulltopic;
 
-  snprintf_P(romram, sizeof(romram), subtopic);
   if (TasmotaGlobal.fallback_topic_flag || (prefix > 3)) {
     bool fallback = (prefix < 8);
     prefix &= 3;
@@ -138,7 +152,39 @@ char* GetTopic_P(char *stopic, uint32_t prefix, const char *topic, const char* s
   if (!fulltopic.endsWith("/")) {
     fulltopic += "/";
   }
-  snprintf_P(stopic, TOPSZ, PSTR("%s%s"), fulltopic.c_str(), romram);
+  return fulltopic;
+}
+
+char* GetTopic_P(char *stopic, uint32_t prefix, const char *topic, const char* subtopic)
+{
+  /* prefix 0 = Cmnd
+     prefix 1 = Stat
+     prefix 2 = Tele
+     prefix 4 = Cmnd fallback
+     prefix 5 = Stat fallback
+     prefix 6 = Tele fallback
+     prefix 8 = Cmnd topic
+     prefix 9 = Stat topic
+     prefix 10 = Tele topic
+  */
+  char romram[CMDSZ];
+  snprintf_P(romram, sizeof(romram), subtopic);
+
+  uint32_t key = (prefix | (TasmotaGlobal.fallback_topic_flag << 4)) +1;
+  if (nullptr == topic) { topic = PSTR(""); }
+  uint32_t index = 0;
+  while ((index < TOPIC_CACHE_SIZE) && ((TopicCache[index].key != key) || strcmp_P(TopicCache[index].topic.c_str(), topic))) {
+    index++;
+  }
+  if (TOPIC_CACHE_SIZE == index) {            // Not cached
+    String fulltopic = GetFullTopic_P(prefix, topic);
+    index = topic_cache_next;
+    topic_cache_next = (topic_cache_next +1) % TOPIC_CACHE_SIZE;
+    TopicCache[index].topic = (const __FlashStringHelper *)topic;
+    TopicCache[index].fulltopic = fulltopic;
+    TopicCache[index].key = key;
+  }
+  snprintf_P(stopic, TOPSZ, PSTR("%s%s"), TopicCache[index].fulltopic.c_str(), romram);
   return stopic;
 }
 
@@ -27,8 +27,16 @@
 
 #define XDRV_01                                   1
 
-// Enable below demo feature only if defines USE_UNISHOX_COMPRESSION and USE_SCRIPT_WEB_DISPLAY are disabled
-//#define USE_WEB_SSE
+// Enable below feature only if define USE_SCRIPT_WEB_DISPLAY is disabled
+//#define USE_WEB_SSE                              // Push main page status and console log to the browser using server-sent events on /events
+
+//#define USE_WEB_STATIC_GZIP                      // Serve the static page scripts and styles gzipped and cached by the browser (see tools/html-gzip)
+
+#ifdef USE_WEB_SSE
+#ifndef WEB_SSE_MAX_CLIENTS
+#define WEB_SSE_MAX_CLIENTS                       2      // Maximum number of concurrent /events connections (main page or console)
+#endif
+#endif  // USE_WEB_SSE
 
 #ifndef WIFI_SOFT_AP_CHANNEL
 #define WIFI_SOFT_AP_CHANNEL                      1      // Soft Access Point Channel number between 1 and 11 as used by WifiManager web GUI
@@ -82,7 +90,11 @@ const char HTTP_SCRIPT_COUNTER[] PROGMEM =
   #ifdef USE_SCRIPT_WEB_DISPLAY
     #include "./html_compressed/HTTP_SCRIPT_ROOT_WEB_DISPLAY.h"
   #else
-    #include "./html_compressed/HTTP_SCRIPT_ROOT_NO_WEB_DISPLAY.h"
+    #ifdef USE_WEB_SSE
+      #include "./html_compressed/HTTP_SCRIPT_ROOT_SSE_NO_WEB_DISPLAY.h"
+    #else
+      #include "./html_compressed/HTTP_SCRIPT_ROOT_NO_WEB_DISPLAY.h"
+    #endif  // USE_WEB_SSE
   #endif
   #include "./html_compressed/HTTP_SCRIPT_ROOT_PART2.h"
 #else
@@ -119,9 +131,17 @@ const char HTTP_SCRIPT_RELOAD_TIME[] PROGMEM =
   "setTimeout(function(){location.href='.';},%d);";
 
 #ifdef USE_UNISHOX_COMPRESSION
-  #include "./html_compressed/HTTP_SCRIPT_CONSOL.h"
+  #ifdef USE_WEB_SSE
+    #include "./html_compressed/HTTP_SCRIPT_CONSOL_SSE.h"
+  #else
+    #include "./html_compressed/HTTP_SCRIPT_CONSOL.h"
+  #endif  // USE_WEB_SSE
 #else
-  #include "./html_uncompressed/HTTP_SCRIPT_CONSOL.h"
+  #ifdef USE_WEB_SSE
+    #include "./html_uncompressed/HTTP_SCRIPT_CONSOL_SSE.h"
+  #else
+    #include "./html_uncompressed/HTTP_SCRIPT_CONSOL.h"
+  #endif  // USE_WEB_SSE
 #endif
 
 const char HTTP_MODULE_TEMPLATE_REPLACE_INDEX[] PROGMEM =
@@ -219,6 +239,24 @@ const char HTTP_SCRIPT_INFO_END[] PROGMEM =
   #include "./html_uncompressed/HTTP_HEAD_STYLE2.h"
 #endif
 
+#ifdef USE_WEB_STATIC_GZIP
+#ifdef ESP32
+  #include "./html_gzipped/HTTP_HEAD_LAST_SCRIPT32_GZ.h"
+  #define HTTP_STATIC_SCRIPT        HTTP_HEAD_LAST_SCRIPT32_GZ
+  #define HTTP_STATIC_SCRIPT_SIZE   HTTP_HEAD_LAST_SCRIPT32_GZ_SIZE
+  #define HTTP_STATIC_SCRIPT_ETAG   HTTP_HEAD_LAST_SCRIPT32_GZ_ETAG
+#else
+  #include "./html_gzipped/HTTP_HEAD_LAST_SCRIPT_GZ.h"
+  #define HTTP_STATIC_SCRIPT        HTTP_HEAD_LAST_SCRIPT_GZ
+  #define HTTP_STATIC_SCRIPT_SIZE   HTTP_HEAD_LAST_SCRIPT_GZ_SIZE
+  #define HTTP_STATIC_SCRIPT_ETAG   HTTP_HEAD_LAST_SCRIPT_GZ_ETAG
+#endif  // ESP32
+  #include "./html_gzipped/HTTP_SCRIPT_MODULE_TEMPLATE_GZ.h"
+#ifdef USE_ZIGBEE
+  #include "./html_gzipped/HTTP_HEAD_STYLE_ZIGBEE_GZ.h"
+#endif  // USE_ZIGBEE
+#endif  // USE_WEB_STATIC_GZIP
+
 #ifdef USE_ZIGBEE
 // Styles used for Zigbee Web UI
 // Battery icon from https://css.gg/battery
@@ -445,7 +483,17 @@ struct WEB {
   uint8_t config_block_count = 0;
   bool upload_services_stopped = false;
   bool reset_web_log_flag = false;                  // Reset web console log
+  bool result_sent = false;                         // Command result sent by http /cm
+  bool result_json = false;                         // Command result being sent is JSON
   bool initial_config = false;
+#ifdef USE_WEB_SSE
+  WiFiClient sse_client[WEB_SSE_MAX_CLIENTS];       // Open /events connections
+  uint32_t sse_log_index[WEB_SSE_MAX_CLIENTS];      // Console log position per connection
+  bool sse_console[WEB_SSE_MAX_CLIENTS];            // Connection wants console log instead of status
+  String sse_status = "";                           // Last pushed main page status, shared by all connections
+  String *sse_capture = nullptr;                    // Collect content here instead of sending it to the current client
+  uint32_t sse_status_time = 0;                     // Next status refresh
+#endif  // USE_WEB_SSE
 } Web;
 
 // Helper function to avoid code duplication (saves 4k Flash)
@@ -577,7 +625,11 @@ void StartWebserver(int type, IPAddress ipweb)
     if (!Webserver) {
       Webserver = new ESP8266WebServer((HTTP_MANAGER == type || HTTP_MANAGER_RESET_ONLY == type) ? 80 : WEB_PORT);
 
+#ifdef USE_WEB_STATIC_GZIP
+      const char* headerkeys[] = { "Referer", "If-None-Match" };
+#else
       const char* headerkeys[] = { "Referer" };
+#endif  // USE_WEB_STATIC_GZIP
       size_t headerkeyssize = sizeof(headerkeys) / sizeof(char*);
       Webserver->collectHeaders(headerkeys, headerkeyssize);
 
@@ -596,6 +648,19 @@ void StartWebserver(int type, IPAddress ipweb)
       Webserver->onNotFound(HandleNotFound);
 //      Webserver->on(F("/u2"), HTTP_POST, HandleUploadDone, HandleUploadLoop);  // this call requires 2 functions so we keep a direct call
       Webserver->on("/u2", HTTP_POST, HandleUploadDone, HandleUploadLoop);  // this call requires 2 functions so we keep a direct call
+#ifdef USE_PROFILE_STATS
+      WebServer_on(PSTR("/prf"), HandleProfileStats, HTTP_GET);  // uri longer than WebServerDispatch entries
+#endif  // USE_PROFILE_STATS
+#ifdef USE_WEB_SSE
+      WebServer_on(PSTR("/events"), HandleEvents, HTTP_GET);  // uri longer than WebServerDispatch entries
+#endif  // USE_WEB_SSE
+#ifdef USE_WEB_STATIC_GZIP
+      WebServer_on(PSTR("/s.js"), HandleStaticScript, HTTP_GET);  // uri longer than WebServerDispatch entries
+      WebServer_on(PSTR("/m.js"), HandleStaticModuleScript, HTTP_GET);
+#ifdef USE_ZIGBEE
+      WebServer_on(PSTR("/z.css"), HandleStaticZigbeeStyle, HTTP_GET);
+#endif  // USE_ZIGBEE
+#endif  // USE_WEB_STATIC_GZIP
 #ifndef FIRMWARE_MINIMAL
       XdrvCall(FUNC_WEB_ADD_HANDLER);
       XsnsCall(FUNC_WEB_ADD_HANDLER);
@@ -764,6 +829,12 @@ void WSContentBegin(int code, int ctype) {
 }
 
 void _WSContentSend(const char* content, size_t size) {  // Lowest level sendContent for all core versions
+#ifdef USE_WEB_SSE
+  if (Web.sse_capture) {                           // Rendering for /events
+    WebSseAppend(*Web.sse_capture, content, size);
+    return;
+  }
+#endif  // USE_WEB_SSE
   Webserver->sendContent(content, size);
 
   SHOW_FREE_MEM(PSTR("WSContentSend"));
@@ -865,11 +936,16 @@ void WSContentSendStyle_P(const char* formatP, ...) {
       WSContentSend_P(HTTP_SCRIPT_COUNTER);
     }
   }
+#ifdef USE_WEB_STATIC_GZIP
+  // The ETag in the url makes the browser fetch a new script only when its content changes
+  WSContentSend_P(PSTR("</script><script src='/s.js?" HTTP_STATIC_SCRIPT_ETAG "'></script>"));
+#else
 #ifdef ESP32
   WSContentSend_P(HTTP_HEAD_LAST_SCRIPT32);
 #else
   WSContentSend_P(HTTP_HEAD_LAST_SCRIPT);
 #endif
+#endif  // USE_WEB_STATIC_GZIP
 
   WSContentSend_P(HTTP_HEAD_STYLE1, WebColor(COL_FORM), WebColor(COL_INPUT), WebColor(COL_INPUT_TEXT), WebColor(COL_INPUT),
                   WebColor(COL_INPUT_TEXT), WebColor(COL_CONSOLE), WebColor(COL_CONSOLE_TEXT), WebColor(COL_BACKGROUND));
@@ -877,7 +953,11 @@ void WSContentSendStyle_P(const char* formatP, ...) {
                   WebColor(COL_BUTTON_RESET), WebColor(COL_BUTTON_RESET_HOVER), WebColor(COL_BUTTON_SAVE), WebColor(COL_BUTTON_SAVE_HOVER),
                   WebColor(COL_BUTTON));
 #ifdef USE_ZIGBEE
+#ifdef USE_WEB_STATIC_GZIP
+  WSContentSend_P(PSTR("</style><link rel='stylesheet' href='/z.css?" HTTP_HEAD_STYLE_ZIGBEE_GZ_ETAG "'><style>"));
+#else
   WSContentSend_P(HTTP_HEAD_STYLE_ZIGBEE);
+#endif  // USE_WEB_STATIC_GZIP
 #endif // USE_ZIGBEE
   if (formatP != nullptr) {
     // This uses char strings. Be aware of sending %% if % is needed
@@ -1445,12 +1525,17 @@ bool HandleRootStatusRefresh(void)
   XsnsCall(FUNC_WEB_GET_ARG);
   XdrvCall(FUNC_WEB_GET_ARG);
 
-#ifdef USE_WEB_SSE
-  WSContentBegin(200, CT_STREAM);
-  WSContentSend_P(PSTR("data: "));
-#else
   WSContentBegin(200, CT_HTML);
-#endif  // USE_WEB_SSE
+  WSContentSendStatus();
+  WSContentEnd();
+
+  return true;
+}
+
+void WSContentSendStatus(void) {
+  // Sensor table and power state shown on the main page
+  char svalue[32];                   // Device state
+
   WSContentSend_P(PSTR("{t}"));
   if (Settings->web_time_end) {
     WSContentSend_P(PSTR("{s}" D_TIMER_TIME "{m}%s{e}"), GetDateAndTime(DT_LOCAL).substring(Settings->web_time_start, Settings->web_time_end).c_str());
@@ -1484,10 +1569,6 @@ bool HandleRootStatusRefresh(void)
 
     WSContentSend_P(PSTR("</tr></table>"));
   }
-  WSContentSend_P(PSTR("\n\n"));  // Prep for SSE
-  WSContentEnd();
-
-  return true;
 }
 
 #ifdef USE_SHUTTER
@@ -1594,6 +1675,14 @@ void WSContentSendAdcNiceList(uint32_t option) {
 #endif  // USE_ADC
 #endif  // ESP8266
 
+void WSContentSendModuleTemplateScript(void) {
+#ifdef USE_WEB_STATIC_GZIP
+  WSContentSend_P(PSTR("</script><script src='/m.js?" HTTP_SCRIPT_MODULE_TEMPLATE_GZ_ETAG "'></script><script>"));
+#else
+  WSContentSend_P(HTTP_SCRIPT_MODULE_TEMPLATE);
+#endif  // USE_WEB_STATIC_GZIP
+}
+
 /*-------------------------------------------------------------------------------------------*/
 
 void HandleTemplateConfiguration(void) {
@@ -1641,7 +1730,7 @@ void HandleTemplateConfiguration(void) {
   AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_HTTP D_CONFIGURE_TEMPLATE));
 
   WSContentStart_P(PSTR(D_CONFIGURE_TEMPLATE));
-  WSContentSend_P(HTTP_SCRIPT_MODULE_TEMPLATE);
+  WSContentSendModuleTemplateScript();
 
   WSContentSend_P(HTTP_SCRIPT_TEMPLATE);
 
@@ -1772,7 +1861,7 @@ void HandleModuleConfiguration(void) {
   TemplateGpios(&template_gp);
 
   WSContentStart_P(PSTR(D_CONFIGURE_MODULE));
-  WSContentSend_P(HTTP_SCRIPT_MODULE_TEMPLATE);
+  WSContentSendModuleTemplateScript();
 
   WSContentSend_P(PSTR("function sl(){os=\""));
   uint32_t vidx = 0;
@@ -3031,6 +3120,29 @@ void HandleSwitchBootPartition(void)
 
 /*-------------------------------------------------------------------------------------------*/
 
+void WSResponseSink(const char* data, uint32_t length) {
+  WSContentSend(data, length);
+}
+
+void WSResultSink(const char* data, uint32_t length, bool first, bool last) {
+  // {"POWER":"OFF"} > "POWER":"OFF", a streamed message arrives in parts
+  if (first) {
+    if (last) {
+      Web.result_json = ((length >= 2) && (data[0] == '{') && (data[length -1] == '}'));
+    } else {
+      Web.result_json = ((length >= 1) && (data[0] == '{'));
+    }
+    if (!Web.result_json) { return; }                    // Not a JSON message like stat/wemos5/POWER = ON
+    if (Web.result_sent) { WSContentSend_P(PSTR(",")); }
+    Web.result_sent = true;
+    data++;
+    length--;
+  }
+  if (!Web.result_json) { return; }
+  if (last && length && (data[length -1] == '}')) { length--; }
+  if (length) { WSContentSend(data, length); }
+}
+
 void HandleHttpCommand(void)
 {
   if (!HttpCheckPriviledgedAccess(false)) { return; }
@@ -3060,26 +3172,12 @@ void HandleHttpCommand(void)
   WSContentBegin(200, CT_APP_JSON);
   String svalue = Webserver->arg(F("cmnd"));
   if (svalue.length() && (svalue.length() < MQTT_MAX_PACKET_SIZE)) {
-    uint32_t curridx = TasmotaGlobal.log_buffer_pointer;
-    TasmotaGlobal.templog_level = LOG_LEVEL_INFO;
-    ExecuteWebCommand((char*)svalue.c_str(), SRC_WEBCOMMAND);
     WSContentSend_P(PSTR("{"));
-    bool cflg = false;
-    uint32_t index = curridx;
-    char* line;
-    size_t len;
-    while (GetLog(TasmotaGlobal.templog_level, &index, &line, &len)) {
-      // [14:49:36.123 MQTT: stat/wemos5/RESULT = {"POWER":"OFF"}] > [{"POWER":"OFF"}]
-      char* JSON = (char*)memchr(line, '{', len);
-      if (JSON) {  // Is it a JSON message (and not only [15:26:08 MQT: stat/wemos5/POWER = O])
-        if (cflg) { WSContentSend_P(PSTR(",")); }
-        uint32_t JSONlen = len - (JSON - line) -3;
-        WSContentSend(JSON +1, JSONlen);
-        cflg = true;
-      }
-    }
+    Web.result_sent = false;
+    ResponseStream.publish = WSResultSink;   // Stream command results without log buffer size limit
+    ExecuteWebCommand((char*)svalue.c_str(), SRC_WEBCOMMAND);
+    ResponseStream.publish = nullptr;
     WSContentSend_P(PSTR("}"));
-    TasmotaGlobal.templog_level = 0;
   } else {
     WSContentSend_P(PSTR("{\"" D_RSLT_WARNING "\":\"" D_ENTER_COMMAND " cmnd=\"}"));
   }
@@ -3137,13 +3235,13 @@ void HandleConsoleRefresh(void)
     ExecuteWebCommand((char*)svalue.c_str(), SRC_WEBCONSOLE);
   }
 
-  char stmp[8];
+  char stmp[12];
   WebGetArg(PSTR("c2"), stmp, sizeof(stmp));
   uint32_t index = 0;                // Initial start, dump all
-  if (strlen(stmp)) { index = atoi(stmp); }
+  if (strlen(stmp)) { index = strtoul(stmp, nullptr, 10); }
 
   WSContentBegin(200, CT_PLAIN);
-  WSContentSend_P(PSTR("%d}1%d}1"), TasmotaGlobal.log_buffer_pointer, Web.reset_web_log_flag);
+  WSContentSend_P(PSTR("%u}1%d}1"), TasmotaGlobal.log_buffer_pointer, Web.reset_web_log_flag);
   if (!Web.reset_web_log_flag) {
     index = 0;
     Web.reset_web_log_flag = true;
@@ -3160,6 +3258,182 @@ void HandleConsoleRefresh(void)
   WSContentEnd();
 }
 
+#ifdef USE_WEB_SSE
+/*********************************************************************************************\
+ * Server-sent events on /events
+ *
+ * The main page status is rendered once per WebRefresh for all connections and only pushed when changed.
+ * Console connections (/events?c=1) receive new log lines as they are added to the log buffer.
+\*********************************************************************************************/
+
+void HandleEvents(void) {
+  bool console = Webserver->hasArg(F("c"));
+  if (console) {
+    if (!HttpCheckPriviledgedAccess()) { return; }
+  } else if (!WebAuthenticate()) {
+    Webserver->requestAuthentication();
+    return;
+  }
+
+  uint32_t slot;
+  for (slot = 0; slot < WEB_SSE_MAX_CLIENTS; slot++) {
+    if (!Web.sse_client[slot].connected()) { break; }
+  }
+  if (WEB_SSE_MAX_CLIENTS == slot) {
+    WSSend(503, CT_PLAIN, "");                     // Browser falls back to polling
+    return;
+  }
+
+  AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_HTTP "Events %d from %_I"), slot +1, (uint32_t)Webserver->client().remoteIP());
+
+  // Headers are written directly as the connection is kept open after this handler returns
+  WiFiClient &client = Web.sse_client[slot];
+  client = Webserver->client();
+  client.setTimeout(200);                          // Do not stall the loop on a slow browser
+  client.printf_P(PSTR("HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\nConnection: keep-alive\r\n\r\n"
+                       "retry: %d\n\n"), Settings->web_refresh);
+  Web.sse_console[slot] = console;
+  Web.sse_log_index[slot] = 0;                     // Initial start, dump all
+  if (!console && Web.sse_status.length()) {
+    String event;
+    WebSseEvent(event, PSTR("s"), Web.sse_status.c_str(), Web.sse_status.length(), 0);
+    WebSseWrite(slot, event);
+  }
+}
+
+void WebSseAppend(String &str, const char* data, uint32_t len) {
+  // Append non-terminated data (String::concat(ptr, len) is not available on all cores)
+  str.reserve(str.length() + len);
+  for (uint32_t i = 0; i < len; i++) {
+    str += data[i];
+  }
+}
+
+void WebSseEvent(String &event, const char* name, const char* data, uint32_t len, uint32_t id) {
+  // Append one event, every line of data gets its own data field
+  char header[32];
+  if (id) {
+    snprintf_P(header, sizeof(header), PSTR("id: %u\nevent: %s\n"), id, name);
+  } else {
+    snprintf_P(header, sizeof(header), PSTR("event: %s\n"), name);
+  }
+  event += header;
+  uint32_t start = 0;
+  for (uint32_t i = 0; i <= len; i++) {
+    if ((i == len) || ('\n' == data[i])) {
+      event += F("data: ");
+      WebSseAppend(event, data + start, i - start);
+      event += '\n';
+      start = i +1;
+    }
+  }
+  event += '\n';
+}
+
+bool WebSseWrite(uint32_t slot, const String &event) {
+  WiFiClient &client = Web.sse_client[slot];
+  if (client.write(event.c_str(), event.length()) != event.length()) {
+    AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_HTTP "Events %d closed"), slot +1);
+    client.stop();                                 // Browser reconnects and gets the full state
+    return false;
+  }
+  return true;
+}
+
+void WebSseLoop(void) {
+  bool status = false;
+  bool console = false;
+  for (uint32_t slot = 0; slot < WEB_SSE_MAX_CLIENTS; slot++) {
+    if (Web.sse_client[slot].connected()) {
+      if (Web.sse_console[slot]) {
+        console = true;
+      } else {
+        status = true;
+      }
+    }
+  }
+
+  if (status && TimeReached(Web.sse_status_time)) {
+    SetNextTimeInterval(Web.sse_status_time, Settings->web_refresh);
+    String content;
+    Web.sse_capture = &content;
+    Web.chunk_buffer = "";
+    WSContentSendStatus();
+    WSContentFlush();
+    Web.sse_capture = nullptr;
+    if (content != Web.sse_status) {
+      Web.sse_status = content;
+      String event;
+      WebSseEvent(event, PSTR("s"), content.c_str(), content.length(), 0);
+      for (uint32_t slot = 0; slot < WEB_SSE_MAX_CLIENTS; slot++) {
+        if (!Web.sse_console[slot] && Web.sse_client[slot].connected()) {
+          WebSseWrite(slot, event);
+        }
+      }
+    }
+  }
+  if (!status) {
+    Web.sse_status = "";                           // Release memory, next connection triggers a new render
+  }
+
+  if (console) {
+    for (uint32_t slot = 0; slot < WEB_SSE_MAX_CLIENTS; slot++) {
+      if (!Web.sse_console[slot] || !Web.sse_client[slot].connected()) { continue; }
+      String event;
+      char* line;
+      size_t len;
+      while (GetLog(Settings->weblog_level, &Web.sse_log_index[slot], &line, &len)) {
+        WebSseEvent(event, PSTR("l"), line, len -1, Web.sse_log_index[slot]);
+        if (event.length() >= CHUNKED_BUFFER_SIZE) {
+          if (!WebSseWrite(slot, event)) { break; }
+          event = "";
+        }
+      }
+      if (event.length() && Web.sse_client[slot].connected()) {
+        WebSseWrite(slot, event);
+      }
+    }
+  }
+}
+#endif  // USE_WEB_SSE
+
+/********************************************************************************************/
+
+#ifdef USE_WEB_STATIC_GZIP
+void HandleStaticGzip(const char* content_type, const char* content, size_t size, const char* etag_P)
+{
+  // Static content stored gzipped in flash, answered with 304 if the browser already has this version
+  String etag = F("\"");
+  etag += FPSTR(etag_P);
+  etag += F("\"");
+  Webserver->sendHeader(F("Cache-Control"), F("public, max-age=31536000"));
+  Webserver->sendHeader(F("ETag"), etag);
+  if (Webserver->header(F("If-None-Match")) == etag) {
+    Webserver->send(304);
+    return;
+  }
+  Webserver->sendHeader(F("Content-Encoding"), F("gzip"));
+  Webserver->send_P(200, content_type, content, size);
+}
+
+void HandleStaticScript(void)
+{
+  HandleStaticGzip(PSTR("text/javascript"), HTTP_STATIC_SCRIPT, HTTP_STATIC_SCRIPT_SIZE, PSTR(HTTP_STATIC_SCRIPT_ETAG));
+}
+
+void HandleStaticModuleScript(void)
+{
+  HandleStaticGzip(PSTR("text/javascript"), HTTP_SCRIPT_MODULE_TEMPLATE_GZ, HTTP_SCRIPT_MODULE_TEMPLATE_GZ_SIZE, PSTR(HTTP_SCRIPT_MODULE_TEMPLATE_GZ_ETAG));
+}
+
+#ifdef USE_ZIGBEE
+void HandleStaticZigbeeStyle(void)
+{
+  HandleStaticGzip(PSTR("text/css"), HTTP_HEAD_STYLE_ZIGBEE_GZ, HTTP_HEAD_STYLE_ZIGBEE_GZ_SIZE, PSTR(HTTP_HEAD_STYLE_ZIGBEE_GZ_ETAG));
+}
+#endif  // USE_ZIGBEE
+#endif  // USE_WEB_STATIC_GZIP
+
 /********************************************************************************************/
 
 void HandleNotFound(void)
@@ -3701,6 +3975,11 @@ bool Xdrv01(uint8_t function)
       if (Settings->flag2.emulation) { PollUdp(); }
 #endif  // USE_EMULATION
       break;
+#ifdef USE_WEB_SSE
+    case FUNC_EVERY_250_MSECOND:
+      if (Web.state) { WebSseLoop(); }
+      break;
+#endif  // USE_WEB_SSE
     case FUNC_EVERY_SECOND:
       if (Web.initial_config) {
         Wifi.config_counter = 200;    // Do not restart the device if it has SSId Blank
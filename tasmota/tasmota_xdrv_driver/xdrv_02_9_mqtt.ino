@@ -465,6 +465,9 @@ bool MqttIsConnected(void) {
 }
 
 void MqttDisconnect(void) {
+#ifdef USE_MQTT_QUEUE
+  MqttQueueFlush();
+#endif  // USE_MQTT_QUEUE
   MqttClient.disconnect();
 }
 
@@ -487,7 +490,7 @@ void MqttUnsubscribeLib(const char *topic) {
   MqttClient.loop();  // Solve LmacRxBlk:1 messages
 }
 
-bool MqttPublishLib(const char* topic, const uint8_t* payload, unsigned int plength, bool retained) {
+void MqttPublishCmndBlock(const char* topic) {
   // If Prefix1 equals Prefix2 disable next MQTT subscription to prevent loop
   if (!strcmp(SettingsText(SET_MQTTPREFIX1), SettingsText(SET_MQTTPREFIX2))) {
     char *str = strstr(topic, SettingsText(SET_MQTTPREFIX1));
@@ -496,6 +499,10 @@ bool MqttPublishLib(const char* topic, const uint8_t* payload, unsigned int plen
       TasmotaGlobal.mqtt_cmnd_blocked++;
     }
   }
+}
+
+bool MqttPublishLib(const char* topic, const uint8_t* payload, unsigned int plength, bool retained) {
+  MqttPublishCmndBlock(topic);
 
 #ifdef USE_TASMESH
  if (MESHrouteMQTTtoMESH(topic, (char*)payload, retained)) {  // If we are a node, send this via ESP-Now
@@ -605,6 +612,30 @@ void MqttDataHandler(char* mqtt_topic, uint8_t* mqtt_data, unsigned int data_len
   }
 }
 
+bool MqttStreamHandler(char* mqtt_topic, uint8_t* chunk, unsigned int chunk_len, unsigned int offset, unsigned int total) {
+  // Payloads not fitting the receive buffer are passed in chunks straight from the socket
+  //  to the driver claiming the topic with FUNC_MQTT_DATA_STREAM
+  // Offer:  XdrvMailbox.data = nullptr, XdrvMailbox.index = total payload length
+  // Chunks: XdrvMailbox.data = chunk (zero terminated), XdrvMailbox.data_len = chunk length, XdrvMailbox.payload = chunk offset
+  // A driver returns true to accept the offer and for every chunk it wants to keep receiving
+  // Topic is a copy kept for the whole stream, the chunk is overwritten if the driver publishes
+  if (nullptr == chunk) {
+    if (total + strlen(mqtt_topic) + 9 <= MqttClient.getBufferSize()) {
+      return false;                                  // Fits the buffer so use MqttDataHandler in place
+    }
+  }
+  XdrvMailbox.topic = mqtt_topic;
+  XdrvMailbox.index = total;
+  XdrvMailbox.payload = offset;
+  XdrvMailbox.data_len = chunk_len;
+  XdrvMailbox.data = (char*)chunk;
+  bool result = XdrvCall(FUNC_MQTT_DATA_STREAM);
+  if (!result && (nullptr == chunk)) {
+    AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_MQTT "Dropped %d bytes on topic '%s' exceeding buffer"), total, mqtt_topic);
+  }
+  return result;
+}
+
 /*********************************************************************************************/
 
 void MqttRetryCounter(uint8_t value) {
@@ -622,7 +653,7 @@ void MqttUnsubscribe(const char *topic) {
 }
 
 void MqttPublishLoggingAsync(bool refresh) {
-  static uint32_t index = 1;
+  static uint32_t index = 0;                 // Initial start, dump all
 
   if (!Settings->mqttlog_level || !Settings->flag.mqtt_enabled || !Mqtt.connected) { return; }  // SetOption3 - Enable MQTT
   if (refresh && !NeedLogRefresh(Settings->mqttlog_level, index)) { return; }
@@ -636,6 +667,351 @@ void MqttPublishLoggingAsync(bool refresh) {
   }
 }
 
+#ifdef USE_MQTT_QUEUE
+/*********************************************************************************************\
+ * Outbound queue
+ *
+ * MqttPublishPayload() queues messages which are sent from the main loop for up to
+ * MQTT_QUEUE_BUDGET milliseconds. Queued packets are combined into one client write of up to
+ * MQTT_QUEUE_BATCH bytes. A newer retained, STATE or SENSOR message replaces the unsent message
+ * on the same topic.
+\*********************************************************************************************/
+
+#ifndef MQTT_QUEUE_SIZE
+#define MQTT_QUEUE_SIZE        16                // Max number of queued messages
+#endif
+#ifndef MQTT_QUEUE_MEMORY
+#define MQTT_QUEUE_MEMORY      4096              // Max number of bytes used by queued topics and payloads
+#endif
+#ifndef MQTT_QUEUE_BUDGET
+#define MQTT_QUEUE_BUDGET      5                 // Max number of milliseconds per loop used to send queued messages
+#endif
+#define MQTT_QUEUE_BATCH       1024              // Max number of bytes per client write
+
+struct MQTT_QUEUE_ITEM {
+  char *topic;                                   // Topic and payload in one allocation
+  uint32_t queued;                               // millis() when queued
+  uint16_t length;                               // Payload length
+  bool retained;
+};
+
+struct {
+  MQTT_QUEUE_ITEM item[MQTT_QUEUE_SIZE];
+  uint8_t *batch = nullptr;
+  uint32_t memory = 0;                           // Bytes used by queued items
+  uint32_t sent = 0;
+  uint32_t coalesced = 0;
+  uint32_t drops = 0;
+  uint32_t latency = 0;                          // Average mSeconds between queue and send
+  uint32_t latency_max = 0;
+  uint8_t head = 0;
+  uint8_t count = 0;
+  uint8_t count_max = 0;
+} MqttQueue;
+
+uint32_t MqttQueuePacket(uint8_t* buffer, uint32_t index) {
+  // Build MQTT QoS 0 PUBLISH packet of queued item, return packet size (only when buffer is nullptr)
+  MQTT_QUEUE_ITEM *item = &MqttQueue.item[index];
+  uint32_t tlen = strlen(item->topic);
+  uint32_t remaining = 2 + tlen + item->length;
+  uint32_t size = 2 + remaining;                 // Header and one byte remaining length
+  for (uint32_t len = remaining >> 7; len; len >>= 7) { size++; }
+  if (buffer) {
+    *buffer++ = MQTTPUBLISH | (item->retained);
+    do {
+      uint8_t digit = remaining & 0x7F;
+      remaining >>= 7;
+      *buffer++ = (remaining) ? digit | 0x80 : digit;
+    } while (remaining);
+    *buffer++ = tlen >> 8;
+    *buffer++ = tlen;
+    memcpy(buffer, item->topic, tlen);
+    memcpy(buffer + tlen, item->topic + tlen +1, item->length);
+  }
+  return size;
+}
+
+void MqttQueueRemove(void) {
+  // Remove oldest queued item
+  MQTT_QUEUE_ITEM *item = &MqttQueue.item[MqttQueue.head];
+  MqttQueue.memory -= strlen(item->topic) +1 + item->length;
+  free(item->topic);
+  item->topic = nullptr;
+  MqttQueue.head = (MqttQueue.head +1) % MQTT_QUEUE_SIZE;
+  MqttQueue.count--;
+}
+
+void MqttQueueClear(void) {
+  MqttQueue.drops += MqttQueue.count;
+  while (MqttQueue.count) {
+    MqttQueueRemove();
+  }
+}
+
+void MqttQueueSend(uint32_t budget) {
+  // Send queued messages for up to budget mSeconds but at least one client write
+  if (!MqttQueue.count) { return; }
+  if (!MqttClient.connected()) {
+    AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_MQTT "Queue dropped %d message(s)"), MqttQueue.count);
+    MqttQueueClear();
+    return;
+  }
+  if (!MqttQueue.batch) {
+    MqttQueue.batch = (uint8_t*)malloc(MQTT_QUEUE_BATCH);
+  }
+
+  uint32_t start = millis();
+  do {
+    uint32_t items = 0;
+    uint32_t pos = 0;
+    if (MqttQueue.batch) {
+      while (items < MqttQueue.count) {
+        uint32_t index = (MqttQueue.head + items) % MQTT_QUEUE_SIZE;
+        uint32_t size = MqttQueuePacket(nullptr, index);
+        if (pos + size > MQTT_QUEUE_BATCH) { break; }
+        pos += MqttQueuePacket(MqttQueue.batch + pos, index);
+        items++;
+      }
+    }
+    bool sent;
+    if (items) {
+      sent = (MqttClient.write(MqttQueue.batch, pos) == pos);
+    } else {                                     // Too large for batch
+      MQTT_QUEUE_ITEM *item = &MqttQueue.item[MqttQueue.head];
+      sent = (MqttClient.beginPublish(item->topic, item->length, item->retained) &&
+              (MqttClient.write((const uint8_t*)item->topic + strlen(item->topic) +1, item->length) == item->length) &&
+              MqttClient.endPublish());
+      items = 1;
+    }
+    if (!sent) {
+      AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_MQTT "Queue dropped %d message(s)"), MqttQueue.count);
+      MqttQueueClear();
+      return;
+    }
+    uint32_t now = millis();
+    for (uint32_t i = 0; i < items; i++) {
+      uint32_t latency = now - MqttQueue.item[MqttQueue.head].queued;
+      MqttQueue.latency = (MqttQueue.latency * 7 + latency) / 8;
+      if (latency > MqttQueue.latency_max) { MqttQueue.latency_max = latency; }
+      MqttQueueRemove();
+    }
+    MqttQueue.sent += items;
+    yield();
+  } while (MqttQueue.count && (TimePassedSince(start) < budget));
+}
+
+void MqttQueueFlush(void) {
+  while (MqttQueue.count) {
+    MqttQueueSend(MQTT_QUEUE_BUDGET);
+  }
+}
+
+bool MqttQueueAdd(const char* topic, const char* payload, uint32_t length, bool retained) {
+  // Return false if message needs to be published directly
+#ifdef USE_MQTT_AZURE_IOT
+  return false;                                  // Topics are rewritten by MqttPublishLib()
+#endif  // USE_MQTT_AZURE_IOT
+#ifdef USE_TASMESH
+  if (MESHroleNode()) { return false; }          // Messages are routed over ESP-Now
+#endif  // USE_TASMESH
+  if (!Mqtt.connected || !MqttClient.connected()) { return false; }
+
+  uint32_t tlen = strlen(topic);
+  uint32_t size = tlen +1 + length;
+  if (size > MQTT_QUEUE_MEMORY) {
+    MqttQueueFlush();                            // Keep order
+    return false;
+  }
+
+  uint32_t index = MQTT_QUEUE_SIZE;
+  const char *subtopic = strrchr(topic, '/');
+  subtopic = (subtopic) ? subtopic +1 : topic;
+  if (retained || !strcmp_P(subtopic, PSTR(D_RSLT_STATE)) || !strcmp_P(subtopic, PSTR(D_RSLT_SENSOR))) {
+    // Only the newest message on these topics matters
+    for (uint32_t i = 0; i < MqttQueue.count; i++) {
+      uint32_t j = (MqttQueue.head + i) % MQTT_QUEUE_SIZE;
+      if (!strcmp(MqttQueue.item[j].topic, topic)) {
+        if (MqttQueue.memory - MqttQueue.item[j].length + length <= MQTT_QUEUE_MEMORY) {
+          index = j;                             // Else queue as new message as the older one has to go first to make room
+        }
+        break;
+      }
+    }
+  }
+  if (index < MQTT_QUEUE_SIZE) {
+    MQTT_QUEUE_ITEM *item = &MqttQueue.item[index];
+    char *data = (char*)realloc(item->topic, size);
+    if (!data) {
+      MqttQueueFlush();                          // Keep order
+      return false;
+    }
+    MqttQueue.memory += length - item->length;
+    item->topic = data;
+    MqttQueue.coalesced++;                       // Keeps the time the topic was first queued
+  } else {
+    while ((MqttQueue.count >= MQTT_QUEUE_SIZE) || (MqttQueue.memory + size > MQTT_QUEUE_MEMORY)) {
+      MqttQueueSend(0);                          // Make room
+    }
+    char *data = (char*)malloc(size);
+    if (!data) {
+      MqttQueueFlush();                          // Keep order
+      return false;
+    }
+    index = (MqttQueue.head + MqttQueue.count) % MQTT_QUEUE_SIZE;
+    MqttQueue.item[index].topic = data;
+    MqttQueue.count++;
+    if (MqttQueue.count > MqttQueue.count_max) { MqttQueue.count_max = MqttQueue.count; }
+    MqttQueue.memory += size;
+    MqttQueue.item[index].queued = millis();
+  }
+  MQTT_QUEUE_ITEM *item = &MqttQueue.item[index];
+  memcpy(item->topic, topic, tlen +1);
+  memcpy(item->topic + tlen +1, payload, length);
+  item->length = length;
+  item->retained = retained;
+
+  MqttPublishCmndBlock(topic);
+  return true;
+}
+
+void MqttQueueShow(void) {
+  ResponseAppend_P(PSTR(",\"Queue\":{\"Depth\":%d,\"MaxDepth\":%d,\"Sent\":%d,\"Coalesced\":%d,\"Drops\":%d,\"Latency\":%d,\"MaxLatency\":%d}"),
+    MqttQueue.count, MqttQueue.count_max, MqttQueue.sent, MqttQueue.coalesced, MqttQueue.drops, MqttQueue.latency, MqttQueue.latency_max);
+}
+#endif  // USE_MQTT_QUEUE
+
+/*********************************************************************************************\
+ * Streamed publish
+ *
+ * MqttStreamSink() collects a payload in parts, directly or as ResponseStream sink, and
+ * MqttStreamPublish() sends it as one message. The MQTT header carries the payload length so
+ * the parts are held until the payload is complete, but as a list of chunks and never as one
+ * contiguous buffer. The publish sink and the log receive the payload part by part. Rules are
+ * not processed as they need the whole payload in one string.
+\*********************************************************************************************/
+
+struct MQTT_STREAM_CHUNK {
+  MQTT_STREAM_CHUNK *next;
+  uint32_t length;
+  char data[];
+};
+
+struct {
+  MQTT_STREAM_CHUNK *head = nullptr;
+  MQTT_STREAM_CHUNK *tail = nullptr;
+  uint32_t length = 0;                           // Payload length
+  bool overflow = false;                         // Out of memory, payload incomplete
+} MqttStream;
+
+void MqttStreamClear(void) {
+  while (MqttStream.head) {
+    MQTT_STREAM_CHUNK *chunk = MqttStream.head;
+    MqttStream.head = chunk->next;
+    free(chunk);
+  }
+  MqttStream.tail = nullptr;
+  MqttStream.length = 0;
+  MqttStream.overflow = false;
+}
+
+void MqttStreamSink(const char* data, uint32_t length) {
+  // Append part to streamed payload
+  if (!length || MqttStream.overflow) { return; }
+  MQTT_STREAM_CHUNK *chunk = (MQTT_STREAM_CHUNK*)malloc(sizeof(MQTT_STREAM_CHUNK) + length);
+  if (!chunk) {
+    MqttStream.overflow = true;
+    return;
+  }
+  chunk->next = nullptr;
+  chunk->length = length;
+  memcpy(chunk->data, data, length);
+  if (MqttStream.tail) {
+    MqttStream.tail->next = chunk;
+  } else {
+    MqttStream.head = chunk;
+  }
+  MqttStream.tail = chunk;
+  MqttStream.length += length;
+}
+
+bool MqttStreamPublishLib(const char* topic, bool retained) {
+#if defined(USE_TASMESH) || defined(USE_MQTT_AZURE_IOT)
+  // Mesh and Azure IoT rework the payload and need it in one buffer
+  char* payload = (char*)malloc(MqttStream.length +1);
+  if (!payload) { return false; }
+  uint32_t length = 0;
+  for (MQTT_STREAM_CHUNK *chunk = MqttStream.head; chunk; chunk = chunk->next) {
+    memcpy(payload + length, chunk->data, chunk->length);
+    length += chunk->length;
+  }
+  payload[length] = '\0';
+  bool published = MqttPublishLib(topic, (const uint8_t*)payload, length, retained);
+  free(payload);
+  return published;
+#else
+  MqttPublishCmndBlock(topic);
+
+  if (!MqttClient.beginPublish(topic, MqttStream.length, retained)) {
+    return false;
+  }
+  for (MQTT_STREAM_CHUNK *chunk = MqttStream.head; chunk; chunk = chunk->next) {
+    if (MqttClient.write((const uint8_t*)chunk->data, chunk->length) != chunk->length) {
+      AddLog(LOG_LEVEL_DEBUG, PSTR(D_LOG_MQTT "Message too large"));
+      return false;
+    }
+  }
+  MqttClient.endPublish();
+
+  yield();  // #3313
+  return true;
+#endif  // USE_TASMESH or USE_MQTT_AZURE_IOT
+}
+
+void MqttStreamPublish(const char* topic, bool retained) {
+  // Publish <topic> streamed payload with optional retained and release it
+  SHOW_FREE_MEM(PSTR("MqttStreamPublish"));
+
+  if (MqttStream.overflow) {
+    AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_MQTT "%s dropped, out of memory"), topic);
+    MqttStreamClear();
+    return;
+  }
+
+  if (ResponseStream.publish) {                          // Hand result to command requester like http /cm
+    for (MQTT_STREAM_CHUNK *chunk = MqttStream.head; chunk; chunk = chunk->next) {
+      ResponseStream.publish(chunk->data, chunk->length, (MqttStream.head == chunk), (nullptr == chunk->next));
+    }
+  }
+
+  if (Settings->flag4.mqtt_no_retain) {                   // SetOption104 - Disable all MQTT retained messages, some brokers don't support it: AWS IoT, Losant
+    retained = false;                                    // Some brokers don't support retained, they will disconnect if received
+  }
+
+  bool published = false;
+  if (Settings->flag.mqtt_enabled) {                     // SetOption3 - Enable MQTT
+#ifdef USE_MQTT_QUEUE
+    MqttQueueFlush();                                    // Keep message order
+#endif  // USE_MQTT_QUEUE
+    published = MqttStreamPublishLib(topic, retained);
+  }
+  MqttPublishLog(topic, published, retained, nullptr, 0);  // MQT: stat/tasmota/STATUS0 = {"Status":{"Module":...
+
+  MqttStreamClear();
+}
+
+void MqttStreamPublishPrefixTopic_P(uint32_t prefix, const char* subtopic) {
+  // Publish <prefix>/<device>/<RESULT or <subtopic>> streamed payload no retained, see MqttPublishPayloadPrefixTopic_P()
+  char romram[64];
+  snprintf_P(romram, sizeof(romram), ((prefix > 3) && !Settings->flag.mqtt_response) ? S_RSLT_RESULT : subtopic);  // SetOption4 - Switch between MQTT RESULT or COMMAND
+  UpperCase(romram, romram);
+
+  char stopic[TOPSZ];
+  GetTopic_P(stopic, prefix &3, TasmotaGlobal.mqtt_topic, romram);
+  MqttStreamPublish(stopic, false);
+}
+
+/*********************************************************************************************/
+
 void MqttPublishPayload(const char* topic, const char* payload, uint32_t binary_length, bool retained) {
   // Publish <topic> payload string or binary when binary_length set with optional retained
 
@@ -646,13 +1022,36 @@ void MqttPublishPayload(const char* topic, const char* payload, uint32_t binary_
     binary_length = strlen(payload);
   }
 
+  if (ResponseStream.publish && !binary_data) {
+    ResponseStream.publish(payload, binary_length, true, true);  // Hand result to command requester like http /cm
+  }
+
   if (Settings->flag4.mqtt_no_retain) {                   // SetOption104 - Disable all MQTT retained messages, some brokers don't support it: AWS IoT, Losant
     retained = false;                                    // Some brokers don't support retained, they will disconnect if received
   }
 
   // To lower heap usage the payload is not copied to the heap but used directly
+  bool published = false;
+  if (Settings->flag.mqtt_enabled) {                     // SetOption3 - Enable MQTT
+#ifdef USE_MQTT_QUEUE
+    published = MqttQueueAdd(topic, payload, binary_length, retained);
+#endif  // USE_MQTT_QUEUE
+    if (!published) {
+      published = MqttPublishLib(topic, (const uint8_t*)payload, binary_length, retained);
+    }
+  }
+  if (binary_data) {
+    String log_data_payload = HexToString((uint8_t*)payload, binary_length);
+    MqttPublishLog(topic, published, retained, log_data_payload.c_str(), log_data_payload.length());
+  } else {
+    MqttPublishLog(topic, published, retained, payload, binary_length);
+  }
+}
+
+void MqttPublishLog(const char* topic, bool published, bool retained, const char* payload, uint32_t length) {
+  // Log published payload, or the streamed payload when payload is nullptr
   String log_data_topic;                                 // 20210420 Moved to heap to solve tight stack resulting in exception 2
-  if (Settings->flag.mqtt_enabled && MqttPublishLib(topic, (const uint8_t*)payload, binary_length, retained)) {  // SetOption3 - Enable MQTT
+  if (published) {
 #ifdef USE_TASMESH
     log_data_topic = (MESHroleNode()) ? F("MSH: ") : F(D_LOG_MQTT);  // MSH: or MQT:
 #else
@@ -666,19 +1065,21 @@ void MqttPublishPayload(const char* topic, const char* payload, uint32_t binary_
     retained = false;                                    // Without MQTT enabled there is no retained message
   }
   log_data_topic += F(" = ");                            // =
-  char* log_data_payload = (char*)payload;
-  String log_data_payload_b;
-  if (binary_data) {
-    log_data_payload_b = HexToString((uint8_t*)payload, binary_length);
-    log_data_payload = (char*)log_data_payload_b.c_str();
-  }
   char* log_data_retained = nullptr;
   String log_data_retained_b;
   if (retained) {
     log_data_retained_b = F(" (" D_RETAINED ")");        // (retained)
     log_data_retained = (char*)log_data_retained_b.c_str();
   }
-  AddLogData(LOG_LEVEL_INFO, log_data_topic.c_str(), log_data_payload, log_data_retained);  // MQT: stat/tasmota/STATUS2 = {"StatusFWR":{"Version":...
+  if (payload) {
+    AddLogPayload(LOG_LEVEL_INFO, log_data_topic.c_str(), payload, length, log_data_retained);  // MQT: stat/tasmota/STATUS2 = {"StatusFWR":{"Version":...
+  } else {
+    LogStreamBegin(LOG_LEVEL_INFO, log_data_topic.c_str());
+    for (MQTT_STREAM_CHUNK *chunk = MqttStream.head; chunk; chunk = chunk->next) {
+      LogStreamWrite(chunk->data, chunk->length);
+    }
+    LogStreamEnd(log_data_retained);
+  }
 
   if (Settings->ledstate &0x04) {
     TasmotaGlobal.blinks++;
@@ -886,6 +1287,9 @@ void MqttDisconnected(int state) {
   #define MQTT_CONNECT_UNAUTHORIZED    5
   */
   Mqtt.connected = false;
+#ifdef USE_MQTT_QUEUE
+  MqttQueueClear();
+#endif  // USE_MQTT_QUEUE
 
   Mqtt.retry_counter = Settings->mqtt_retry * Mqtt.retry_counter_delay;
   if ((Settings->mqtt_retry * Mqtt.retry_counter_delay) < 120) {
@@ -1043,6 +1447,9 @@ void MqttReconnect(void) {
   MqttSetClientTimeout();
 
   MqttClient.setCallback(MqttDataHandler);
+#ifndef USE_MQTT_AZURE_IOT
+  MqttClient.setStreamCallback(MqttStreamHandler);
+#endif  // USE_MQTT_AZURE_IOT
 
   // Keep using hostname to solve rc -4 issues
   if (!WifiDnsPresent(SettingsText(SET_MQTT_HOST))) {
@@ -1973,6 +2380,11 @@ bool Xdrv02(uint8_t function)
       case FUNC_EVERY_50_MSECOND:  // https://github.com/knolleary/pubsubclient/issues/556
         MqttClient.loop();
         break;
+#ifdef USE_MQTT_QUEUE
+      case FUNC_LOOP:
+        MqttQueueSend(MQTT_QUEUE_BUDGET);
+        break;
+#endif  // USE_MQTT_QUEUE
 #ifdef USE_WEBSERVER
       case FUNC_WEB_ADD_BUTTON:
         WSContentSend_P(HTTP_BTN_MENU_MQTT);
@@ -285,8 +285,23 @@ static uint32_t min3(uint32_t a, uint32_t b, uint32_t c) {
 }
 
 #ifdef USE_NETWORK_LIGHT_SCHEMES
+#ifndef NETWORK_LIGHT_UNIVERSE
+#define NETWORK_LIGHT_UNIVERSE  1             // First E1.31 or Art-Net universe, each universe holds 170 RGB or 128 RGBW pixels
+#endif
+
+#ifndef NETWORK_LIGHT_MAX_SLEEP
+#define NETWORK_LIGHT_MAX_SLEEP  10           // Max sleep in ms while receiving, frames are shown as they arrive
+#endif
+
+#include <NetLight.h>
+
 WiFiUDP ddp_udp;
 uint8_t ddp_udp_up = 0;
+#if defined(USE_NETWORK_LIGHT_E131) || defined(USE_NETWORK_LIGHT_ARTNET)
+WiFiUDP dmx_udp;
+#endif
+
+NETLIGHT NetLight;
 #endif
 
 //
@@ -1665,6 +1680,111 @@ void LightCycleColor(int8_t direction)
 }
 
 #ifdef USE_NETWORK_LIGHT_SCHEMES
+/*********************************************************************************************\
+ * Network light receiver
+ *
+ * DDP on port 4048, optional E1.31 (sACN) on port 5568 or Art-Net on port 6454 (unicast)
+ * Packets are read in place into the output, frames are shown on DDP PUSH or when the last
+ * universe covering the strip is received
+\*********************************************************************************************/
+
+bool NetLightBegin(const char* scheme) {
+  if (ddp_udp_up) { return true; }
+  if (!ddp_udp.begin(4048)) { return false; }
+#if defined(USE_NETWORK_LIGHT_E131)
+  dmx_udp.begin(5568);
+#elif defined(USE_NETWORK_LIGHT_ARTNET)
+  dmx_udp.begin(6454);
+#endif
+  ddp_udp_up = 1;
+  NetLight.sequence = 0;
+  NetLight.push_seen = false;
+  AddLog(LOG_LEVEL_DEBUG_MORE, "DDP: UDP Listener Started: %s", scheme);
+  return true;
+}
+
+void NetLightStop(const char* reason) {
+  if (!ddp_udp_up) { return; }
+  ddp_udp.stop();
+#if defined(USE_NETWORK_LIGHT_E131) || defined(USE_NETWORK_LIGHT_ARTNET)
+  dmx_udp.stop();
+#endif
+  ddp_udp_up = 0;
+  NetLight.fps = 0;
+  AddLog(LOG_LEVEL_DEBUG_MORE, "DDP: UDP Stopped: %s", reason);
+}
+
+// Selects the next received packet and its protocol, returns false if none
+bool NetLightParsePacket(uint32_t *protocol) {
+  if (ddp_udp.parsePacket()) {
+    *protocol = NETLIGHT_DDP;
+    return true;
+  }
+#if defined(USE_NETWORK_LIGHT_E131) || defined(USE_NETWORK_LIGHT_ARTNET)
+  if (dmx_udp.parsePacket()) {
+#ifdef USE_NETWORK_LIGHT_E131
+    *protocol = NETLIGHT_E131;
+#else
+    *protocol = NETLIGHT_ARTNET;
+#endif
+    return true;
+  }
+#endif
+  return false;
+}
+
+// Reads up to len bytes of the current packet, returns the number of bytes read
+uint32_t NetLightRead(uint32_t protocol, uint8_t *buffer, uint32_t len) {
+#if defined(USE_NETWORK_LIGHT_E131) || defined(USE_NETWORK_LIGHT_ARTNET)
+  WiFiUDP &udp = (NETLIGHT_DDP == protocol) ? ddp_udp : dmx_udp;
+#else
+  WiFiUDP &udp = ddp_udp;
+#endif
+  int read = udp.read(buffer, len);
+  return (read > 0) ? read : 0;
+}
+
+// Reads the header of the current packet leaving the socket at the pixel data
+// channels: bytes per pixel, input for DMX and set from the DDP data type
+// Returns false if the packet carries no pixel data for us
+bool NetLightHeader(uint32_t protocol, uint32_t frame_size, uint32_t *offset, uint32_t *length, uint32_t *channels, bool *push) {
+#if defined(USE_NETWORK_LIGHT_E131) || defined(USE_NETWORK_LIGHT_ARTNET)
+  WiFiUDP &udp = (NETLIGHT_DDP == protocol) ? ddp_udp : dmx_udp;
+#else
+  WiFiUDP &udp = ddp_udp;
+#endif
+  uint8_t header[NETLIGHT_HEADER_MAX];
+  uint32_t read = 0;
+  uint32_t more;
+  while ((more = NetLightHeaderMore(protocol, header, read))) {
+    if (NetLightRead(protocol, header + read, more) != more) { return false; }
+    read += more;
+  }
+  NetLightData data;
+  data.channels = *channels;
+  if (!NetLightDecode(&NetLight, protocol, header, frame_size, NETWORK_LIGHT_UNIVERSE, udp.available(), &data)) { return false; }
+  *offset = data.offset;
+  *length = data.length;
+  *channels = data.channels;
+  *push = data.push;
+  return true;
+}
+
+void NetLightFrame(void) {
+  NetLight.frames++;
+}
+
+void NetLightEverySecond(void) {
+  NetLight.fps = NetLight.frames - NetLight.frames_last;
+  NetLight.frames_last = NetLight.frames;
+}
+
+void NetLightShow(void) {
+  if (!ddp_udp_up) { return; }
+  ResponseAppend_P(PSTR(",\"DDP\":{\"Fps\":%d,\"Frames\":%u,\"Packets\":%u,\"Drops\":%u}"),
+    NetLight.fps, NetLight.frames, NetLight.packets, NetLight.drops);
+}
+
 void LightListenDDP()
 {
   // Light channels gets completely controlled over DDP. So, we don't really check other settings.
@@ -1672,38 +1792,29 @@ void LightListenDDP()
   static uint8_t ddp_color[5] = { 0, 0, 0, 0, 0 };
 
   // Can't be trying to initialize UDP too early.
-  if (TasmotaGlobal.restart_flag || TasmotaGlobal.global_state.network_down) {
-    light_state.setChannels(ddp_color);
-    light_controller.calcLevels(Light.new_color);
-    return;
-  }
-
   // Start DDP listener, if fail, just set last ddp_color
-  if (!ddp_udp_up) {
-    if (!ddp_udp.begin(4048)) {
-      light_state.setChannels(ddp_color);
-      light_controller.calcLevels(Light.new_color);
-      return;
-    }
-    ddp_udp_up = 1;
-    AddLog(LOG_LEVEL_DEBUG_MORE, "DDP: UDP Listener Started: Normal Scheme");
-  }
-
-  // Get the DDP payload over UDP
-  std::vector<uint8_t> payload;
-  while (uint16_t packet_size = ddp_udp.parsePacket()) {
-    payload.resize(packet_size);
-    if (!ddp_udp.read(&payload[0], payload.size())) {
-      continue;
+  if (!TasmotaGlobal.restart_flag && !TasmotaGlobal.global_state.network_down && NetLightBegin("Normal Scheme")) {
+    // Only the first pixel of each frame is used, keep the latest one
+    bool received = false;
+    uint32_t protocol;
+    while (NetLightParsePacket(&protocol)) {
+      uint32_t offset, length;
+      uint32_t channels = 3;
+      bool push;
+      if (!NetLightHeader(protocol, channels, &offset, &length, &channels, &push)) { continue; }  // Frame of a single pixel
+      if ((0 == offset) && (length >= 3)) {
+        uint8_t color[4] = { 0, 0, 0, 0 };
+        uint32_t size = (channels > 3) && (length >= 4) ? 4 : 3;
+        if (NetLightRead(protocol, color, size) == size) {
+          memcpy(ddp_color, color, 4);
+          received = true;
+        }
+      }
+      if (push) { NetLightFrame(); }
     }
+    if (received && !NetLight.push_seen) { NetLightFrame(); }
   }
 
-  // No verification checks performed against packet besides length
-  if (payload.size() > 12) {
-    ddp_color[0] = payload[10];
-    ddp_color[1] = payload[11];
-    ddp_color[2] = payload[12];
-  }
   light_state.setChannels(ddp_color);
   light_controller.calcLevels(Light.new_color);
 }
@@ -1785,18 +1896,12 @@ void LightAnimate(void)
       power_off = true;
     }
 #ifdef USE_NETWORK_LIGHT_SCHEMES
-    if (ddp_udp_up) {
-      ddp_udp.stop();
-      ddp_udp_up = 0;
-      AddLog(LOG_LEVEL_DEBUG_MORE, "DDP: UDP Stopped: Power Off");
-    }
+    NetLightStop("Power Off");
 #endif
   } else {
 #ifdef USE_NETWORK_LIGHT_SCHEMES
-    if ((Settings->light_scheme < LS_MAX) && (Settings->light_scheme != LS_DDP) && (ddp_udp_up)) {
-      ddp_udp.stop();
-      ddp_udp_up = 0;
-      AddLog(LOG_LEVEL_DEBUG_MORE, "DDP: UDP Stopped: Normal Scheme not DDP");
+    if ((Settings->light_scheme < LS_MAX) && (Settings->light_scheme != LS_DDP)) {
+      NetLightStop("Normal Scheme not DDP");
     }
 #endif
     switch (Settings->light_scheme) {
@@ -3381,10 +3486,26 @@ bool Xdrv04(uint8_t function)
             LightSetOutputs(Light.fade_cur_10);
           }
         }
+#ifdef USE_NETWORK_LIGHT_SCHEMES
+        if (ddp_udp_up) {
+          if (TasmotaGlobal.sleep > NETWORK_LIGHT_MAX_SLEEP) {
+            TasmotaGlobal.sleep = NETWORK_LIGHT_MAX_SLEEP;
+          }
+          XlgtCall(FUNC_LOOP);                // Receive frames as they arrive instead of every 50 ms
+        }
+#endif  // USE_NETWORK_LIGHT_SCHEMES
         break;
       case FUNC_EVERY_50_MSECOND:
         LightAnimate();
         break;
+#ifdef USE_NETWORK_LIGHT_SCHEMES
+      case FUNC_EVERY_SECOND:
+        NetLightEverySecond();
+        break;
+      case FUNC_JSON_APPEND:
+        NetLightShow();
+        break;
+#endif  // USE_NETWORK_LIGHT_SCHEMES
 #ifdef USE_DEVICE_GROUPS
       case FUNC_DEVICE_GROUP_ITEM:
         LightHandleDevGroupItem();
@@ -185,6 +185,7 @@ struct RULES {
   bool teleperiod = false;
   bool busy = false;
   bool no_execute = false;   // Don't actually execute rule commands
+  uint8_t compiled = 0;      // Bitmask of rule sets with a valid trigger table
 
   char event_data[100];
 } Rules;
@@ -337,6 +338,7 @@ int32_t SetRule_compress(uint32_t idx, const char *in, size_t in_len, char *out,
 //   <0 : not enough space
 int32_t SetRule(uint32_t idx, const char *content, bool append = false) {
   if (nullptr == content) { content = ""; }   // if nullptr, use empty string
+  bitClear(Rules.compiled, idx);              // Trigger table will be rebuilt on next event
   size_t len_in = strlen(content);
   bool needsCompress = false;
   size_t offset = 0;
@@ -533,35 +535,21 @@ bool RulesRuleMatch(uint8_t rule_set, String &event, String &rule, bool stop_all
     rule_name = rule_name.substring(0, pos);           // "SUBTYPE1#CURRENT"
   }
 
-  String buf = event;                                  // Copy the string into a new buffer that will be modified
+  // Locate "SUBTYPE1#SUBTYPE2#CURRENT" in the event without parsing it as a whole
+  size_t value_len;
+  const char* value_p = JsonParser::findPath(event.c_str(), rule_name.c_str(), '#', &value_len);
+  if (!value_p) { return false; }                      // not found
 
-// Do not do below replace as it will replace escaped quote too.
-//  buf.replace("\\"," ");                               // "Disable" any escaped control character
-
-//AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RM2: RulesRuleMatch |%s|"), buf.c_str());
+  String buf = "[";                                    // Copy only the value into a new buffer that will be modified
+  buf += event.substring(value_p - event.c_str(), value_p - event.c_str() + value_len);
+  buf += "]";                                          // Wrapped as jsmn does not parse a single value
 
   JsonParser parser((char*)buf.c_str());
-  JsonParserObject obj = parser.getRootObject();
-  if (!obj) {
-//    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: Event too long (%d)"), event.length());
+  JsonParserToken val = parser.getRoot().getArray()[0];
+  if (!val) {
     AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: No valid JSON (%s)"), buf.c_str());
     return false; // No valid JSON data
   }
-  String subtype;
-  uint32_t i = 0;
-  while ((pos = rule_name.indexOf(F("#"))) > 0) {      // "SUBTYPE1#SUBTYPE2#CURRENT"
-    subtype = rule_name.substring(0, pos);
-    obj = obj[subtype.c_str()].getObject();
-    if (!obj) { return false; }                        // not found
-
-    rule_name = rule_name.substring(pos +1);
-    if (i++ > 10) { return false; }                    // Abandon possible loop
-
-    yield();
-  }
-
-  JsonParserToken val = obj[rule_name.c_str()];
-  if (!val) { return false; }                          // last level not found
   const char* str_value;
   if (rule_name_idx) {
     if (val.isArray()) {
@@ -713,59 +701,145 @@ void RulesVarReplace(String &commands, const String &sfind, const String &replac
 }
 
 /*******************************************************************************************/
+/*
+ * Compiled rule sets
+ *
+ * Each rule set is parsed once into a table of triggers which is rebuilt when the rule changes.
+ * An event only evaluates the triggers whose first key is one of the event root keys, and the
+ * commands only get the variables they reference substituted.
+ */
+/*******************************************************************************************/
 
-bool RuleSetProcess(uint8_t rule_set, String &event_saved)
-{
-  bool serviced = false;
-  char stemp[10];
+#define RULES_EVENT_KEYS         24       // Max event root keys used to select triggers
+
+const char kRulesVarRefs[] PROGMEM =
+  "VALUE|TIME|UTCTIME|UPTIME|TIMESTAMP|TOPIC|DEVICEID|MACADDR|SUNRISE|SUNSET|COLOR|ZBDEVICE|ZBGROUP|ZBCLUSTER|ZBENDPOINT";
+
+// Bit positions in the variable reference mask after VAR1..16 (0..15), MEM1..16 (16..31) and TIMER1..16 (32..47)
+enum RulesVarRefBits { RULE_REF_VALUE = 48, RULE_REF_TIME, RULE_REF_UTCTIME, RULE_REF_UPTIME, RULE_REF_TIMESTAMP, RULE_REF_TOPIC,
+                    RULE_REF_DEVICEID, RULE_REF_MACADDR, RULE_REF_SUNRISE, RULE_REF_SUNSET, RULE_REF_COLOR,
+                    RULE_REF_ZBDEVICE, RULE_REF_ZBGROUP, RULE_REF_ZBCLUSTER, RULE_REF_ZBENDPOINT };
+
+typedef struct {
+  String trigger;            // "INA219#CURRENT>0.100"
+  String commands;           // "Backlog Dimmer 10;Color 100000"
+  uint64_t refs;             // Bitmask of referenced variables
+  uint32_t key;              // Hash of first key "INA219"
+  uint32_t tele_key;         // Hash of first key during teleperiod "INA219" from "TELE-INA219#CURRENT>0.100"
+  uint8_t index;             // Trigger number in rule set used for Rule once
+  uint8_t stop : 1;          // Trigger ends with BREAK
+  uint8_t wildcard : 1;      // First key is "?"
+  uint8_t tele : 1;          // Trigger contains "TELE-"
+  uint8_t tele_wildcard : 1; // First key is "?" during teleperiod
+} RuleTrigger;
+
+std::vector<RuleTrigger> rules_compiled[MAX_RULE_SETS];
+
+uint32_t RulesKeyHash(const char* key, size_t len) {
+  uint32_t hash = 2166136261;               // FNV-1a
+  while (len--) {
+    hash ^= (uint8_t)*key++;
+    hash *= 16777619;
+  }
+  return hash;
+}
 
-  delay(0);                                               // Prohibit possible loop software watchdog
+// Hash of the first key looked up by RulesRuleMatch() for trigger expression "INA219#CURRENT[1]>0.100"
+uint32_t RulesTriggerKey(String expr, bool &wildcard) {
+  String name, param;
+  parseCompareExpression(expr, name, param);           // "INA219#CURRENT[1]"
+  int pos = name.indexOf(F("["));
+  if (pos > 0) { name = name.substring(0, pos); }      // "INA219#CURRENT"
+  pos = name.indexOf(F("#"));
+  if (pos >= 0) { name = name.substring(0, pos); }     // "INA219"
+  wildcard = name.equals(F("?"));
+  return RulesKeyHash(name.c_str(), name.length());
+}
 
-#ifdef DEBUG_RULES
-  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RP1: Event = %s, Rule = %s"), event_saved.c_str(), Settings->rules[rule_set]);
-#endif
+// Returns a superset of the variables referenced by commands like "Power %var1%"
+uint64_t RulesVarRefs(const char* commands) {
+  uint64_t refs = 0;
+  char token[12];
+  char stemp[sizeof("ZBENDPOINT")];        // Longest entry in kRulesVarRefs
+  const char* p = commands;
+  while ((p = strchr(p, '%')) != nullptr) {
+    p++;
+    const char* end = strchr(p, '%');
+    if (!end) { break; }
+    size_t len = end - p;
+    if ((len > 0) && (len < sizeof(token))) {
+      memcpy(token, p, len);
+      token[len] = '\0';
+      int index = GetCommandCode(stemp, sizeof(stemp), token, kRulesVarRefs);
+      if (index >= 0) {
+        refs |= 1ULL << (RULE_REF_VALUE + index);
+      } else {
+        uint32_t offset = 0;
+        uint32_t max = 0;
+        if (!strncasecmp_P(token, PSTR("VAR"), 3)) { max = MAX_RULE_VARS; }
+        else if (!strncasecmp_P(token, PSTR("MEM"), 3)) { offset = 16; max = MAX_RULE_MEMS; }
+        else if (!strncasecmp_P(token, PSTR("TIMER"), 5)) { offset = 32; max = MAX_TIMERS; }
+        if (max) {
+          uint32_t i = atoi(token + ((32 == offset) ? 5 : 3));
+          snprintf_P(stemp, sizeof(stemp), PSTR("%d"), i);
+          if ((i > 0) && (i <= max) && !strcmp(stemp, token + ((32 == offset) ? 5 : 3))) {
+            refs |= 1ULL << (offset + i -1);
+          }
+        }
+      }
+    }
+    p = end;                                           // Closing % may start the next variable
+  }
+  return refs;
+}
+
+// Substitute a variable and pick up the variables its value may introduce, as the full substitution did
+void RulesVarReplaceRef(String &commands, uint64_t &refs, const String &sfind, const String &replace) {
+  RulesVarReplace(commands, sfind, replace);
+  if (replace.indexOf('%') >= 0) {
+    refs |= RulesVarRefs(commands.c_str());
+  }
+}
+
+void RulesCompile(uint32_t rule_set) {
+  std::vector<RuleTrigger> &compiled = rules_compiled[rule_set];
+  compiled.clear();
+  bitSet(Rules.compiled, rule_set);
+  if (!GetRuleLen(rule_set)) { return; }
 
   String rules = GetRule(rule_set);
 
-  Rules.trigger_count[rule_set] = 0;
+  uint32_t index = 0;
   int plen = 0;
   int plen2 = 0;
-  bool stop_all_rules = false;
   while (true) {
     rules = rules.substring(plen);                        // Select relative to last rule
     rules.trim();
-    if (!rules.length()) { return serviced; }             // No more rules
+    if (!rules.length()) { break; }                       // No more rules
 
     String rule = rules;
     rule.toUpperCase();                                   // "ON INA219#CURRENT>0.100 DO BACKLOG DIMMER 10;COLOR 100000 ENDON"
-    if (!rule.startsWith(F("ON "))) { return serviced; }     // Bad syntax - Nothing to start on
+    if (!rule.startsWith(F("ON "))) { break; }            // Bad syntax - Nothing to start on
 
     int pevt = rule.indexOf(F(" DO "));
-    if (pevt == -1) { return serviced; }                  // Bad syntax - Nothing to do
+    if (pevt == -1) { break; }                            // Bad syntax - Nothing to do
     String event_trigger = rule.substring(3, pevt);       // "INA219#CURRENT>0.100"
     event_trigger.trim();
 
     plen = rule.indexOf(F(" ENDON"));
     plen2 = rule.indexOf(F(" BREAK"));
-    if ((plen == -1) && (plen2 == -1)) { return serviced; } // Bad syntax - No ENDON neither BREAK
+    if ((plen == -1) && (plen2 == -1)) { break; }         // Bad syntax - No ENDON neither BREAK
 
     if (plen == -1) { plen = 9999; }
     if (plen2 == -1) { plen2 = 9999; }
     plen = tmin(plen, plen2);
 
-    String commands = rules.substring(pevt +4, plen);     // "Backlog Dimmer 10;Color 100000"
-    Rules.event_value = "";
-    String event = event_saved;
-
-#ifdef DEBUG_RULES
-    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RP2: Event |%s|, Rule |%s|, Command(s) |%s|"), event.c_str(), event_trigger.c_str(), commands.c_str());
-#endif
-
-    if (!event_trigger.startsWith(F("FILE#")) && RulesRuleMatch(rule_set, event, event_trigger, stop_all_rules)) {
-      if (Rules.no_execute) return true;
-      if (plen == plen2) { stop_all_rules = true; }       // If BREAK was used on a triggered rule, Stop execution of this rule set
-      commands.trim();
-      String ucommand = commands;
+    if (!event_trigger.startsWith(F("FILE#"))) {          // File triggers only hold data for RuleLoadFile()
+      RuleTrigger trigger;
+      trigger.trigger = event_trigger;
+      trigger.commands = rules.substring(pevt +4, plen);  // "Backlog Dimmer 10;Color 100000"
+      trigger.commands.trim();
+      String ucommand = trigger.commands;
       ucommand.toUpperCase();
 
 //      if (!ucommand.startsWith("BACKLOG")) { commands = "backlog " + commands; }  // Always use Backlog to prevent power race exception
@@ -773,52 +847,131 @@ bool RuleSetProcess(uint8_t rule_set, String &event_saved)
       if ((ucommand.indexOf(F("IF ")) == -1) &&
           (ucommand.indexOf(F("EVENT ")) != -1) &&
           (ucommand.indexOf(F("BACKLOG")) == -1)) {
-        commands = String(F("backlog ")) + commands;
+        trigger.commands = String(F("backlog ")) + trigger.commands;
+      }
+      trigger.refs = RulesVarRefs(trigger.commands.c_str());
+      trigger.index = index;
+      trigger.stop = (plen == plen2);
+      bool wildcard;
+      trigger.key = RulesTriggerKey(event_trigger, wildcard);
+      trigger.wildcard = wildcard;
+      trigger.tele = (event_trigger.indexOf(F("TELE-")) != -1);
+      trigger.tele_key = (trigger.tele) ? RulesTriggerKey(event_trigger.substring(5), wildcard) : 0;
+      trigger.tele_wildcard = (trigger.tele) ? wildcard : false;
+      compiled.push_back(trigger);
+    }
+    plen += 6;
+    index++;
+  }
+
+#ifdef DEBUG_RULES
+  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: Rule%d compiled %d of %d triggers"), rule_set +1, compiled.size(), index);
+#endif
+}
+
+/*******************************************************************************************/
+
+bool RuleSetProcess(uint8_t rule_set, String &event_saved, const uint32_t *event_keys, uint32_t event_key_count)
+{
+  bool serviced = false;
+  char stemp[10];
+
+  delay(0);                                               // Prohibit possible loop software watchdog
+
+#ifdef DEBUG_RULES
+  AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RP1: Event = %s, Rule = %s"), event_saved.c_str(), Settings->rules[rule_set]);
+#endif
+
+  if (!bitRead(Rules.compiled, rule_set)) {
+    RulesCompile(rule_set);
+  }
+
+  bool stop_all_rules = false;
+  for (uint32_t t = 0; t < rules_compiled[rule_set].size(); t++) {
+    RuleTrigger &trigger = rules_compiled[rule_set][t];
+
+    // Only triggers looking up one of the event root keys can match, nullptr event_keys selects all
+    if (event_keys) {
+      bool wildcard = (Rules.teleperiod) ? trigger.tele_wildcard : trigger.wildcard;
+      if (!wildcard) {
+        if (Rules.teleperiod && !trigger.tele) { continue; }
+        uint32_t key = (Rules.teleperiod) ? trigger.tele_key : trigger.key;
+        uint32_t i = 0;
+        while ((i < event_key_count) && (event_keys[i] != key)) { i++; }
+        if (i == event_key_count) { continue; }          // Key not in event
       }
+    }
+
+    Rules.trigger_count[rule_set] = trigger.index;
+    Rules.event_value = "";
+
+#ifdef DEBUG_RULES
+    AddLog(LOG_LEVEL_DEBUG, PSTR("RUL-RP2: Event |%s|, Rule |%s|, Command(s) |%s|"), event_saved.c_str(), trigger.trigger.c_str(), trigger.commands.c_str());
+#endif
 
-      RulesVarReplace(commands, F("%VALUE%"), Rules.event_value);
+    if (RulesRuleMatch(rule_set, event_saved, trigger.trigger, stop_all_rules)) {
+      if (Rules.no_execute) return true;
+      if (trigger.stop) { stop_all_rules = true; }        // If BREAK was used on a triggered rule, Stop execution of this rule set
+
+      String commands = trigger.commands;
+      uint64_t refs = trigger.refs;
+      if (bitRead(refs, RULE_REF_VALUE)) {
+        RulesVarReplaceRef(commands, refs, F("%VALUE%"), Rules.event_value);
+      }
       for (uint32_t i = 0; i < MAX_RULE_VARS; i++) {
-        snprintf_P(stemp, sizeof(stemp), PSTR("%%VAR%d%%"), i +1);
-        RulesVarReplace(commands, stemp, rules_vars[i]);
+        if (bitRead(refs, i)) {
+          snprintf_P(stemp, sizeof(stemp), PSTR("%%VAR%d%%"), i +1);
+          RulesVarReplaceRef(commands, refs, stemp, rules_vars[i]);
+        }
       }
       for (uint32_t i = 0; i < MAX_RULE_MEMS; i++) {
-        snprintf_P(stemp, sizeof(stemp), PSTR("%%MEM%d%%"), i +1);
-        RulesVarReplace(commands, stemp, SettingsText(SET_MEM1 +i));
+        if (bitRead(refs, 16 + i)) {
+          snprintf_P(stemp, sizeof(stemp), PSTR("%%MEM%d%%"), i +1);
+          RulesVarReplaceRef(commands, refs, stemp, SettingsText(SET_MEM1 +i));
+        }
+      }
+      if (bitRead(refs, RULE_REF_TIME)) { RulesVarReplace(commands, F("%TIME%"), String(MinutesPastMidnight())); }
+      if (bitRead(refs, RULE_REF_UTCTIME)) { RulesVarReplace(commands, F("%UTCTIME%"), String(UtcTime())); }
+      if (bitRead(refs, RULE_REF_UPTIME)) { RulesVarReplace(commands, F("%UPTIME%"), String(MinutesUptime())); }
+      if (bitRead(refs, RULE_REF_TIMESTAMP)) { RulesVarReplace(commands, F("%TIMESTAMP%"), GetDateAndTime(DT_LOCAL)); }
+      if (bitRead(refs, RULE_REF_TOPIC)) { RulesVarReplaceRef(commands, refs, F("%TOPIC%"), TasmotaGlobal.mqtt_topic); }
+      if (bitRead(refs, RULE_REF_DEVICEID)) {
+        snprintf_P(stemp, sizeof(stemp), PSTR("%06X"), ESP_getChipId());
+        RulesVarReplace(commands, F("%DEVICEID%"), stemp);
       }
-      RulesVarReplace(commands, F("%TIME%"), String(MinutesPastMidnight()));
-      RulesVarReplace(commands, F("%UTCTIME%"), String(UtcTime()));
-      RulesVarReplace(commands, F("%UPTIME%"), String(MinutesUptime()));
-      RulesVarReplace(commands, F("%TIMESTAMP%"), GetDateAndTime(DT_LOCAL));
-      RulesVarReplace(commands, F("%TOPIC%"), TasmotaGlobal.mqtt_topic);
-      snprintf_P(stemp, sizeof(stemp), PSTR("%06X"), ESP_getChipId());
-      RulesVarReplace(commands, F("%DEVICEID%"), stemp);
-      RulesVarReplace(commands, F("%MACADDR%"), NetworkUniqueId());
+      if (bitRead(refs, RULE_REF_MACADDR)) { RulesVarReplace(commands, F("%MACADDR%"), NetworkUniqueId()); }
 #if defined(USE_TIMERS)
       for (uint32_t i = 0; i < MAX_TIMERS; i++) {
-        snprintf_P(stemp, sizeof(stemp), PSTR("%%TIMER%d%%"), i +1);
-        RulesVarReplace(commands, stemp, String(TimerGetTimeOfDay(i)));
+        if (bitRead(refs, 32 + i)) {
+          snprintf_P(stemp, sizeof(stemp), PSTR("%%TIMER%d%%"), i +1);
+          RulesVarReplace(commands, stemp, String(TimerGetTimeOfDay(i)));
+        }
       }
 #if defined(USE_SUNRISE)
-      RulesVarReplace(commands, F("%SUNRISE%"), String(SunMinutes(0)));
-      RulesVarReplace(commands, F("%SUNSET%"), String(SunMinutes(1)));
+      if (bitRead(refs, RULE_REF_SUNRISE)) { RulesVarReplace(commands, F("%SUNRISE%"), String(SunMinutes(0))); }
+      if (bitRead(refs, RULE_REF_SUNSET)) { RulesVarReplace(commands, F("%SUNSET%"), String(SunMinutes(1))); }
 #endif  // USE_SUNRISE
 #endif  // USE_TIMERS
 #if defined(USE_LIGHT)
-      char scolor[LIGHT_COLOR_SIZE];
-      RulesVarReplace(commands, F("%COLOR%"), LightGetColor(scolor));
+      if (bitRead(refs, RULE_REF_COLOR)) {
+        char scolor[LIGHT_COLOR_SIZE];
+        RulesVarReplace(commands, F("%COLOR%"), LightGetColor(scolor));
+      }
 #endif
 #ifdef USE_ZIGBEE
-      snprintf_P(stemp, sizeof(stemp), PSTR("0x%04X"), Z_GetLastDevice());
-      RulesVarReplace(commands, F("%ZBDEVICE%"), String(stemp));
-      RulesVarReplace(commands, F("%ZBGROUP%"), String(Z_GetLastGroup()));
-      RulesVarReplace(commands, F("%ZBCLUSTER%"), String(Z_GetLastCluster()));
-      RulesVarReplace(commands, F("%ZBENDPOINT%"), String(Z_GetLastEndpoint()));
+      if (bitRead(refs, RULE_REF_ZBDEVICE)) {
+        snprintf_P(stemp, sizeof(stemp), PSTR("0x%04X"), Z_GetLastDevice());
+        RulesVarReplace(commands, F("%ZBDEVICE%"), String(stemp));
+      }
+      if (bitRead(refs, RULE_REF_ZBGROUP)) { RulesVarReplace(commands, F("%ZBGROUP%"), String(Z_GetLastGroup())); }
+      if (bitRead(refs, RULE_REF_ZBCLUSTER)) { RulesVarReplace(commands, F("%ZBCLUSTER%"), String(Z_GetLastCluster())); }
+      if (bitRead(refs, RULE_REF_ZBENDPOINT)) { RulesVarReplace(commands, F("%ZBENDPOINT%"), String(Z_GetLastEndpoint())); }
 #endif
 
       char command[commands.length() +1];
       strlcpy(command, commands.c_str(), sizeof(command));
 
-      AddLog(LOG_LEVEL_INFO, PSTR("RUL: %s performs \"%s\""), event_trigger.c_str(), command);
+      AddLog(LOG_LEVEL_INFO, PSTR("RUL: %s performs \"%s\""), trigger.trigger.c_str(), command);
 
 //      Response_P(S_JSON_COMMAND_SVALUE, D_CMND_RULE, D_JSON_INITIATED);
 //      MqttPublishPrefixTopic_P(RESULT_OR_STAT, PSTR(D_CMND_RULE));
@@ -829,8 +982,6 @@ bool RuleSetProcess(uint8_t rule_set, String &event_saved)
       ExecuteCommand(command, SRC_RULE);
       serviced = true;
     }
-    plen += 6;
-    Rules.trigger_count[rule_set]++;
   }
   return serviced;
 }
@@ -901,9 +1052,19 @@ bool RulesProcessEvent(const char *json_event)
   AddLog(LOG_LEVEL_DEBUG, PSTR("RUL: Event |%s|"), event_saved.c_str());
 #endif
 
+  // Collect the event root keys used to select the triggers to evaluate
+  uint32_t event_keys[RULES_EVENT_KEYS];
+  uint32_t event_key_count = 0;
+  size_t key_len;
+  const char* key = JsonParser::nextKey(event_saved.c_str(), nullptr, &key_len);
+  while (key && (event_key_count < RULES_EVENT_KEYS)) {
+    event_keys[event_key_count++] = RulesKeyHash(key, key_len);
+    key = JsonParser::nextKey(event_saved.c_str(), key, &key_len);
+  }
+
   for (uint32_t i = 0; i < MAX_RULE_SETS; i++) {
     if (GetRuleLen(i) && bitRead(Settings->rule_enabled, i)) {
-      if (RuleSetProcess(i, event_saved)) { serviced = true; }
+      if (RuleSetProcess(i, event_saved, (key) ? nullptr : event_keys, event_key_count)) { serviced = true; }  // Evaluate all triggers if too many keys
     }
   }
 
@@ -63,6 +63,15 @@ keywords if then else endif, or, and are better readable for beginners (others m
 #ifndef SCRIPT_CMDMEM
 #define SCRIPT_CMDMEM 512
 #endif
+
+// number of cached variable references in script text, 0 = resolve names on every access
+#ifndef SCRIPT_VAR_CACHE
+#ifdef ESP32
+#define SCRIPT_VAR_CACHE 256
+#else
+#define SCRIPT_VAR_CACHE 64
+#endif
+#endif
 #define MAX_SCRIPT_CMDBUFFER 4096
 
 
@@ -385,6 +394,13 @@ struct GVARS {
   int16_t strind;
 };
 
+// variable reference resolved at a position in script text
+struct SCRIPT_VCACHE {
+  char *pos;          // start of name in script text
+  uint8_t var;        // global var index or VAR_NV if name is no variable
+  uint8_t len;        // name length including array index
+};
+
 #ifdef USE_SCRIPT_SPI
 struct SCRIPT_SPI {
   int8_t sclk;
@@ -427,6 +443,7 @@ struct SCRIPT_MEM {
     char *scriptptr_bu;
     char *script_ram;
     uint16_t script_size;
+    struct SCRIPT_VCACHE *vcache;
     uint8_t *script_pram;
     uint16_t script_pram_size;
     uint8_t numvars;
@@ -835,6 +852,8 @@ char *script;
     // number and number shadow vars
     (sizeof(float)*nvars) +
     (sizeof(float)*nvars) +
+    // resolved var references
+    (sizeof(struct SCRIPT_VCACHE)*SCRIPT_VAR_CACHE) +
     // var names
     (vnames_p-vnames) +
     // vars offsets
@@ -874,6 +893,10 @@ char *script;
     memcpy(script_mem, fvalues, size);
     script_mem += size;
 
+    // var reference cache, starts empty
+    glob_script_mem.vcache = SCRIPT_VAR_CACHE ? (struct SCRIPT_VCACHE*)script_mem : 0;
+    script_mem += sizeof(struct SCRIPT_VCACHE) * SCRIPT_VAR_CACHE;
+
     glob_script_mem.mfilt = (struct M_FILT*)script_mem;
     script_mem += fsize;
 
@@ -935,6 +958,7 @@ char *script;
         index++;
         if (index > MAXVNSIZ) {
           free(glob_script_mem.script_mem);
+          glob_script_mem.vcache = 0;
           if (imemptr) free(imemptr);
           if (strings_op) free(strings_op);
           return -5;
@@ -2009,6 +2033,14 @@ float fvar;
   return lp;
 }
 
+// returns the cache slot for a name at lp, or 0 if lp is not in script text
+struct SCRIPT_VCACHE *Script_VarCache(char *lp) {
+  if (!glob_script_mem.vcache) return 0;
+  if (lp < glob_script_mem.script_ram || lp >= glob_script_mem.script_ram + glob_script_mem.script_size) return 0;
+  uint32_t offset = lp - glob_script_mem.script_ram;
+  return &glob_script_mem.vcache[(offset * 2654435761UL >> 16) % SCRIPT_VAR_CACHE];
+}
+
 // vtype => ff=nothing found, fe=constant number,fd = constant string else bit 7 => 80 = string, 0 = number
 // no flash strings here for performance reasons!!!
 char *isvar(char *lp, uint8_t *vtype, struct T_INDEX *tind, float *fp, char *sp, struct GVARS *gv) {
@@ -2082,15 +2114,24 @@ char *isvar(char *lp, uint8_t *vtype, struct T_INDEX *tind, float *fp, char *sp,
       lp++;
     }
 
-    const char *term="\n\r ])=+-/*%><!^&|}{";
-    for (count = 0; count < sizeof(vname); count++) {
-        char iob = lp[count];
-        if (!iob || strchr(term, iob)) {
-            vname[count] = 0;
-            break;
-        }
-        vname[count] = iob;
-        len += 1;
+    // names in script text are resolved once, later accesses reuse the slot
+    struct SCRIPT_VCACHE *vc = Script_VarCache(lp);
+    if (vc && vc->pos == lp) {
+      len = vc->len;
+      memcpy(vname, lp, len);
+      vname[len] = 0;
+    } else {
+      const char *term="\n\r ])=+-/*%><!^&|}{";
+      for (count = 0; count < sizeof(vname); count++) {
+          char iob = lp[count];
+          if (!iob || strchr(term, iob)) {
+              vname[count] = 0;
+              break;
+          }
+          vname[count] = iob;
+          len += 1;
+      }
+      if (len >= sizeof(vname)) vc = 0;
     }
 
     if (!vname[0]) {
@@ -2117,11 +2158,29 @@ char *isvar(char *lp, uint8_t *vtype, struct T_INDEX *tind, float *fp, char *sp,
     }
 
     glob_script_mem.arres = 0;
-    for (count = 0; count < glob_script_mem.numvars; count++) {
+    uint16_t first = 0;
+    uint16_t last = glob_script_mem.numvars;
+    if (vc) {
+      if (vc->pos == lp) {
+        if (vc->var == VAR_NV) {
+          last = 0;             // known to be no variable
+        } else {
+          first = vc->var;      // verified by name compare below
+        }
+      } else {
+        vc->pos = 0;
+      }
+    }
+    for (count = first; count < last; count++) {
         char *cp = glob_script_mem.glob_vnp + glob_script_mem.vnp_offset[count];
         uint8_t slen = strlen(cp);
         if (slen == olen && *cp == dvnam[0]) {
             if (!strncmp(cp, dvnam, olen)) {
+                if (vc && !vc->pos && !(ja && !vtp[count].bits.is_string && !vtp[count].bits.is_filter)) {
+                  vc->pos = lp;
+                  vc->var = count;
+                  vc->len = len;
+                }
                 uint8_t index = vtp[count].index;
                 *tind = vtp[count];
                 tind->index = count; // overwrite with global var index
@@ -2152,6 +2211,11 @@ char *isvar(char *lp, uint8_t *vtype, struct T_INDEX *tind, float *fp, char *sp,
             }
         }
     }
+    if (vc && !vc->pos) {
+      vc->pos = lp;
+      vc->var = VAR_NV;
+      vc->len = len;
+    }
 
 #define USE_SCRIPT_JSON
 //#define USE_SCRIPT_FULL_JSON_PARSER
@@ -7232,6 +7296,7 @@ void SaveScriptEnd(void) {
     free(glob_script_mem.script_mem);
     glob_script_mem.script_mem = 0;
     glob_script_mem.script_mem_size = 0;
+    glob_script_mem.vcache = 0;
   }
 
   if (bitRead(Settings->rule_enabled, 0)) {
@@ -897,6 +897,47 @@ typedef struct Z_Deferred {
   Z_DeviceTimer         func;           // function to call when timer occurs
 } Z_Deferred;
 
+/*********************************************************************************************\
+ * Hash index over the list of devices
+ *
+ * Three open addressing tables of pointers to Z_Device, by shortaddr, longaddr and friendlyName
+ * (case insensitive). Entries are added when a device is created, any other change marks
+ * the index as stale and it is rebuilt from the list at the next lookup.
+ * If a key is shared by several devices, the first one in the list wins like with a linear scan.
+\*********************************************************************************************/
+class Z_DeviceIndex {
+public:
+  Z_DeviceIndex() {};
+  ~Z_DeviceIndex() { free(_slots); }
+  Z_DeviceIndex(const Z_DeviceIndex &) = delete;            // owns _slots
+  Z_DeviceIndex & operator=(const Z_DeviceIndex &) = delete;
+
+  inline void invalidate(void) { _stale = true; }
+  void add(Z_Device * device);                              // a device was appended to the list
+  bool ready(const LList<Z_Device> & devices);              // rebuild if needed, false if no memory
+
+  Z_Device * findShortAddr(uint16_t shortaddr) const;
+  Z_Device * findLongAddr(uint64_t longaddr) const;
+  Z_Device * findFriendlyName(const char * name) const;
+
+protected:
+  void insert(Z_Device * device);
+
+  static inline uint32_t hashShortAddr(uint16_t shortaddr) { return hashMix(shortaddr); }
+  static inline uint32_t hashLongAddr(uint64_t longaddr) { return hashMix((uint32_t)longaddr ^ (uint32_t)(longaddr >> 32)); }
+  static uint32_t hashName(const char * name);
+  static inline uint32_t hashMix(uint32_t h) { h *= 0x9E3779B1; return h ^ (h >> 16); }
+
+  inline Z_Device ** shortSlots(void) const { return _slots; }
+  inline Z_Device ** longSlots(void) const { return _slots + _size; }
+  inline Z_Device ** nameSlots(void) const { return _slots + 2 * _size; }
+
+  Z_Device **   _slots = nullptr;   // 3 tables of `_size` entries, nullptr is an empty slot
+  uint16_t      _size = 0;          // power of 2
+  uint16_t      _count = 0;         // number of devices indexed
+  bool          _stale = true;      // needs to be rebuilt from the list
+};
+
 /*********************************************************************************************\
  * Singleton for device configuration
 \*********************************************************************************************/
@@ -928,7 +969,7 @@ public:
   // check if a device was found or if it's the fallback device
   inline bool foundDevice(const Z_Device & device) const { return device.valid(); }
 
-  int32_t findFriendlyName(const char * name) const;
+  const Z_Device & findFriendlyName(const char * name) const;
   uint64_t getDeviceLongAddr(uint16_t shortaddr) const;
 
   uint8_t findFirstEndpoint(uint16_t shortaddr) const;
@@ -990,6 +1031,9 @@ public:
   void clearDeviceRouterInfo(void);           // reset all router flags, done just before ZbMap
   bool removeDevice(uint16_t shortaddr);
 
+  // A key (shortaddr, longaddr or friendlyName) of a device changed, rebuild index at next lookup
+  inline void indexChanged(void) { _index.invalidate(); }
+
   // Mark data as 'dirty' and requiring to save in Flash
   void dirty(void);
   void clean(void);   // avoid writing to flash the last changes
@@ -1001,6 +1045,7 @@ public:
 
 private:
   LList<Z_Device>           _devices;     // list of devices
+  mutable Z_DeviceIndex     _index;       // hash index over _devices, rebuilt lazily from const lookups
   LList<Z_Deferred>         _deferred;    // list of deferred calls
   uint32_t                  _saveTimer = 0;
   uint8_t                   _seqnumber = 0;     // global seqNumber if device is unknown
@@ -1021,7 +1066,7 @@ extern "C" int32_t callBerryZigbeeDispatcher(const char* cmd, const char* type,
 /*********************************************************************************************\
  * Singleton variable
 \*********************************************************************************************/
-Z_Devices zigbee_devices = Z_Devices();
+Z_Devices zigbee_devices;
 
 // Following device is used represent the unknown device, with all defaults
 // Any find() function will not return Null, instead it will return this instance
@@ -41,6 +41,7 @@ Z_Device & Z_Devices::createDeviceEntry(uint16_t shortaddr, uint64_t longaddr) {
   Z_Device & device = _devices.addToLast();
   device.shortaddr = shortaddr;
   device.longaddr = longaddr;
+  _index.add(&device);
 
   dirty();
   return device;
@@ -53,6 +54,106 @@ void Z_Devices::freeDeviceEntry(Z_Device *device) {
   free(device);
 }
 
+/*********************************************************************************************\
+ * Z_DeviceIndex
+\*********************************************************************************************/
+uint32_t Z_DeviceIndex::hashName(const char * name) {
+  // FNV-1a, case insensitive
+  uint32_t h = 2166136261;
+  while (*name) {
+    h ^= (uint8_t) tolower(*name++);
+    h *= 16777619;
+  }
+  return h;
+}
+
+// insert all keys of a device, unless the key is already indexed by a previous device
+void Z_DeviceIndex::insert(Z_Device * device) {
+  const uint32_t mask = _size - 1;
+  uint32_t i;
+
+  Z_Device ** slots = shortSlots();
+  for (i = hashShortAddr(device->shortaddr) & mask; slots[i]; i = (i + 1) & mask) {
+    if (slots[i]->shortaddr == device->shortaddr) { break; }
+  }
+  if (!slots[i]) { slots[i] = device; }
+
+  if (device->longaddr) {
+    slots = longSlots();
+    for (i = hashLongAddr(device->longaddr) & mask; slots[i]; i = (i + 1) & mask) {
+      if (slots[i]->longaddr == device->longaddr) { break; }
+    }
+    if (!slots[i]) { slots[i] = device; }
+  }
+
+  if (device->friendlyName && device->friendlyName[0]) {
+    slots = nameSlots();
+    for (i = hashName(device->friendlyName) & mask; slots[i]; i = (i + 1) & mask) {
+      if (strcasecmp(slots[i]->friendlyName, device->friendlyName) == 0) { break; }
+    }
+    if (!slots[i]) { slots[i] = device; }
+  }
+  _count++;
+}
+
+void Z_DeviceIndex::add(Z_Device * device) {
+  // keep load factor below 2/3, otherwise grow at next lookup
+  if (_stale || (_count + 1) * 3 > _size * 2) {
+    _stale = true;
+    return;
+  }
+  insert(device);
+}
+
+bool Z_DeviceIndex::ready(const LList<Z_Device> & devices) {
+  if (!_stale) { return true; }
+  size_t len = devices.length();
+  uint32_t size = 16;
+  while (size * 2 < len * 3) { size <<= 1; }
+
+  if (size != _size) {
+    free(_slots);
+    _size = 0;
+    _slots = (Z_Device**) malloc(3 * size * sizeof(Z_Device*));
+    if (!_slots) { return false; }      // stay stale, callers fall back to a linear scan
+    _size = size;
+  }
+  memset(_slots, 0, 3 * _size * sizeof(Z_Device*));
+  _count = 0;
+  for (auto & elem : devices) {
+    insert((Z_Device*) &elem);
+  }
+  _stale = false;
+  return true;
+}
+
+Z_Device * Z_DeviceIndex::findShortAddr(uint16_t shortaddr) const {
+  const uint32_t mask = _size - 1;
+  Z_Device ** slots = shortSlots();
+  for (uint32_t i = hashShortAddr(shortaddr) & mask; slots[i]; i = (i + 1) & mask) {
+    if (slots[i]->shortaddr == shortaddr) { return slots[i]; }
+  }
+  return nullptr;
+}
+
+Z_Device * Z_DeviceIndex::findLongAddr(uint64_t longaddr) const {
+  const uint32_t mask = _size - 1;
+  Z_Device ** slots = longSlots();
+  for (uint32_t i = hashLongAddr(longaddr) & mask; slots[i]; i = (i + 1) & mask) {
+    if (slots[i]->longaddr == longaddr) { return slots[i]; }
+  }
+  return nullptr;
+}
+
+Z_Device * Z_DeviceIndex::findFriendlyName(const char * name) const {
+  const uint32_t mask = _size - 1;
+  Z_Device ** slots = nameSlots();
+  for (uint32_t i = hashName(name) & mask; slots[i]; i = (i + 1) & mask) {
+    if (strcasecmp(slots[i]->friendlyName, name) == 0) { return slots[i]; }
+  }
+  return nullptr;
+}
+
 //
 // Scan all devices to find a corresponding shortaddr
 // Looks info device.shortaddr entry
@@ -62,12 +163,13 @@ void Z_Devices::freeDeviceEntry(Z_Device *device) {
 //    reference to device, or to device_unk if not found
 //    (use foundDevice() to check if found)
 Z_Device & Z_Devices::findShortAddr(uint16_t shortaddr) {
-  for (auto & elem : _devices) {
-    if (elem.shortaddr == shortaddr) { return elem; }
-  }
-  return device_unk;
+  return (Z_Device &) ((const Z_Devices*)this)->findShortAddr(shortaddr);
 }
 const Z_Device & Z_Devices::findShortAddr(uint16_t shortaddr) const {
+  if (_index.ready(_devices)) {
+    Z_Device * device = _index.findShortAddr(shortaddr);
+    return device ? *device : device_unk;
+  }
   for (const auto & elem : _devices) {
     if (elem.shortaddr == shortaddr) { return elem; }
   }
@@ -79,17 +181,17 @@ const Z_Device & Z_Devices::findShortAddr(uint16_t shortaddr) const {
 // In:
 //    longaddr (non null)
 // Out:
-//    index in _devices of entry, -1 if not found
+//    reference to device, or to device_unk if not found
 //
 Z_Device & Z_Devices::findLongAddr(uint64_t longaddr) {
-  if (!longaddr) { return device_unk; }
-  for (auto &elem : _devices) {
-    if (elem.longaddr == longaddr) { return elem; }
-  }
-  return device_unk;
+  return (Z_Device &) ((const Z_Devices*)this)->findLongAddr(longaddr);
 }
 const Z_Device & Z_Devices::findLongAddr(uint64_t longaddr) const {
   if (!longaddr) { return device_unk; }
+  if (_index.ready(_devices)) {
+    Z_Device * device = _index.findLongAddr(longaddr);
+    return device ? *device : device_unk;
+  }
   for (const auto &elem : _devices) {
     if (elem.longaddr == longaddr) { return elem; }
   }
@@ -101,21 +203,20 @@ const Z_Device & Z_Devices::findLongAddr(uint64_t longaddr) const {
 // In:
 //    friendlyName (null terminated, should not be empty)
 // Out:
-//    index in _devices of entry, -1 if not found
+//    reference to device, or to device_unk if not found
 //
-int32_t Z_Devices::findFriendlyName(const char * name) const {
-  if (!name) { return -1; }              // if pointer is null
-  size_t name_len = strlen(name);
-  int32_t found = 0;
-  if (name_len) {
-    for (auto &elem : _devices) {
-      if (elem.friendlyName) {
-        if (strcasecmp(elem.friendlyName, name) == 0) { return found; }
-      }
-      found++;
+const Z_Device & Z_Devices::findFriendlyName(const char * name) const {
+  if ((!name) || (0 == name[0])) { return device_unk; }   // if pointer is null or name empty
+  if (_index.ready(_devices)) {
+    Z_Device * device = _index.findFriendlyName(name);
+    return device ? *device : device_unk;
+  }
+  for (const auto &elem : _devices) {
+    if (elem.friendlyName) {
+      if (strcasecmp(elem.friendlyName, name) == 0) { return elem; }
     }
   }
-  return -1;
+  return device_unk;
 }
 
 Z_Device & Z_Devices::isKnownLongAddrDevice(uint64_t longaddr) const {
@@ -131,13 +232,7 @@ Z_Device & Z_Devices::isKnownIndexDevice(uint32_t index) const {
 }
 
 Z_Device & Z_Devices::isKnownFriendlyNameDevice(const char * name) const {
-  if ((!name) || (0 == strlen(name))) { return device_unk; }         // Error
-  int32_t found = findFriendlyName(name);
-  if (found >= 0) {
-    return devicesAt(found);
-  } else {
-    return device_unk;
-  }
+  return (Z_Device &) findFriendlyName(name);
 }
 
 uint64_t Z_Devices::getDeviceLongAddr(uint16_t shortaddr) const {
@@ -171,6 +266,7 @@ bool Z_Devices::removeDevice(uint16_t shortaddr) {
   Z_Device & device = findShortAddr(shortaddr);
   if (foundDevice(device)) {
     _devices.remove(&device);
+    _index.invalidate();
     dirty();
     return true;
   }
@@ -194,6 +290,7 @@ Z_Device & Z_Devices::updateDevice(uint16_t shortaddr, uint64_t longaddr) {
       // erase the previous shortaddr
       freeDeviceEntry(s_found);
       _devices.remove(s_found);
+      _index.invalidate();
       dirty();
       return *l_found;
     }
@@ -201,11 +298,13 @@ Z_Device & Z_Devices::updateDevice(uint16_t shortaddr, uint64_t longaddr) {
     // shortaddr already exists but longaddr not
     // add the longaddr to the entry
     s_found->longaddr = longaddr;
+    _index.invalidate();
     dirty();
     return *s_found;
   } else if (foundDevice(*l_found)) {
     // longaddr entry exists, update shortaddr
     l_found->shortaddr = shortaddr;
+    _index.invalidate();
     dirty();
     return *l_found;
   } else {
@@ -318,6 +417,7 @@ void Z_Device::setModelId(const char * str) {
 
 void Z_Device::setFriendlyName(const char * str) {
   setStringAttribute(friendlyName, str);
+  zigbee_devices.indexChanged();
 }
 
 void Z_Device::setLastSeenNow(void) {
@@ -947,6 +947,108 @@ enum Z_offsets {
 };
 
 
+/*
+  DO NOT EDIT
+*/
+
+// Sorted indexes over `Z_PostProcess`, used for binary search by cluster/attribute and by name.
+// Each table lists positions in `Z_PostProcess`, equal keys are kept in table order.
+// They must be regenerated whenever `Z_PostProcess` is changed, a stale index is detected at
+// first use and lookups then fall back to a linear scan.
+//
+// To generate, run the Python3 code below from `tasmota/tasmota_xdrv_driver`:
+
+/*Python code to generate code below
+
+import re
+
+def attribute_index(converters, devices):
+    enums = dict((k, int(v, 0)) for k, v in re.findall(r"^\s*(ZA_\w+)\s*=\s*(\w+),", devices, re.M))
+    table = converters[converters.index("const Z_AttributeConverter Z_PostProcess[]"):]
+    table = table[:table.index("\n};")]
+    entries = re.findall(r"^\s*\{\s*\w+,\s*Cx(\w+),\s*([^,]+),\s*Z_\((\w*)\)", table, re.M)
+
+    by_id = []
+    by_name = []
+    for i, (cx, attr, name) in enumerate(entries):
+        attr = eval(attr, {}, enums)
+        by_id.append(((int(cx, 16), attr), i))
+        if name != "":
+            by_name.append((name.lower(), i))
+    by_id.sort(key=lambda x: x[0])          # sort is stable, equal keys stay in table order
+    by_name.sort(key=lambda x: x[0])
+
+    def out(label, l):
+        s = "const uint16_t " + label + "[] PROGMEM = {\n"
+        for j in range(0, len(l), 16):
+            s += "  " + " ".join("%3i," % x[1] for x in l[j:j+16]) + "\n"
+        return s + "};\n"
+
+    return ("#define Z_POSTPROCESS_LEN " + str(len(entries)) + "\n\n" +
+            out("Z_PostProcess_by_id", by_id) + "\n" +
+            out("Z_PostProcess_by_name", by_name))
+
+print(attribute_index(open("xdrv_23_zigbee_5_converters.ino").read(), open("xdrv_23_zigbee_2_devices.ino").read()))
+
+*/
+
+/*
+  DO NOT EDIT
+*/
+
+#define Z_POSTPROCESS_LEN 355
+
+const uint16_t Z_PostProcess_by_id[] PROGMEM = {
+    0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+   16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,
+   32,  33,  34,  36,  35,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,
+   48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,
+   64,  66,  65,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,
+   80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94,  95,
+   96,  97,  98,  99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+  128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+  144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+  160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+  176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+  192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+  208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+  224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+  240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+  256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271,
+  272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287,
+  288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303,
+  304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319,
+  320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335,
+  336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351,
+  352, 353, 354,
+};
+
+const uint16_t Z_PostProcess_by_name[] PROGMEM = {
+  185, 314, 161,  38,  86,  78,  85,  64,  55,  63,  56,  57,  58,  60,  61,  62,
+   77,  67,  76,  68,  69,  79,  70,  72,  73,  74,  75,  71,  81,  82,  83,  84,
+   59,  80, 316,   1,  66, 169,  65, 168, 166, 167, 310,  19,  18, 108, 118, 109,
+   87, 110,  95,  88,  89,  90,  91,  93,  94,  92, 111, 112,  96, 107,  97,  98,
+   99, 100, 113, 101, 102, 104, 105, 106, 103, 115, 116, 117, 114, 147, 151, 289,
+  157, 294, 225, 246, 244, 245, 243, 241, 242, 240, 238, 239, 300, 223, 177, 291,
+  204, 224,  28, 173, 178, 174, 179,  27,  20, 209, 303, 302,   6, 186,  34, 333,
+   35,  36, 164, 163, 162, 222,  43,  44,  42, 144, 145, 299, 208, 210, 150, 153,
+  292, 275, 274, 273, 276,   8,   9, 298,  25, 217, 278, 280, 279, 281,   3,  24,
+  247, 253, 251, 254, 249, 248, 255, 250, 181, 183, 180, 182, 188, 189, 319, 320,
+   47, 351, 348, 349, 350, 194, 332, 198,  46,  52,  51,  50, 159, 160, 148, 152,
+   17,  16,   4,  22, 301,  21, 158, 187, 304,   5, 155, 296,  13, 141, 134, 125,
+  119, 120, 121, 123, 124, 122, 135, 133, 126, 127, 136, 128, 130, 131, 132, 129,
+  143, 138, 139, 140, 137, 175, 176,  54, 226, 317, 283, 290, 334, 284, 199, 200,
+   37, 165, 352, 195,  23, 297, 305, 318, 295, 154, 171, 172, 196, 197, 309,  30,
+   32, 323, 324, 325, 326,   7, 311, 262, 264, 268, 263, 267, 270, 269, 266, 265,
+  229, 227, 228, 232, 230, 231, 235, 233, 234,  10, 306,  11,  53, 315, 219, 203,
+  313, 312, 218,  26,  29, 146, 271, 149, 307,   2,  45,  31, 156,  12,  33, 205,
+  257, 259, 258, 260, 216, 353, 354, 215,  39,  49,  40,  41, 142, 212, 214, 211,
+  206, 213, 330, 343, 342, 335, 338, 191, 193, 327, 339, 340, 345, 346, 337, 336,
+  192, 190, 344, 322, 321, 331, 329, 341, 347, 328, 201, 202, 308,  48, 207, 184,
+  293, 236, 237, 170, 220, 221,   0, 286, 288, 287,
+};
+
 /*
   DO NOT EDIT
 */
@@ -666,6 +666,126 @@ const Z_AttributeConverter Z_PostProcess[] PROGMEM = {
 };
 #pragma GCC diagnostic pop
 
+// Z_PostProcess_by_id and Z_PostProcess_by_name are generated in xdrv_23_zigbee_5__constants.ino
+static_assert(nitems(Z_PostProcess) == Z_POSTPROCESS_LEN, "Z_PostProcess changed, regenerate Z_PostProcess_by_id/by_name");
+static_assert(nitems(Z_PostProcess_by_id) == Z_POSTPROCESS_LEN, "Z_PostProcess_by_id does not match Z_PostProcess");
+
+static inline uint32_t Z_PostProcessKey(uint32_t i) {
+  const Z_AttributeConverter *converter = &Z_PostProcess[i];
+  return ((uint32_t)CxToCluster(pgm_read_byte(&converter->cluster_short)) << 16) | pgm_read_word(&converter->attribute);
+}
+
+//
+// Check once that the generated indexes are still in sync with Z_PostProcess
+// i.e. sorted on their key, and for equal keys in table order
+//
+bool Z_PostProcessIndexValid(void) {
+  static int8_t valid = -1;     // -1 = not checked yet
+  if (valid >= 0) { return valid; }
+  valid = false;
+
+  uint32_t prev_key = 0;
+  uint32_t prev_idx = 0;
+  for (uint32_t i = 0; i < nitems(Z_PostProcess_by_id); i++) {
+    uint32_t idx = pgm_read_word(&Z_PostProcess_by_id[i]);
+    if (idx >= nitems(Z_PostProcess)) { return false; }
+    uint32_t key = Z_PostProcessKey(idx);
+    if ((i > 0) && ((key < prev_key) || ((key == prev_key) && (idx <= prev_idx)))) { return false; }
+    prev_key = key;
+    prev_idx = idx;
+  }
+
+  uint32_t names = 0;
+  for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
+    if (pgm_read_word(&Z_PostProcess[i].name_offset)) { names++; }
+  }
+  if (names != nitems(Z_PostProcess_by_name)) { return false; }
+  char prev_name[40] = "";
+  for (uint32_t i = 0; i < nitems(Z_PostProcess_by_name); i++) {
+    uint32_t idx = pgm_read_word(&Z_PostProcess_by_name[i]);
+    if (idx >= nitems(Z_PostProcess)) { return false; }
+    uint16_t name_offset = pgm_read_word(&Z_PostProcess[idx].name_offset);
+    if (0 == name_offset) { return false; }
+    int32_t cmp = (i > 0) ? strcasecmp_P(prev_name, Z_strings + name_offset) : -1;
+    if ((cmp > 0) || ((cmp == 0) && (idx <= prev_idx))) { return false; }
+    strncpy_P(prev_name, Z_strings + name_offset, sizeof(prev_name) - 1);
+    prev_idx = idx;
+  }
+
+  valid = true;
+  return valid;
+}
+
+//
+// Find the first entry in Z_PostProcess (in table order) matching cluster/attr_id
+// Binary search in Z_PostProcess_by_id
+// Out:
+//    index in Z_PostProcess, or -1 if not found
+//
+int32_t Z_PostProcessFindId(uint16_t cluster, uint16_t attr_id) {
+  uint32_t key = ((uint32_t)cluster << 16) | attr_id;
+  if (!Z_PostProcessIndexValid()) {
+    for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
+      if (Z_PostProcessKey(i) == key) { return i; }
+    }
+    return -1;
+  }
+  uint32_t lo = 0, hi = nitems(Z_PostProcess_by_id);
+  while (lo < hi) {
+    uint32_t mid = (lo + hi) / 2;
+    if (Z_PostProcessKey(pgm_read_word(&Z_PostProcess_by_id[mid])) < key) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if ((lo < nitems(Z_PostProcess_by_id)) && (Z_PostProcessKey(pgm_read_word(&Z_PostProcess_by_id[lo])) == key)) {
+    return pgm_read_word(&Z_PostProcess_by_id[lo]);
+  }
+  return -1;
+}
+
+//
+// Find the first entry in Z_PostProcess (in table order) matching the name (case insensitive)
+// Binary search in Z_PostProcess_by_name
+// In:
+//    name (null terminated)
+//    cluster: only match entries of this cluster, or any cluster if 0xFFFF
+// Out:
+//    index in Z_PostProcess, or -1 if not found
+//
+int32_t Z_PostProcessFindName(const char * name, uint16_t cluster = 0xFFFF) {
+  if ((nullptr == name) || (0 == name[0])) { return -1; }
+  if (!Z_PostProcessIndexValid()) {
+    for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
+      uint16_t name_offset = pgm_read_word(&Z_PostProcess[i].name_offset);
+      if (0 == name_offset) { continue; }         // avoid strcasecmp_P() from crashing
+      if ((0xFFFF != cluster) && (CxToCluster(pgm_read_byte(&Z_PostProcess[i].cluster_short)) != cluster)) { continue; }
+      if (0 == strcasecmp_P(name, Z_strings + name_offset)) { return i; }
+    }
+    return -1;
+  }
+  uint32_t lo = 0, hi = nitems(Z_PostProcess_by_name);
+  while (lo < hi) {
+    uint32_t mid = (lo + hi) / 2;
+    uint32_t idx = pgm_read_word(&Z_PostProcess_by_name[mid]);
+    if (strcasecmp_P(name, Z_strings + pgm_read_word(&Z_PostProcess[idx].name_offset)) > 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  // entries with the same name are in table order
+  for (; lo < nitems(Z_PostProcess_by_name); lo++) {
+    uint32_t idx = pgm_read_word(&Z_PostProcess_by_name[lo]);
+    if (0 != strcasecmp_P(name, Z_strings + pgm_read_word(&Z_PostProcess[idx].name_offset))) { break; }
+    if ((0xFFFF == cluster) || (CxToCluster(pgm_read_byte(&Z_PostProcess[idx].cluster_short)) == cluster)) {
+      return idx;
+    }
+  }
+  return -1;
+}
+
 typedef union ZCLHeaderFrameControl_t {
   struct {
     uint8_t frame_type : 2;           // 00 = across entire profile, 01 = cluster specific
@@ -683,19 +803,17 @@ typedef union ZCLHeaderFrameControl_t {
 const __FlashStringHelper* zigbeeFindAttributeByName(const char *command,
                                     uint16_t *cluster, uint16_t *attribute, int8_t *multiplier,
                                     uint8_t *zigbee_type = nullptr, Z_Data_Type *data_type = nullptr, uint8_t *map_offset = nullptr) {
-  for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
-    const Z_AttributeConverter *converter = &Z_PostProcess[i];
-    if (0 == pgm_read_word(&converter->name_offset)) { continue; }         // avoid strcasecmp_P() from crashing
-    if (0 == strcasecmp_P(command, Z_strings + pgm_read_word(&converter->name_offset))) {
-      if (cluster)      { *cluster    = CxToCluster(pgm_read_byte(&converter->cluster_short)); }
-      if (attribute)    { *attribute  = pgm_read_word(&converter->attribute); }
-      if (multiplier)   { *multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx)); }
-      if (zigbee_type)  { *zigbee_type = pgm_read_byte(&converter->type); }
-      uint8_t conv_mapping = pgm_read_byte(&converter->mapping);
-      if (data_type)    { *data_type = (Z_Data_Type) ((conv_mapping & 0xF0)>>4); }
-      if (map_offset)   { *map_offset = (conv_mapping & 0x0F); }
-      return (const __FlashStringHelper*) (Z_strings + pgm_read_word(&converter->name_offset));
-    }
+  int32_t found = Z_PostProcessFindName(command);
+  if (found >= 0) {
+    const Z_AttributeConverter *converter = &Z_PostProcess[found];
+    if (cluster)      { *cluster    = CxToCluster(pgm_read_byte(&converter->cluster_short)); }
+    if (attribute)    { *attribute  = pgm_read_word(&converter->attribute); }
+    if (multiplier)   { *multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx)); }
+    if (zigbee_type)  { *zigbee_type = pgm_read_byte(&converter->type); }
+    uint8_t conv_mapping = pgm_read_byte(&converter->mapping);
+    if (data_type)    { *data_type = (Z_Data_Type) ((conv_mapping & 0xF0)>>4); }
+    if (map_offset)   { *map_offset = (conv_mapping & 0x0F); }
+    return (const __FlashStringHelper*) (Z_strings + pgm_read_word(&converter->name_offset));
   }
   return nullptr;
 }
@@ -705,16 +823,12 @@ const __FlashStringHelper* zigbeeFindAttributeByName(const char *command,
 //
 const __FlashStringHelper* zigbeeFindAttributeById(uint16_t cluster, uint16_t attr_id,
                                       uint8_t *attr_type, int8_t *multiplier) {
-  for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
-    const Z_AttributeConverter *converter = &Z_PostProcess[i];
-    uint16_t conv_cluster = CxToCluster(pgm_read_byte(&converter->cluster_short));
-    uint16_t conv_attr_id = pgm_read_word(&converter->attribute);
-
-    if ((conv_cluster == cluster) && (conv_attr_id == attr_id)) {
-      if (multiplier)   { *multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx)); }
-      if (attr_type)    { *attr_type  = pgm_read_byte(&converter->type); }
-      return (const __FlashStringHelper*) (Z_strings + pgm_read_word(&converter->name_offset));
-    }
+  int32_t found = Z_PostProcessFindId(cluster, attr_id);
+  if (found >= 0) {
+    const Z_AttributeConverter *converter = &Z_PostProcess[found];
+    if (multiplier)   { *multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx)); }
+    if (attr_type)    { *attr_type  = pgm_read_byte(&converter->type); }
+    return (const __FlashStringHelper*) (Z_strings + pgm_read_word(&converter->name_offset));
   }
   return nullptr;
 }
@@ -1494,15 +1608,9 @@ void ZCLFrame::parseReadAttributes(Z_attribute_list& attr_list) {
     read_attr_ids[i/2] = attrid;
 
     // find the attribute name
-    for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
-      const Z_AttributeConverter *converter = &Z_PostProcess[i];
-      uint16_t conv_cluster = CxToCluster(pgm_read_byte(&converter->cluster_short));
-      uint16_t conv_attribute = pgm_read_word(&converter->attribute);
-
-      if ((conv_cluster == cluster) && (conv_attribute == attrid)) {
-        attr_names.addAttribute(Z_strings + pgm_read_word(&converter->name_offset), true).setBool(true);
-        break;
-      }
+    int32_t found = Z_PostProcessFindId(cluster, attrid);
+    if (found >= 0) {
+      attr_names.addAttribute(Z_strings + pgm_read_word(&Z_PostProcess[found].name_offset), true).setBool(true);
     }
     i += 2;
   }
@@ -1565,17 +1673,12 @@ void ZCLFrame::parseReadConfigAttributes(Z_attribute_list& attr_list) {
 
     // find the attribute name
     int8_t multiplier = 1;
-    for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
-      const Z_AttributeConverter *converter = &Z_PostProcess[i];
-      uint16_t conv_cluster = CxToCluster(pgm_read_byte(&converter->cluster_short));
-      uint16_t conv_attribute = pgm_read_word(&converter->attribute);
-
-      if ((conv_cluster == cluster) && (conv_attribute == attrid)) {
-        const char * attr_name = Z_strings + pgm_read_word(&converter->name_offset);
-        attr_2.addAttribute(attr_name, true).setBool(true);
-        multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx));
-        break;
-      }
+    int32_t found = Z_PostProcessFindId(cluster, attrid);
+    if (found >= 0) {
+      const Z_AttributeConverter *converter = &Z_PostProcess[found];
+      const char * attr_name = Z_strings + pgm_read_word(&converter->name_offset);
+      attr_2.addAttribute(attr_name, true).setBool(true);
+      multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx));
     }
     i += 4;
     if (0 != status) {
@@ -2039,22 +2142,19 @@ void Z_postProcessAttributes(uint16_t shortaddr, uint16_t src_ep, class Z_attrib
       uint8_t map_offset = 0;
       uint8_t zigbee_type = Znodata;
       int8_t conv_multiplier;
-      for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
-        const Z_AttributeConverter *converter = &Z_PostProcess[i];
-        uint16_t conv_cluster = CxToCluster(pgm_read_byte(&converter->cluster_short));
-        uint16_t conv_attribute = pgm_read_word(&converter->attribute);
-
-        if ((conv_cluster == cluster) &&
-            ((conv_attribute == attribute) || (conv_attribute == 0xFFFF)) ) {
-          conv_multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx));
-          zigbee_type = pgm_read_byte(&converter->type);
-          uint8_t mapping = pgm_read_byte(&converter->mapping);
-          map_type = (Z_Data_Type) ((mapping & 0xF0)>>4);
-          map_offset = (mapping & 0x0F);
-          conv_name = Z_strings + pgm_read_word(&converter->name_offset);
-          found = true;
-          break;
-        }
+      // first entry in table order matching the attribute, or 0xFFFF for any attribute of the cluster
+      int32_t found_idx = Z_PostProcessFindId(cluster, attribute);
+      int32_t found_any = Z_PostProcessFindId(cluster, 0xFFFF);
+      if ((found_idx < 0) || ((found_any >= 0) && (found_any < found_idx))) { found_idx = found_any; }
+      if (found_idx >= 0) {
+        const Z_AttributeConverter *converter = &Z_PostProcess[found_idx];
+        conv_multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx));
+        zigbee_type = pgm_read_byte(&converter->type);
+        uint8_t mapping = pgm_read_byte(&converter->mapping);
+        map_type = (Z_Data_Type) ((mapping & 0xF0)>>4);
+        map_offset = (mapping & 0x0F);
+        conv_name = Z_strings + pgm_read_word(&converter->name_offset);
+        found = true;
       }
 
       float    fval   = attr.getFloat();
@@ -2144,34 +2244,23 @@ void Z_postProcessAttributes(uint16_t shortaddr, uint16_t src_ep, class Z_attrib
 
 // Internal search function
 void Z_parseAttributeKey_inner(class Z_attribute & attr, uint16_t preferred_cluster) {
-  // scan attributes to find by name, and retrieve type
-  for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
-    const Z_AttributeConverter *converter = &Z_PostProcess[i];
-    uint16_t local_attr_id = pgm_read_word(&converter->attribute);
-    uint16_t local_cluster_id = CxToCluster(pgm_read_byte(&converter->cluster_short));
-    uint8_t  local_type_id = pgm_read_byte(&converter->type);
-    int8_t   local_multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx));
-    // AddLog(LOG_LEVEL_DEBUG, PSTR("Try cluster = 0x%04X, attr = 0x%04X, type_id = 0x%02X"), local_cluster_id, local_attr_id, local_type_id);
+  // find attribute by cluster/attr_id or by name, and retrieve type
+  int32_t found;
+  if (!attr.key_is_str) {
+    found = Z_PostProcessFindId(attr.key.id.cluster, attr.key.id.attr_id);
+  } else {
+    found = Z_PostProcessFindName(attr.key.key, preferred_cluster);
+  }
+  if (found < 0) { return; }
 
-    if (!attr.key_is_str) {
-      if ((attr.key.id.cluster == local_cluster_id) && (attr.key.id.attr_id == local_attr_id)) {
-        attr.attr_type = local_type_id;
-        break;
-      }
-    } else if (pgm_read_word(&converter->name_offset)) {
-      const char * key = attr.key.key;
-      // AddLog(LOG_LEVEL_DEBUG, PSTR("Comparing '%s' with '%s'"), attr_name, converter->name);
-      if (0 == strcasecmp_P(key, Z_strings + pgm_read_word(&converter->name_offset))) {
-        if ((preferred_cluster == 0xFFFF) ||    // any cluster
-            (local_cluster_id == preferred_cluster)) {
-          // match
-          attr.setKeyId(local_cluster_id, local_attr_id);
-          attr.attr_type = local_type_id;
-          attr.attr_multiplier = local_multiplier;
-          break;
-        }
-      }
-    }
+  const Z_AttributeConverter *converter = &Z_PostProcess[found];
+  uint8_t  local_type_id = pgm_read_byte(&converter->type);
+  if (!attr.key_is_str) {
+    attr.attr_type = local_type_id;
+  } else {
+    attr.setKeyId(CxToCluster(pgm_read_byte(&converter->cluster_short)), pgm_read_word(&converter->attribute));
+    attr.attr_type = local_type_id;
+    attr.attr_multiplier = CmToMultiplier(pgm_read_byte(&converter->multiplier_idx));
   }
 }
 
@@ -70,6 +70,18 @@ bool Z_LedStatusSet(bool onoff) {
 #include <TasmotaSerial.h>
 TasmotaSerial *ZigbeeSerial = nullptr;
 
+//
+// Log new serial receive overruns when a frame is rejected, lost bytes explain bad checksums and sizes
+//
+void ZigbeeLogOverruns(void) {
+  static uint32_t overruns = 0;
+  uint32_t now_overruns = ZigbeeSerial->getOverruns();
+  if (now_overruns != overruns) {
+    AddLog(LOG_LEVEL_INFO, PSTR(D_LOG_ZIGBEE "Serial overruns %u (+%u), %u bytes received"), now_overruns, now_overruns - overruns, ZigbeeSerial->getRxBytes());
+    overruns = now_overruns;
+  }
+}
+
 /********************************************************************************************/
 //
 // Called at event loop, checks for incoming data from the CC2530
@@ -141,9 +153,11 @@ void ZigbeeInputLoop(void) {
 		if (zigbee_buffer->len() != zigbee_frame_len) {
 			// Len is not correct, log and reject frame
       AddLog(LOG_LEVEL_INFO, PSTR(D_JSON_ZIGBEEZNPRECEIVED ": received frame of wrong size %_B, len %d, expected %d"), zigbee_buffer, zigbee_buffer->len(), zigbee_frame_len);
+      ZigbeeLogOverruns();
 		} else if (0x00 != fcs) {
 			// FCS is wrong, packet is corrupt, log and reject frame
       AddLog(LOG_LEVEL_INFO, PSTR(D_JSON_ZIGBEEZNPRECEIVED ": received bad FCS frame %_B, %d"), zigbee_buffer, fcs);
+      ZigbeeLogOverruns();
 		} else {
 			// frame is correct
 			//AddLog(LOG_LEVEL_DEBUG_MORE, PSTR(D_JSON_ZIGBEEZNPRECEIVED ": received correct frame %s"), hex_char);
@@ -246,6 +260,7 @@ void ZigbeeInputLoop(void) {
 
       if (crc_received != crc) {
         AddLog(LOG_LEVEL_INFO, PSTR(D_JSON_ZIGBEE_EZSP_RECEIVED ": bad crc (received 0x%04X, computed 0x%04X) %_B"), crc_received, crc, zigbee_buffer);
+        ZigbeeLogOverruns();
       } else {
         // copy buffer
     	  SBuffer ezsp_buffer = zigbee_buffer->subBuffer(0, frame_len - 2);	// CRC
@@ -268,6 +283,7 @@ void ZigbeeInputLoop(void) {
     } else {
       // the buffer timed-out, print error and discard
       AddLog(LOG_LEVEL_INFO, PSTR(D_JSON_ZIGBEE_EZSP_RECEIVED ": time-out, discarding %_B"), zigbee_buffer);
+      ZigbeeLogOverruns();
     }
     zigbee_buffer->setLen(0);		// empty buffer
     escape = false;
@@ -300,6 +316,9 @@ void ZigbeeInitSerial(void)
     // if TasmotaGlobal.seriallog_level is 0, we allow GPIO 13/15 to switch to Hardware Serial
     ZigbeeSerial = new TasmotaSerial(Pin(GPIO_ZIGBEE_RX), Pin(GPIO_ZIGBEE_TX), TasmotaGlobal.seriallog_level ? 1 : 2, 0, 256);   // set a receive buffer of 256 bytes
     ZigbeeSerial->begin(115200);
+#ifdef ESP32
+    ZigbeeSerial->enableOverrunStats();
+#endif  // ESP32
     if (ZigbeeSerial->hardwareSerial()) {
       ClaimSerial();
 		}
@@ -622,35 +622,31 @@ void ZbSendRead(JsonParserToken val_attr, ZCLFrame & zcl) {
       JsonParserToken value = key.getValue();
 
       bool found = false;
-      // scan attributes to find by name, and retrieve type
-      for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
-        const Z_AttributeConverter *converter = &Z_PostProcess[i];
+      // find attribute by name, and retrieve type
+      int32_t found_idx = Z_PostProcessFindName(key.getStr());
+      if (found_idx >= 0) {
+        const Z_AttributeConverter *converter = &Z_PostProcess[found_idx];
         uint16_t local_attr_id = pgm_read_word(&converter->attribute);
         uint16_t local_cluster_id = CxToCluster(pgm_read_byte(&converter->cluster_short));
-        // uint8_t  local_type_id = pgm_read_byte(&converter->type);
-
-        if ((pgm_read_word(&converter->name_offset)) && (0 == strcasecmp_P(key.getStr(), Z_strings + pgm_read_word(&converter->name_offset)))) {
-          // match name
-          // check if there is a conflict with cluster
-          // TODO
-          if (!(value.getBool()) && attr_item_offset) {
-            // If value is false (non-default) then set direction to 1 (for ReadConfig)
-            attrs[actual_attr_len] = 0x01;
-          }
-          actual_attr_len += attr_item_offset;
-          attrs[actual_attr_len++] = local_attr_id & 0xFF;
-          attrs[actual_attr_len++] = local_attr_id >> 8;
-          actual_attr_len += attr_item_len - 2 - attr_item_offset;    // normally 0
-          found = true;
-          // check cluster
-          if (!zcl.validCluster()) {
-            zcl.cluster = local_cluster_id;
-          } else if (zcl.cluster != local_cluster_id) {
-            ResponseCmndChar_P(PSTR(D_ZIGBEE_TOO_MANY_CLUSTERS));
-            if (attrs) { free(attrs); }
-            return;
-          }
-          break;    // found, exit loop
+        // match name
+        // check if there is a conflict with cluster
+        // TODO
+        if (!(value.getBool()) && attr_item_offset) {
+          // If value is false (non-default) then set direction to 1 (for ReadConfig)
+          attrs[actual_attr_len] = 0x01;
+        }
+        actual_attr_len += attr_item_offset;
+        attrs[actual_attr_len++] = local_attr_id & 0xFF;
+        attrs[actual_attr_len++] = local_attr_id >> 8;
+        actual_attr_len += attr_item_len - 2 - attr_item_offset;    // normally 0
+        found = true;
+        // check cluster
+        if (!zcl.validCluster()) {
+          zcl.cluster = local_cluster_id;
+        } else if (zcl.cluster != local_cluster_id) {
+          ResponseCmndChar_P(PSTR(D_ZIGBEE_TOO_MANY_CLUSTERS));
+          if (attrs) { free(attrs); }
+          return;
         }
       }
       if (!found) {
@@ -31,6 +31,7 @@
 extern "C" {
   extern void be_load_custom_libs(bvm *vm);
   extern void be_tracestack(bvm *vm);
+  extern bbool be_gc_step(bvm *vm);
 }
 
 const char kBrCommands[] PROGMEM = D_PRFX_BR "|"    // prefix
@@ -97,6 +98,11 @@ extern "C" {
   void berry_free(void *ptr) {
     free(ptr);
   }
+
+  // clock used by Berry to measure GC pauses
+  uint32_t berry_clock_us(void) {
+    return micros();
+  }
 }
 
 
@@ -712,6 +718,9 @@ bool Xdrv52(uint8_t function)
     case FUNC_MQTT_DATA:
       result = callBerryEventDispatcher(PSTR("mqtt_data"), XdrvMailbox.topic, 0, XdrvMailbox.data, XdrvMailbox.data_len);
      break;
+    case FUNC_MQTT_DATA_STREAM:   // offer with total length as idx and no payload, then chunks with offset as idx
+      result = callBerryEventDispatcher(PSTR("mqtt_stream"), XdrvMailbox.topic, (XdrvMailbox.data) ? XdrvMailbox.payload : XdrvMailbox.index, XdrvMailbox.data, XdrvMailbox.data_len);
+      break;
     case FUNC_COMMAND:
       result = DecodeCommand(kBrCommands, BerryCommand);
       if (!result) {
@@ -722,6 +731,9 @@ bool Xdrv52(uint8_t function)
     // Module specific events
     case FUNC_EVERY_50_MSECOND:
       callBerryEventDispatcher(PSTR("every_50ms"), nullptr, 0, nullptr);
+      if (berry.vm) {
+        be_gc_step(berry.vm);     // advance pending incremental GC sweep
+      }
       break;
     case FUNC_EVERY_100_MSECOND:
       callBerryEventDispatcher(PSTR("every_100ms"), nullptr, 0, nullptr);
@@ -94,17 +94,20 @@ void lv_flush_callback(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *c
   }
 
   uint32_t pixels_len = width * height;
-  uint32_t chrono_start = millis();
+  glue->flush_start = micros();
+  glue->flush_pixels = pixels_len;
+  glue->flush_disp = disp;
   display->setAddrWindow(area->x1, area->y1, area->x1+width, area->y1+height);
   display->pushColors((uint16_t *)color_p, pixels_len, false);
-  display->setAddrWindow(0,0,0,0);
-  uint32_t chrono_time = millis() - chrono_start;
-
-  lv_disp_flush_ready(disp);
-
-  if (pixels_len >= 10000 && (!display->lvgl_param.use_dma)) {
-    AddLog(LOG_LEVEL_DEBUG, D_LOG_LVGL "Refreshed %d pixels in %d ms (%i pix/ms)", pixels_len, chrono_time,
-            chrono_time > 0 ? pixels_len / chrono_time : -1);
+  display->setAddrWindow(0,0,0,0);    // if async, flush_ready is called by glue when DMA is done
+
+  if (!glue->async_flush) {
+    glue->flushDone();
+    if (pixels_len >= 10000 && (!display->lvgl_param.use_dma)) {
+      uint32_t chrono_time = glue->flush_time_us / 1000;
+      AddLog(LOG_LEVEL_DEBUG, D_LOG_LVGL "Refreshed %d pixels in %d ms (%i pix/ms)", pixels_len, chrono_time,
+              chrono_time > 0 ? pixels_len / chrono_time : -1);
+    }
   }
 }
 
@@ -445,7 +448,9 @@ bool Xdrv54(uint8_t function)
         if (TasmotaGlobal.sleep > USE_LVGL_MAX_SLEEP) {
           TasmotaGlobal.sleep = USE_LVGL_MAX_SLEEP;   // sleep is max 10ms
         }
+        if (glue->async_flush) { glue->display->dmaBusy(); }   // release last buffer and SPI bus once DMA is over
         lv_task_handler();
+        if (glue->async_flush) { glue->display->dmaWait(); }   // DMA overlaps rendering within this call only, the SPI bus is shared with touch and other drivers
       }
       break;
     case FUNC_EVERY_50_MSECOND:
@@ -453,6 +458,11 @@ bool Xdrv54(uint8_t function)
     case FUNC_EVERY_100_MSECOND:
       break;
     case FUNC_EVERY_SECOND:
+      if (glue && glue->async_flush && glue->frame_pixels >= 10000) {
+        AddLog(LOG_LEVEL_DEBUG_MORE, D_LOG_LVGL "Frame %d pixels in %d ms, last flush %d us (%d bytes/ms)",
+               glue->frame_pixels, glue->frame_time_ms, glue->flush_time_us, glue->flush_bytes_ms);
+        glue->frame_pixels = 0;
+      }
       break;
     case FUNC_COMMAND:
       break;
@@ -502,46 +502,92 @@ void Ws2812Steps(uint32_t schemenr) {
 }
 
 #ifdef USE_NETWORK_LIGHT_SCHEMES
-void Ws2812DDP(void)
+// Copy pixel data of the current packet at byte offset of the frame straight into the strip buffer
+void Ws2812NetLightData(uint32_t protocol, uint32_t offset, uint32_t length, uint32_t channels)
 {
 #if (USE_WS2812_CTYPE > NEO_3LED)
   RgbwColor c;
-  c.W = 0;
 #else
   RgbColor c;
 #endif
-  c.R = 0;
-  c.G = 0;
-  c.B = 0;
+  uint8_t buffer[48];
+  uint8_t color[4] = { 0, 0, 0, 0 };
+  uint32_t index = offset / channels;
+  uint32_t channel = offset % channels;
+
+  if (index >= Settings->light_pixels) { return; }
+  if (channel) {                                // Pixel started in previous packet
+    c = strip->GetPixelColor(index);
+    color[0] = c.R;
+    color[1] = c.G;
+    color[2] = c.B;
+#if (USE_WS2812_CTYPE > NEO_3LED)
+    color[3] = c.W;
+#endif
+  }
+  while (length && (index < Settings->light_pixels)) {
+    uint32_t size = NetLightRead(protocol, buffer, (length < sizeof(buffer)) ? length : sizeof(buffer));
+    if (!size) { break; }
+    length -= size;
+    for (uint32_t i = 0; i < size; i++) {
+      color[channel++] = (Settings->light_correction) ? ledGamma(buffer[i]) : buffer[i];
+      if (channel == channels) {
+        channel = 0;
+        if (index >= Settings->light_pixels) { break; }
+        c.R = color[0];
+        c.G = color[1];
+        c.B = color[2];
+#if (USE_WS2812_CTYPE > NEO_3LED)
+        c.W = (channels > 3) ? color[3] : 0;
+#endif
+        strip->SetPixelColor(index++, c);
+      }
+    }
+  }
+  if (channel && (index < Settings->light_pixels)) {  // Pixel continues in next packet
+    c.R = color[0];
+    c.G = color[1];
+    c.B = color[2];
+#if (USE_WS2812_CTYPE > NEO_3LED)
+    c.W = color[3];
+#endif
+    strip->SetPixelColor(index, c);
+  }
+}
 
+void Ws2812DDP(void)
+{
   // Can't be trying to initialize UDP too early.
   if (TasmotaGlobal.restart_flag || TasmotaGlobal.global_state.network_down) return;
 
-  // Start DDP listener, if fail, just set last ddp_color
-  if (!ddp_udp_up) {
-    if (!ddp_udp.begin(4048)) return;
-    ddp_udp_up = 1;
-    AddLog(LOG_LEVEL_DEBUG_MORE, "DDP: UDP Listener Started: WS2812 Scheme");
-  }
+  // Start DDP listener
+  if (!NetLightBegin("WS2812 Scheme")) return;
 
-  // Get the DDP payload over UDP
-  std::vector<uint8_t> payload;
-  while (uint16_t packet_size = ddp_udp.parsePacket()) {
-    payload.resize(packet_size);
-    if (!ddp_udp.read(&payload[0], payload.size())) {
-      continue;
-    }
+#if (USE_WS2812_CTYPE > NEO_3LED)
+  const uint32_t strip_channels = 4;
+#else
+  const uint32_t strip_channels = 3;
+#endif
+
+  // Drain all queued packets into the strip buffer and show only if the last one completed a frame.
+  // Older complete frames are overwritten by newer ones, a frame still arriving is shown on a later call
+  bool received = false;
+  bool complete = false;
+  uint32_t protocol;
+  while (NetLightParsePacket(&protocol)) {
+    uint32_t offset, length;
+    uint32_t channels = strip_channels;
+    bool push;
+    if (!NetLightHeader(protocol, Settings->light_pixels * strip_channels, &offset, &length, &channels, &push)) { continue; }
+    Ws2812NetLightData(protocol, offset, length, channels);
+    received = true;
+    complete = push;
   }
 
-  // No verification checks performed against packet besides length
-  if (payload.size() > (9+3*Settings->light_pixels)) {
-    for (uint32_t i = 0; i < Settings->light_pixels; i++) {
-      c.R = payload[10+3*i];
-      c.G = payload[11+3*i];
-      c.B = payload[12+3*i];
-      strip->SetPixelColor(i, c);
-    }
-    Ws2812StripShow();
+  // Senders without frame marks show every update
+  if (complete || (received && !NetLight.push_seen)) {
+    strip->Show();                              // Gamma correction has been applied per pixel
+    NetLightFrame();
   }
 }
 #endif
@@ -636,10 +682,8 @@ void Ws2812ShowScheme(void)
   uint32_t scheme = Settings->light_scheme - Ws2812.scheme_offset;
   
 #ifdef USE_NETWORK_LIGHT_SCHEMES
-  if ((scheme != 9) && (ddp_udp_up)) {
-    ddp_udp.stop();
-    ddp_udp_up = 0;
-    AddLog(LOG_LEVEL_DEBUG_MORE, "DDP: UDP Stopped: WS2812 Scheme not DDP");
+  if (scheme != 9) {
+    NetLightStop("WS2812 Scheme not DDP");
   }
 #endif
   switch (scheme) {
@@ -782,6 +826,13 @@ bool Xlgt01(uint8_t function)
     case FUNC_SET_SCHEME:
       Ws2812ShowScheme();
       break;
+#ifdef USE_NETWORK_LIGHT_SCHEMES
+    case FUNC_LOOP:
+      if (9 == Settings->light_scheme - Ws2812.scheme_offset) {
+        Ws2812DDP();
+      }
+      break;
+#endif
     case FUNC_COMMAND:
       result = DecodeCommand(kWs2812Commands, Ws2812Command);
       break;
@@ -526,6 +526,15 @@ TasmotaSerial *meter_ss[MAX_METERS];
 #endif
 uint8_t smltbuf[MAX_METERS][SML_BSIZ];
 
+// prefilter in front of SML_Decode for shifting meters, hash map of the leading compare bytes
+// of all descriptor lines, allows to skip decoding at buffer positions where no line can match
+#define SML_KEY_SIZE 6
+uint8_t sml_key_len[MAX_METERS];
+uint32_t sml_key_map[MAX_METERS][8];
+// meter and interval of =d lines by delta index, a due delta also needs a decode
+uint8_t sml_delta_meter[MAX_DVARS];
+uint32_t sml_delta_time[MAX_DVARS];
+
 // meter nr as string
 #define METER_ID_SIZE 24
 char meter_id[MAX_METERS][METER_ID_SIZE];
@@ -1607,16 +1616,13 @@ void sml_empty_receiver(uint32_t meters) {
 
 
 void sml_shift_in(uint32_t meters,uint32_t shard) {
-  uint32_t count;
 #ifndef SML_OBIS_LINE
   if (meter_desc_p[meters].type!='e' && meter_desc_p[meters].type!='m' && meter_desc_p[meters].type!='M' && meter_desc_p[meters].type!='p' && meter_desc_p[meters].type!='R' && meter_desc_p[meters].type!='v') {
 #else
   if (meter_desc_p[meters].type!='o' && meter_desc_p[meters].type!='e' && meter_desc_p[meters].type!='m' && meter_desc_p[meters].type!='M' && meter_desc_p[meters].type!='p' && meter_desc_p[meters].type!='R' && meter_desc_p[meters].type!='v') {
 #endif
     // shift in
-    for (count=0; count<SML_BSIZ-1; count++) {
-      smltbuf[meters][count]=smltbuf[meters][count+1];
-    }
+    memmove(&smltbuf[meters][0], &smltbuf[meters][1], SML_BSIZ-1);
   }
   uint8_t iob=(uint8_t)meter_ss[meters]->read();
 
@@ -1707,11 +1713,92 @@ void sml_shift_in(uint32_t meters,uint32_t shard) {
 		}
   }
   sb_counter++;
+  // calculated lines need a decode every 256 th byte
 #ifndef SML_OBIS_LINE
-  if (meter_desc_p[meters].type!='e' && meter_desc_p[meters].type!='m' && meter_desc_p[meters].type!='M' && meter_desc_p[meters].type!='p' && meter_desc_p[meters].type!='R' && meter_desc_p[meters].type!='v') SML_Decode(meters);
+  if (meter_desc_p[meters].type!='e' && meter_desc_p[meters].type!='m' && meter_desc_p[meters].type!='M' && meter_desc_p[meters].type!='p' && meter_desc_p[meters].type!='R' && meter_desc_p[meters].type!='v') {
 #else
-  if (meter_desc_p[meters].type!='o' && meter_desc_p[meters].type!='e' && meter_desc_p[meters].type!='m' && meter_desc_p[meters].type!='M' && meter_desc_p[meters].type!='p' && meter_desc_p[meters].type!='R' && meter_desc_p[meters].type!='v') SML_Decode(meters);
+  if (meter_desc_p[meters].type!='o' && meter_desc_p[meters].type!='e' && meter_desc_p[meters].type!='m' && meter_desc_p[meters].type!='M' && meter_desc_p[meters].type!='p' && meter_desc_p[meters].type!='R' && meter_desc_p[meters].type!='v') {
 #endif
+    if (SML_Decode_Needed(meters)) SML_Decode(meters);
+  }
+}
+
+// SML_Decode has no effect at this buffer position unless a descriptor line may match,
+// a =m line is due (every 256 th byte) or a =d line is due
+bool SML_Decode_Needed(uint32_t meter) {
+  if (!sb_counter) return true;
+  for (uint32_t cnt = 0; cnt < MAX_DVARS; cnt++) {
+    if (sml_delta_meter[cnt] == meter && (millis() - dtimes[cnt]) > sml_delta_time[cnt]) return true;
+  }
+  return SML_Key_Match(meter);
+}
+
+uint32_t sml_key_hash(const uint8_t *cp, uint32_t len) {
+  uint32_t hash = 0;
+  for (uint32_t cnt = 0; cnt < len; cnt++) {
+    hash = (hash * 31) + cp[cnt];
+  }
+  return hash & 0xff;
+}
+
+bool SML_Key_Match(uint32_t meter) {
+  uint32_t len = sml_key_len[meter];
+  if (!len) return true;
+  uint32_t hash = sml_key_hash(&smltbuf[meter][0], len);
+  return bitRead(sml_key_map[meter][hash >> 5], hash & 31);
+}
+
+// collect the leading literal bytes of all compare lines, 1. pass gets the shortest per meter, 2. pass fills the map
+// and the =d lines in the order SML_Decode counts them
+void SML_Build_Keys(void) {
+  uint8_t key[SML_KEY_SIZE];
+
+  memset(sml_key_map, 0, sizeof(sml_key_map));
+  memset(sml_delta_meter, 0xff, sizeof(sml_delta_meter));
+  for (uint32_t meters = 0; meters < MAX_METERS; meters++) {
+    sml_key_len[meters] = SML_KEY_SIZE;
+  }
+  for (uint32_t pass = 0; pass < 2; pass++) {
+    const char *mp = (const char*)meter_p;
+    uint32_t dindex = 0;
+    while (mp && *mp) {
+      int8_t mindex = ((*mp) & 7) - 1;
+      if (mindex < 0 || mindex >= meters_used) mindex = 0;
+      mp += 2;
+      if (*mp == '=' && *(mp + 1) == 'd') {
+        if (pass && dindex < MAX_DVARS) {
+          const char *dp = mp + 2;
+          while (*dp == ' ') dp++;
+          while (*dp >= '0' && *dp <= '9') dp++;
+          sml_delta_meter[dindex] = mindex;
+          sml_delta_time[dindex] = atoi(dp) * 1000;
+        }
+        dindex++;
+      } else if (*mp != '=') {
+        uint32_t len = 0;
+        if (meter_desc_p[mindex].type == 's') {
+          while (len < SML_KEY_SIZE && isxdigit(mp[len * 2]) && isxdigit(mp[len * 2 + 1])) {
+            key[len] = (hexnibble(mp[len * 2]) << 4) | hexnibble(mp[len * 2 + 1]);
+            len++;
+          }
+        } else if (meter_desc_p[mindex].type == 'o') {
+          while (len < SML_KEY_SIZE && mp[len] && mp[len] != '@' && mp[len] != '|') {
+            key[len] = mp[len];
+            len++;
+          }
+        }
+        // other types may start with wildcards or values and always decode
+        if (!pass) {
+          if (len < sml_key_len[mindex]) sml_key_len[mindex] = len;
+        } else if (sml_key_len[mindex]) {
+          uint32_t hash = sml_key_hash(key, sml_key_len[mindex]);
+          bitSet(sml_key_map[mindex][hash >> 5], hash & 31);
+        }
+      }
+      mp = strchr(mp, '|');
+      if (mp) mp++;
+    }
+  }
 }
 
 
@@ -3027,6 +3114,7 @@ next_line:
 #endif
 
 init10:
+  SML_Build_Keys();
   typedef void (*function)();
   uint8_t cindex=0;
   // preloud counters
@@ -3527,6 +3615,7 @@ uint8_t parity=0;
 // restart driver => sensor53 r
 // meter number for monitoring serial activity => sensor53 m1, m2, m3 ... or m0 for all (default)
 // LED-GPIO for monitoring serial activity => sensor53 l2, l13, l15 ... or l255 for turn off (default)
+// serial receive statistics => sensor53 s (software serial only)
 
 bool XSNS_53_cmd(void) {
   bool serviced = true;
@@ -3592,6 +3681,17 @@ bool XSNS_53_cmd(void) {
           }
           ResponseTime_P(PSTR(",\"SML\":{\"CMD\":\"ser_act_LED_pin: %d\"}}"),ser_act_LED_pin);
         }
+#ifdef SPECIAL_SS
+      } else if (*cp=='s') {
+        // received bytes and receive buffer overruns per serial meter
+        ResponseTime_P(PSTR(",\"SML\":{\"CMD\":\"serial\""));
+        for (uint8_t meters=0; meters<meters_used; meters++) {
+          if (meter_ss[meters]) {
+            ResponseAppend_P(PSTR(",\"%d\":{\"Rx\":%u,\"Overruns\":%u}"),meters+1,meter_ss[meters]->getRxBytes(),meter_ss[meters]->getOverruns());
+          }
+        }
+        ResponseJsonEndEnd();
+#endif // SPECIAL_SS
       } else {
         serviced=false;
       }
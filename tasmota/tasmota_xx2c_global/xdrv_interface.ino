@@ -1127,6 +1127,45 @@ bool XdrvCallDriver(uint32_t driver, uint8_t Function)
   return false;
 }
 
+/*********************************************************************************************\
+ * Function call to xdrv at position in list
+\*********************************************************************************************/
+
+int32_t XdrvSlot(uint32_t driver)
+{
+  for (uint32_t x = 0; x < xdrv_present; x++) {
+#ifdef XFUNC_PTR_IN_ROM
+    uint32_t listed = pgm_read_byte(kXdrvList + x);
+#else
+    uint32_t listed = kXdrvList[x];
+#endif
+    if (driver == listed) {
+      return x;
+    }
+  }
+  return -1;
+}
+
+uint32_t XdrvIndex(uint32_t x)
+{
+#ifdef XFUNC_PTR_IN_ROM
+  return pgm_read_byte(kXdrvList + x);
+#else
+  return kXdrvList[x];
+#endif
+}
+
+bool XdrvCallSlot(uint32_t x, uint8_t Function)
+{
+  bool result = false;
+  if (x < xdrv_present) {
+    PROFILE_STATS_START(profile_stats_start);
+    result = xdrv_func_ptr[x](Function);
+    PROFILE_STATS(PRF_XDRV, x, Function, profile_stats_start);
+  }
+  return result;
+}
+
 /*********************************************************************************************\
  * Function call to all xdrv
 \*********************************************************************************************/
@@ -1142,9 +1181,12 @@ bool XdrvCall(uint8_t Function)
   for (uint32_t x = 0; x < xdrv_present; x++) {
 
     uint32_t profile_function_start = millis();
+    PROFILE_STATS_START(profile_stats_start);
 
     result = xdrv_func_ptr[x](Function);
 
+    PROFILE_STATS(PRF_XDRV, x, Function, profile_stats_start);
+
 #ifdef USE_PROFILE_FUNCTION
 #ifdef XFUNC_PTR_IN_ROM
       uint32_t index = pgm_read_byte(kXdrvList + x);
@@ -1157,6 +1199,7 @@ bool XdrvCall(uint8_t Function)
     if (result && ((FUNC_COMMAND == Function) ||
                    (FUNC_COMMAND_DRIVER == Function) ||
                    (FUNC_MQTT_DATA == Function) ||
+                   (FUNC_MQTT_DATA_STREAM == Function) ||
                    (FUNC_RULES_PROCESS == Function) ||
                    (FUNC_BUTTON_PRESSED == Function) ||
                    (FUNC_SERIAL == Function) ||
@@ -1165,6 +1208,10 @@ bool XdrvCall(uint8_t Function)
                    (FUNC_PIN_STATE == Function) ||
                    (FUNC_SET_DEVICE_POWER == Function)
                   )) {
+      if (FUNC_COMMAND == Function) {
+        CommandCache.found.owner = CMND_OWNER_XDRV;
+        CommandCache.found.slot = x;
+      }
       break;
     }
   }
@@ -172,7 +172,10 @@ bool XnrgCall(uint8_t function)
     }
   }
   else if (TasmotaGlobal.energy_driver) {
-    return xnrg_func_ptr[xnrg_active](function);
+    PROFILE_STATS_START(profile_stats_start);
+    bool result = xnrg_func_ptr[xnrg_active](function);
+    PROFILE_STATS(PRF_XNRG, TasmotaGlobal.energy_driver, function, profile_stats_start);
+    return result;
   }
   return false;
 }
@@ -1090,6 +1090,28 @@ void XsnsSensorState(uint32_t sensor_list) {
   ResponseAppend_P(PSTR("\""));
 }
 
+/*********************************************************************************************\
+ * Function call to xsns at position in list
+\*********************************************************************************************/
+
+uint32_t XsnsIndex(uint32_t x) {
+#ifdef XFUNC_PTR_IN_ROM
+  return pgm_read_byte(kXsnsList + x);
+#else
+  return kXsnsList[x];
+#endif
+}
+
+bool XsnsCallSlot(uint32_t x, uint8_t Function) {
+  bool result = false;
+  if ((x < xsns_present) && XsnsEnabled(0, x)) {  // Skip disabled sensor
+    PROFILE_STATS_START(profile_stats_start);
+    result = xsns_func_ptr[x](Function);
+    PROFILE_STATS(PRF_XSNS, x, Function, profile_stats_start);
+  }
+  return result;
+}
+
 /*********************************************************************************************\
  * Function call to all xsns
 \*********************************************************************************************/
@@ -1123,9 +1145,12 @@ bool XsnsCall(uint8_t Function) {
       if ((FUNC_WEB_SENSOR == Function) && !XsnsEnabled(1, x)) { continue; }  // Skip web info for disabled sensors
 
       uint32_t profile_function_start = millis();
+      PROFILE_STATS_START(profile_stats_start);
 
       result = xsns_func_ptr[x](Function);
 
+      PROFILE_STATS(PRF_XSNS, x, Function, profile_stats_start);
+
 #ifdef USE_PROFILE_FUNCTION
 #ifdef XFUNC_PTR_IN_ROM
       uint32_t index = pgm_read_byte(kXsnsList + x);
@@ -1139,6 +1164,10 @@ bool XsnsCall(uint8_t Function) {
                      (FUNC_PIN_STATE == Function) ||
                      (FUNC_COMMAND_SENSOR == Function)
                     )) {
+        if (FUNC_COMMAND == Function) {
+          CommandCache.found.owner = CMND_OWNER_XSNS;
+          CommandCache.found.slot = x;
+        }
         break;
       }
     }
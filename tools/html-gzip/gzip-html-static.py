@@ -0,0 +1,108 @@
+###############################################################
+# gzips the static parts of ..\..\tasmota\html_uncompressed
+# write gzipped C code to      ..\..\tasmota\html_gzipped
+# Instructions:
+# open a console, e.g. in vscode, open a 'terminal'
+# cd .\tools\html-gzip
+# run:
+# python gzip-html-static.py
+#
+# The output is served as is with 'Content-Encoding: gzip' and a strong
+# ETag derived from the content, see USE_WEB_STATIC_GZIP in xdrv_01_9_webserver.ino
+# As for the unishox compressed files, commit both uncompressed and gzipped to the repo.
+#
+# Only content without printf parameters can be served this way.
+###############################################################
+
+import gzip
+import zlib
+from os import path
+from datetime import datetime
+
+path_gzipped      = path.join('..','..','tasmota','html_gzipped')
+path_uncompressed = path.join('..','..','tasmota','html_uncompressed')
+
+# (source file, output name, suffix to remove as it stays inline in the page)
+# HTTP_SCRIPT_TEMPLATE.h is not listed: it ends inside a string the page completes with the GPIO list
+assets = [
+  ('HTTP_HEAD_LAST_SCRIPT.h',       'HTTP_HEAD_LAST_SCRIPT_GZ',       '</script>'),
+  ('HTTP_HEAD_LAST_SCRIPT32.h',     'HTTP_HEAD_LAST_SCRIPT32_GZ',     '</script>'),
+  ('HTTP_SCRIPT_MODULE_TEMPLATE.h', 'HTTP_SCRIPT_MODULE_TEMPLATE_GZ', ''),
+  ('HTTP_HEAD_STYLE_ZIGBEE.h',      'HTTP_HEAD_STYLE_ZIGBEE_GZ',      ''),
+]
+
+def extract_c_string(s: str) -> str:
+  # returns the content of the C string on this line, ignoring comments
+  state = 0
+  out = ""
+  i = 0
+  while i < len(s):
+    c = s[i]
+    if state == 0:    # before string
+      if c == '"':
+        state = 1
+      elif c == '/':  # comment before string
+        break
+    elif state == 1:  # in string
+      if c == '\\':
+        out += s[i:i+2]
+        i += 1
+      elif c == '"':
+        state = 0     # more strings may follow on the same line
+      else:
+        out += c
+    i += 1
+  return out
+
+def c_unescape(s: str) -> str:
+  out = ""
+  i = 0
+  esc = { 'n': '\n', 'r': '\r', 't': '\t', 'f': '\f', 'b': '\b', '"': '"', '\'': '\'', '\\': '\\' }
+  while i < len(s):
+    if s[i] == '\\' and i + 1 < len(s):
+      out += esc.get(s[i+1], s[i+1])
+      i += 2
+    else:
+      out += s[i]
+      i += 1
+  return out
+
+for (file, name, suffix) in assets:
+  f = open(path_uncompressed + path.sep + file, "r")
+  lines = f.read().splitlines()
+  f.close()
+
+  text = ""
+  for line in lines:
+    if line.find("const char") > -1:
+      continue
+    text += extract_c_string(line)
+  text = c_unescape(text)
+  text = text.replace("%%", "%")        # content was sent through printf
+  if suffix and text.endswith(suffix):
+    text = text[:-len(suffix)]
+
+  in_bytes = text.encode('utf-8')
+  out_bytes = gzip.compress(in_bytes, 9, mtime=0)   # mtime=0 keeps the output reproducible
+  etag = "{:08x}".format(zlib.crc32(in_bytes) & 0xFFFFFFFF)
+
+  print("####### Parsing input from " + path_uncompressed + path.sep + file)
+  print("  gzipped from {i} to {o}, -{p:.1f}%".format(i=len(in_bytes), o=len(out_bytes), p=(100-(float(len(out_bytes))/float(len(in_bytes))*100))))
+
+  out = "/////////////////////////////////////////////////////////////////////\n"
+  out += "// gzipped by tools/html-gzip/gzip-html-static.py\n"
+  out += "/////////////////////////////////////////////////////////////////////\n\n"
+  out += "const size_t {n}_SIZE = {s};\n".format(n=name, s=len(out_bytes))
+  out += "#define      {n}_ETAG \"{e}\"\n".format(n=name, e=etag)
+  out += "const char {n}[] PROGMEM = ".format(n=name)
+  for i in range(0, len(out_bytes), 20):
+    chunk = "".join("\\x{:02X}".format(b) for b in out_bytes[i:i+20])
+    if i > 0:
+      out += "\n" + " " * (len("const char {n}[] PROGMEM = ".format(n=name)))
+    out += "\"" + chunk + "\""
+  out += ";\n"
+
+  f = open(path_gzipped + path.sep + name + ".h", "w")
+  f.write(out)
+  f.close()
+  print("####### Wrote output to " + path_gzipped + path.sep + name + ".h")
@@ -0,0 +1,205 @@
+// Host test and throughput report of the log ring buffer
+//
+// The ring buffer functions are taken unchanged from tasmota/tasmota_support/support.ino. Writers
+// serialize on a mutex like AddLogData() does on log_buffer_mutex, readers never lock.
+// - positions:  GetLog() from every position between tail and head, i.e. stale or forged web console
+//               positions, only returns complete records
+// - sequential: a reader that keeps up sees every record intact and in order
+// - threads:    writers and readers hammer the buffer, records copied by readers must be intact
+//               unless the writer overwrote them after GetLog() returned (counted as overwritten)
+//
+// sed -n '/^uint32_t LogBufferLength/,/^void AddLogData/p' ../../tasmota/tasmota_support/support.ino | head -n -1 > log_buffer.inc
+// g++ -O2 -pthread test-log-buffer.cpp -o test-log-buffer && ./test-log-buffer
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+const uint16_t LOG_BUFFER_SIZE = 4096;
+
+struct {
+  char *log_buffer;
+  uint32_t log_buffer_pointer;
+  uint32_t log_buffer_tail;
+  uint32_t uptime = 10;
+  uint8_t masterlog_level = 0;
+} TasmotaGlobal;
+
+bool GetLog(uint32_t req_loglevel, uint32_t* index_p, char** entry_pp, size_t* len_p);  // Prototype as added for .ino files
+
+#include "log_buffer.inc"
+
+static uint32_t checks = 0;
+static uint32_t failures = 0;
+
+#define CHECK(cond) do { checks++; if (!(cond)) { failures++; printf("  FAIL %s:%d %s\n", __FILE__, __LINE__, #cond); } } while (0)
+
+static std::mutex log_buffer_mutex;
+
+static void reset(void) {
+  memset(TasmotaGlobal.log_buffer, 0, LOG_BUFFER_SIZE);
+  TasmotaGlobal.log_buffer_pointer = 0;
+  TasmotaGlobal.log_buffer_tail = 0;
+}
+
+// Record text "w<writer> <sequence> <fill>" with the fill length and character derived from the sequence
+static void write(uint32_t writer, uint32_t sequence) {
+  char data[24];
+  snprintf(data, sizeof(data), "w%u %u ", writer, sequence);
+  char fill[256];
+  uint32_t fill_len = (sequence * 37) % 200;
+  memset(fill, 'a' + sequence % 26, fill_len);
+  fill[fill_len] = '\0';
+  std::lock_guard<std::mutex> lock(log_buffer_mutex);
+  LogBufferWrite(2, "00:00:00.000 ", data, fill, "");
+}
+
+static bool intact(const char *line, size_t len, uint32_t *writer, uint32_t *sequence) {
+  // len includes the '\1' delimiter
+  if ((len < 1) || (len > LOG_BUFFER_SIZE) || (line[len -1] != '\1')) { return false; }
+  int used = 0;
+  if (sscanf(line, "00:00:00.000 w%u %u %n", writer, sequence, &used) != 2 || !used) { return false; }
+  uint32_t fill_len = (*sequence * 37) % 200;
+  if (used + fill_len +1 != len) { return false; }
+  for (uint32_t i = 0; i < fill_len; i++) {
+    if (line[used + i] != (char)('a' + *sequence % 26)) { return false; }
+  }
+  return true;
+}
+
+static void positions(void) {
+  printf("positions\n");
+  reset();
+  for (uint32_t seq = 0; seq < 500; seq++) { write(0, seq); }   // Several laps
+  uint32_t tail = TasmotaGlobal.log_buffer_tail;
+  uint32_t head = TasmotaGlobal.log_buffer_pointer;
+  std::set<uint32_t> records, offsets;
+  for (uint32_t pos = tail; pos != head; pos = LogBufferNext(pos)) {
+    records.insert(pos);
+    offsets.insert(pos & 0xFFFF);
+  }
+
+  uint32_t tried = 0, bad = 0, resynced = 0;
+  for (uint32_t pos = tail; pos != head; pos++) {
+    if ((pos & 0xFFFF) >= LOG_BUFFER_SIZE) { pos = LogBufferNext(pos | 0xFFFF) -1; continue; }
+    uint32_t index = pos;
+    char *line;
+    size_t len;
+    tried++;
+    if (!GetLog(4, &index, &line, &len)) { continue; }
+    uint32_t writer, sequence;
+    if (!intact(line, len, &writer, &sequence) || !offsets.count(line - TasmotaGlobal.log_buffer -3)) { bad++; }
+    if (!records.count(pos)) { resynced++; }
+  }
+  for (uint32_t index = 1; index < 4; index++) {              // Old reader start position
+    uint32_t start = index;
+    char *line;
+    size_t len;
+    if (GetLog(4, &start, &line, &len)) { CHECK(len < LOG_BUFFER_SIZE); }
+  }
+  CHECK(0 == bad);
+  CHECK(resynced > 0);
+  printf("  %u positions, %u records, %u restarted at the tail\n", tried, (uint32_t)records.size(), resynced);
+}
+
+static void sequential(void) {
+  printf("sequential\n");
+  reset();
+  uint32_t index = 0;
+  uint32_t expected = 0;
+  uint32_t bad = 0;
+  for (uint32_t seq = 0; seq < 100000; seq++) {
+    write(0, seq);
+    if (seq % 5) { continue; }                                  // Read in bursts that fit the buffer
+    char *line;
+    size_t len;
+    while (GetLog(4, &index, &line, &len)) {
+      uint32_t writer, sequence;
+      if (!intact(line, len, &writer, &sequence) || (sequence != expected)) { bad++; }
+      expected = sequence +1;
+    }
+  }
+  char *line;
+  size_t len;
+  while (GetLog(4, &index, &line, &len)) {
+    uint32_t writer, sequence;
+    if (!intact(line, len, &writer, &sequence) || (sequence != expected)) { bad++; }
+    expected = sequence +1;
+  }
+  CHECK(0 == bad);
+  CHECK(100000 == expected);
+  printf("  %u records in order\n", expected);
+}
+
+static void threads(uint32_t writers, uint32_t readers, uint32_t ms) {
+  printf("threads: %u writers, %u readers\n", writers, readers);
+  reset();
+  std::atomic<bool> stop(false);
+  std::atomic<uint64_t> written(0), read(0), overwritten(0), corrupt(0), disorder(0);
+  std::vector<std::thread> pool;
+  for (uint32_t w = 0; w < writers; w++) {
+    pool.emplace_back([&, w]() {
+      uint32_t seq = 0;
+      while (!stop) { write(w, seq++); }
+      written += seq;
+    });
+  }
+  for (uint32_t r = 0; r < readers; r++) {
+    pool.emplace_back([&]() {
+      std::vector<int64_t> last(writers, -1);
+      uint32_t index = 0;
+      uint64_t n = 0, lost = 0, bad = 0, order = 0;
+      char copy[LOG_BUFFER_SIZE];
+      while (!stop) {
+        char *line;
+        size_t len;
+        if (!GetLog(4, &index, &line, &len)) { std::this_thread::yield(); continue; }
+        memcpy(copy, line, (len < sizeof(copy)) ? len : sizeof(copy));
+        uint32_t start = index -3 - len;                       // Records do not cross laps
+        uint32_t tail = __atomic_load_n(&TasmotaGlobal.log_buffer_tail, __ATOMIC_ACQUIRE);
+        uint32_t head = __atomic_load_n(&TasmotaGlobal.log_buffer_pointer, __ATOMIC_ACQUIRE);
+        if ((start - tail) > (head - tail)) {                  // Overwritten while copying
+          lost++;
+          continue;
+        }
+        uint32_t writer, sequence;
+        if ((len > sizeof(copy)) || !intact(copy, len, &writer, &sequence) || (writer >= writers)) {
+          bad++;
+          continue;
+        }
+        if ((int64_t)sequence <= last[writer]) { order++; }
+        last[writer] = sequence;
+        n++;
+      }
+      read += n;
+      overwritten += lost;
+      corrupt += bad;
+      disorder += order;
+    });
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+  stop = true;
+  for (auto &t : pool) { t.join(); }
+  CHECK(0 == corrupt);
+  CHECK(0 == disorder);
+  CHECK(read > 0);
+  printf("  %.0f writes/s, %.0f reads/s per reader, %.2f%% overwritten while copying\n",
+    written * 1000.0 / ms, read * 1000.0 / ms / readers, (read + overwritten) ? overwritten * 100.0 / (read + overwritten) : 0.0);
+}
+
+int main(int argc, char* argv[]) {
+  TasmotaGlobal.log_buffer = (char*)malloc(LOG_BUFFER_SIZE);
+  positions();
+  sequential();
+  threads(1, 4, 1000);
+  threads(3, 4, 1000);
+  printf("%u checks, %u failures\n", checks, failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,516 @@
+// Host benchmark of the Scripter variable-lookup cache in isvar()
+//
+// The name resolution part of isvar() and Script_VarCache() are taken unchanged from
+// tasmota/tasmota_xdrv_driver/xdrv_10_scripter.ino, up to where isvar() continues with JSON
+// and function names. Variables are laid out as Init_Scripter() does from the >D section of
+// three sample scripts. Running a section resolves every operand name in it as the interpreter
+// does, including array indexes, system variables and function names, which are no variables.
+// Command lines (=>) and the >W web section are left out, their variables are replaced in a copy
+// of the line outside the script text, where the cache does not apply. Every lookup must give the
+// same result with and without the cache, the cache only speeds up name resolution.
+//
+// F=../../tasmota/tasmota_xdrv_driver/xdrv_10_scripter.ino
+// sed -n '/^typedef union {/,/^} SCRIPT_TYPE;/{p;/^} SCRIPT_TYPE;/q}' $F > scripter_vars.inc
+// sed -n '/^struct T_INDEX {/,/^};/p' $F >> scripter_vars.inc
+// sed -n '/^struct GVARS {/,/^};/p' $F >> scripter_vars.inc
+// sed -n '/^struct SCRIPT_VCACHE {/,/^};/p' $F >> scripter_vars.inc
+// sed -n '/^#define NUM_RES/,/^#define STYPE/p' $F >> scripter_vars.inc
+// sed -n '/^\/\/ returns the cache slot for a name at lp/,/^#define USE_SCRIPT_JSON/p' $F | head -n -1 > scripter_isvar.inc
+// g++ -O2 test-scripter-vars.cpp -o test-scripter-vars && ./test-scripter-vars
+// add -DSCRIPT_VAR_CACHE=64 for the ESP8266 cache size
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include <vector>
+
+#ifndef SCRIPT_VAR_CACHE
+#define SCRIPT_VAR_CACHE 256                   // ESP32
+#endif
+#define SCRIPT_MAXSSIZE 48
+#define SCRIPT_EOL '\n'
+enum {OPER_EQU=1};
+
+class JsonParserObject;
+
+#include "scripter_vars.inc"
+
+struct {
+  char *script_ram;
+  uint16_t script_size;
+  struct SCRIPT_VCACHE *vcache;
+  uint8_t numvars;
+  char *glob_vnp;
+  uint8_t *vnp_offset;
+  struct T_INDEX *type;
+  float *fvars;
+  char *glob_snp;
+  uint8_t max_ssize;
+  uint8_t arres;
+  uint8_t var_not_found;
+} glob_script_mem;
+
+static size_t strlcpy(char *dst, const char *src, size_t size) {
+  size_t len = strlen(src);
+  if (size) {
+    size_t n = (len < size) ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return len;
+}
+
+static float CharToFloat(const char *str) { return strtof(str, nullptr); }
+static float Get_MFilter(uint8_t index) { return index; }
+static float Get_MFVal(uint8_t index, int16_t bind) { return index * 100 + bind; }
+char *isvar(char *lp, uint8_t *vtype, struct T_INDEX *tind, float *fp, char *sp, struct GVARS *gv);
+
+// Array index, a number or a name
+char *GetNumericArgument(char *lp, uint8_t lastop, float *fp, struct GVARS *gv) {
+  if (isdigit(*lp)) { return (char*)(*fp = strtof(lp, &lp), lp); }
+  uint8_t vtype;
+  struct T_INDEX ind;
+  return isvar(lp, &vtype, &ind, fp, 0, 0);
+}
+
+#include "scripter_isvar.inc"
+    // JSON and function names follow in isvar(), not affected by the cache
+    *vtype = VAR_NV;
+    tind->index = VAR_NV;
+    return lp;
+}
+
+static uint32_t checks = 0;
+static uint32_t failures = 0;
+
+#define CHECK(cond) do { checks++; if (!(cond)) { failures++; printf("  FAIL %s:%d %s\n", __FILE__, __LINE__, #cond); } } while (0)
+
+/*********************************************************************************************\
+ * Sample scripts
+\*********************************************************************************************/
+
+const char SML_SCRIPT[] = R"(>D
+p:sday=0
+p:smonth=0
+day=0
+month=0
+pin=0
+pout=0
+pcur=0
+pl1=0
+pl2=0
+pl3=0
+psum=0
+pavg=0
+pmax=0
+cnt=0
+today=0
+export=0
+M:hist=0 24
+str=""
+>B
+=>sensor53 r
+>S
+pin=sml[1]
+pout=sml[2]
+pcur=sml[3]
+pl1=sml[4]
+pl2=sml[5]
+pl3=sml[6]
+psum=pl1+pl2+pl3
+cnt+=1
+pavg=(pavg*(cnt-1)+pcur)/cnt
+if pcur>pmax
+then
+pmax=pcur
+endif
+if chg[pin]>0
+then
+today=pin-sday
+endif
+if pout>0 and pcur<0
+then
+export=pout-smonth
+endif
+if upsecs%60==0
+then
+hist[hours+1]=pavg
+cnt=0
+endif
+if day!=wday
+then
+day=wday
+sday=pin
+svars
+endif
+if month!=month
+then
+month=month
+smonth=pin
+endif
+>T
+pcur=ENERGY#Power
+>W
+Power today{m}%3today% kWh
+Max{m}%0pmax% W
+)";
+
+const char HEATING_SCRIPT[] = R"(>D
+temp=0
+hum=0
+set=21.5
+hyst=0.3
+night=17
+day=21.5
+heat=0
+boost=0
+btime=0
+window=0
+wtemp=0
+M:tbuf=0 10
+tavg=0
+dt=0
+ptemp=0
+on=0
+off=0
+runtime=0
+>B
+tbuf=temp
+>S
+temp=BME280#Temperature
+hum=BME280#Humidity
+tbuf=temp
+tavg=tbuf
+dt=temp-ptemp
+ptemp=temp
+if dt<-0.5
+then
+window=1
+wtemp=temp
+endif
+if window==1 and temp>wtemp+0.5
+then
+window=0
+endif
+if hours>=6 and hours<22
+then
+set=day
+else
+set=night
+endif
+if boost>0
+then
+btime-=1
+if btime<=0
+then
+boost=0
+endif
+set=set+2
+endif
+if window==0 and tavg<set-hyst and heat==0
+then
+heat=1
+on+=1
+=>power1 1
+endif
+if (window==1 or tavg>set+hyst) and heat==1
+then
+heat=0
+off+=1
+=>power1 0
+endif
+if heat==1
+then
+runtime+=1
+endif
+)";
+
+const char SOLAR_SCRIPT[] = R"(>D
+pv=0
+pv1=0
+pv2=0
+grid=0
+load=0
+bat=0
+soc=0
+socmin=20
+socmax=95
+charge=0
+dcharge=0
+pcharge=0
+pdis=0
+limit=600
+surplus=0
+avail=0
+wb=0
+wbset=0
+wbmin=1400
+wbmax=11000
+wbstep=230
+heater=0
+hset=0
+pool=0
+pset=0
+cost=0
+earn=0
+tarif=0.32
+feed=0.08
+ein=0
+eout=0
+pein=0
+peout=0
+self=0
+auto=0
+cnt=0
+err=0
+M:pvh=0 24
+M:gridh=0 24
+>S
+pv1=sml[1]
+pv2=sml[2]
+pv=pv1+pv2
+grid=sml[3]
+bat=sml[4]
+soc=sml[5]
+ein=sml[6]
+eout=sml[7]
+load=pv+grid-bat
+surplus=-grid
+avail=surplus+bat
+if soc<socmin
+then
+pdis=0
+elseif soc>socmax
+then
+pcharge=0
+else
+pcharge=limit
+pdis=limit
+endif
+if avail>wbmin and auto==1
+then
+wbset=int(avail/wbstep)*wbstep
+if wbset>wbmax
+then
+wbset=wbmax
+endif
+wb=1
+else
+wbset=0
+wb=0
+endif
+if surplus>2000 and soc>80
+then
+hset=1
+else
+hset=0
+endif
+if hset!=heater
+then
+heater=hset
+endif
+if surplus>500 and hours>10 and hours<17
+then
+pset=1
+else
+pset=0
+endif
+if pset!=pool
+then
+pool=pset
+endif
+cost=cost+(ein-pein)*tarif
+earn=earn+(eout-peout)*feed
+pein=ein
+peout=eout
+if load>0
+then
+self=(load-grid)/load*100
+endif
+if upsecs%3600==0
+then
+pvh[hours+1]=pv
+gridh[hours+1]=grid
+endif
+cnt+=1
+if sml[8]==0
+then
+err+=1
+endif
+)";
+
+/*********************************************************************************************\
+ * Variables from the >D section as Init_Scripter() lays them out
+\*********************************************************************************************/
+
+struct Script {
+  const char *name;
+  char *ram;
+  std::vector<char> names;
+  std::vector<uint8_t> offsets;
+  std::vector<struct T_INDEX> types;
+  std::vector<float> fvars;
+  std::vector<char> strings;
+  std::vector<struct SCRIPT_VCACHE> vcache;
+  std::vector<char*> operands;            // Positions resolved per run
+};
+
+static void load(Script &script, const char *text) {
+  script.ram = strdup(text);
+  char *lp = strstr(script.ram, ">D");
+  lp = strchr(lp, SCRIPT_EOL) + 1;
+  uint32_t nvars = 0;
+  uint32_t svars = 0;
+  while (*lp && *lp != '>') {
+    char *eq = strchr(lp, '=');
+    char *eol = strchr(lp, SCRIPT_EOL);
+    struct T_INDEX type = {};
+    if (lp[1] == ':') {
+      if (lp[0] == 'M') { type.bits.is_filter = 1; }
+      lp += 2;
+    }
+    script.offsets.push_back(script.names.size());
+    script.names.insert(script.names.end(), lp, eq);
+    script.names.push_back(0);
+    if (eq[1] == '"') {
+      type.bits.is_string = 1;
+      type.index = svars++;
+    } else {
+      type.index = nvars++;
+      script.fvars.push_back(strtof(eq + 1, nullptr));
+    }
+    script.types.push_back(type);
+    lp = eol + 1;
+  }
+  script.strings.resize(SCRIPT_MAXSSIZE * (svars + 1));
+  script.vcache.resize(SCRIPT_VAR_CACHE);
+
+  // Operand names of the run time sections
+  static const char *keywords[] = { "if", "then", "else", "elseif", "endif", "and", "or", "svars", "for", "next", "print", nullptr };
+  bool skip_section = false;
+  for (char *line = lp; line && *line; line = strchr(line, SCRIPT_EOL), line = line ? line + 1 : nullptr) {
+    if (*line == '>') {
+      skip_section = (line[1] == 'W');
+      continue;
+    }
+    if (skip_section || !strncmp(line, "=>", 2)) { continue; }
+    for (char *cp = line; *cp && *cp != SCRIPT_EOL; cp++) {
+      if (*cp == '"') {
+        cp = strchr(cp + 1, '"');
+        continue;
+      }
+      if (*cp == ';') { break; }
+      if ((!isalpha(*cp) && *cp != '_') || ((cp > line) && (isalnum(cp[-1]) || cp[-1] == '#' || cp[-1] == '.'))) { continue; }
+      uint32_t len = 0;
+      while (isalnum(cp[len]) || cp[len] == '_') { len++; }
+      bool keyword = false;
+      for (const char **kp = keywords; *kp; kp++) {
+        if ((strlen(*kp) == len) && !strncmp(*kp, cp, len)) { keyword = true; }
+      }
+      if (!keyword) { script.operands.push_back(cp); }
+      cp += len - 1;
+    }
+  }
+}
+
+static void select(Script &script, bool cache) {
+  glob_script_mem.script_ram = script.ram;
+  glob_script_mem.script_size = strlen(script.ram);
+  glob_script_mem.numvars = script.types.size();
+  glob_script_mem.glob_vnp = script.names.data();
+  glob_script_mem.vnp_offset = script.offsets.data();
+  glob_script_mem.type = script.types.data();
+  glob_script_mem.fvars = script.fvars.data();
+  glob_script_mem.glob_snp = script.strings.data();
+  glob_script_mem.max_ssize = SCRIPT_MAXSSIZE;
+  memset(script.vcache.data(), 0, script.vcache.size() * sizeof(struct SCRIPT_VCACHE));
+  glob_script_mem.vcache = (cache) ? script.vcache.data() : nullptr;
+}
+
+/*********************************************************************************************\
+ * Equivalence and timing
+\*********************************************************************************************/
+
+struct Result {
+  char *next;
+  uint8_t vtype;
+  uint8_t index;
+  float value;
+  char str[SCRIPT_MAXSSIZE];
+};
+
+static Result resolve(char *lp) {
+  Result result = {};
+  struct T_INDEX ind;
+  result.next = isvar(lp, &result.vtype, &ind, &result.value, result.str, nullptr);
+  result.index = ind.index;
+  return result;
+}
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static volatile uintptr_t sink;
+
+static double run_ns(Script &script, bool cache, uint32_t runs) {
+  select(script, cache);
+  double t = now_ns();
+  for (uint32_t r = 0; r < runs; r++) {
+    for (char *lp : script.operands) {
+      uint8_t vtype;
+      struct T_INDEX ind;
+      float value;
+      sink += (uintptr_t)isvar(lp, &vtype, &ind, &value, nullptr, nullptr) + vtype;
+    }
+  }
+  return (now_ns() - t) / runs;
+}
+
+static void test(const char *name, const char *text) {
+  Script script;
+  script.name = name;
+  load(script, text);
+  uint32_t vars = 0;
+  uint32_t others = 0;
+  select(script, false);
+  std::vector<Result> expected;
+  for (char *lp : script.operands) {
+    expected.push_back(resolve(lp));
+    (VAR_NV == expected.back().vtype) ? others++ : vars++;
+  }
+  // Repeated runs with the cache, the first one fills it
+  select(script, true);
+  uint32_t differ = 0;
+  for (uint32_t r = 0; r < 3; r++) {
+    for (uint32_t i = 0; i < script.operands.size(); i++) {
+      Result result = resolve(script.operands[i]);
+      if ((result.next != expected[i].next) || (result.vtype != expected[i].vtype) || (result.index != expected[i].index) ||
+          (result.value != expected[i].value) || strcmp(result.str, expected[i].str)) {
+        differ++;
+      }
+    }
+  }
+  CHECK(0 == differ);
+  CHECK(vars > 0);
+  const uint32_t runs = 20000;
+  double before = run_ns(script, false, runs);
+  double after = run_ns(script, true, runs);
+  printf("  %-8s %2u vars, %3u names per run (%3u vars, %2u others), before %6.0f ns, after %6.0f ns per run, %.1fx\n",
+    name, (uint32_t)script.types.size(), (uint32_t)script.operands.size(), vars, others, before, after, before / after);
+  free(script.ram);
+}
+
+int main(int argc, char* argv[]) {
+  printf("name resolution per section run, variable-lookup cache of %u slots\n", SCRIPT_VAR_CACHE);
+  test("sml", SML_SCRIPT);
+  test("heating", HEATING_SCRIPT);
+  test("solar", SOLAR_SCRIPT);
+  printf("%u checks, %u failures\n", checks, failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,181 @@
+// Host test of the indexed Settings text pool against the original linear walk
+//
+// The text pool functions are taken unchanged from tasmota/tasmota_support/settings.ino. The reference
+// below is the linear implementation they replaced. Both pools get the same random updates, including
+// sources inside the pool, overflows and whole pool replacements, and must stay byte identical.
+//
+// sed -n '/^uint16_t settings_text_index\[SET_MAX\]/,/^ \* Config dirty block tracking/p' ../../tasmota/tasmota_support/settings.ino | head -n -2 > settings_text.inc
+// g++ -O2 test-settings-text.cpp -o test-settings-text && ./test-settings-text
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define SET_MAX                   120         // Close to the ESP32 number of texts
+const uint32_t settings_text_size = 699;
+
+#define PSTR(x)                   (x)
+#define D_LOG_CONFIG              "CFG: "
+#define LOG_LEVEL_INFO            2
+#define LOG_LEVEL_DEBUG           3
+#define strlen_P                  strlen
+#define memcpy_P                  memcpy
+#define memmove_P                 memmove
+
+struct {
+  char text_pool[settings_text_size];
+} SettingsData;
+decltype(SettingsData) *Settings = &SettingsData;
+
+static uint32_t overflows = 0;
+void AddLog(uint32_t level, const char *format, ...) { if (LOG_LEVEL_INFO == level) { overflows++; } }
+void yield(void) {}
+void delayMicroseconds(uint32_t us) {}
+void TopicCacheReset(void) {}
+
+#include "settings_text.inc"
+
+/*********************************************************************************************\
+ * Linear walk as before the text offset index
+\*********************************************************************************************/
+
+char linear_pool[settings_text_size];
+
+uint32_t LinearTextLen(void) {
+  char* position = linear_pool;
+  for (uint32_t size = 0; size < SET_MAX; size++) {
+    while (*position++ != '\0') { }
+  }
+  return position - linear_pool;
+}
+
+bool LinearUpdateText(uint32_t index, const char* replace_me) {
+  if (index >= SET_MAX) { return false; }
+  uint32_t replace_len = strlen(replace_me);
+  char replace[replace_len +1];
+  memcpy(replace, replace_me, sizeof(replace));
+
+  uint32_t start_pos = 0;
+  uint32_t end_pos = 0;
+  char* position = linear_pool;
+  for (uint32_t size = 0; size < SET_MAX; size++) {
+    while (*position++ != '\0') { }
+    if (1 == index) {
+      start_pos = position - linear_pool;
+    }
+    else if (0 == index) {
+      end_pos = position - linear_pool -1;
+    }
+    index--;
+  }
+  uint32_t char_len = position - linear_pool;
+  uint32_t current_len = end_pos - start_pos;
+  int diff = replace_len - current_len;
+  if ((int)((char_len + diff) - settings_text_size) > 0) { return false; }
+  if (diff != 0) {
+    memmove(linear_pool + start_pos + replace_len, linear_pool + end_pos, char_len - end_pos);
+  }
+  memmove(linear_pool + start_pos, replace, replace_len);
+  memset(linear_pool + char_len + diff, 0x00, settings_text_size - char_len - diff);
+  return true;
+}
+
+char* LinearText(uint32_t index) {
+  char* position = linear_pool;
+  if (index >= SET_MAX) {
+    position += settings_text_size -1;
+  } else {
+    for (;index > 0; index--) {
+      while (*position++ != '\0') { }
+    }
+  }
+  return position;
+}
+
+/********************************************************************************************/
+
+static uint32_t checks = 0;
+static uint32_t failures = 0;
+
+#define CHECK(cond) do { checks++; if (!(cond)) { failures++; printf("  FAIL %s:%d %s\n", __FILE__, __LINE__, #cond); } } while (0)
+
+static bool same(void) {
+  if (memcmp(Settings->text_pool, linear_pool, settings_text_size)) { return false; }
+  if (GetSettingsTextLen() != LinearTextLen()) { return false; }
+  for (uint32_t i = 0; i <= SET_MAX; i++) {     // SET_MAX returns the empty last byte
+    if (SettingsText(i) - Settings->text_pool != LinearText(i) - linear_pool) { return false; }
+  }
+  return true;
+}
+
+static void random_text(char *text, uint32_t max) {
+  uint32_t len = rand() % max;
+  for (uint32_t i = 0; i < len; i++) { text[i] = 'a' + rand() % 26; }
+  text[len] = '\0';
+}
+
+static void update(uint32_t index, const char *text, const char *linear_text) {
+  bool indexed = SettingsUpdateText(index, text);
+  bool linear = LinearUpdateText(index, linear_text);
+  CHECK(indexed == linear);
+}
+
+int main(int argc, char* argv[]) {
+  srand(1);
+  char text[64];
+
+  printf("random updates\n");
+  uint32_t mismatch = 0;
+  for (uint32_t n = 0; n < 200000; n++) {
+    uint32_t index = rand() % (SET_MAX +1);     // Includes the invalid index
+    switch (rand() % 8) {
+      case 0: {                                 // Source inside the pool
+        uint32_t from = rand() % SET_MAX;
+        update(index, SettingsText(from), LinearText(from));
+        break;
+      }
+      case 1:                                   // Large texts fill the pool to overflow
+        random_text(text, sizeof(text));
+        update(index, text, text);
+        update((index +1) % SET_MAX, text, text);
+        break;
+      case 2:
+        update(index, "", "");
+        break;
+      case 3:
+        if (0 == rand() % 64) {                 // Pool replaced as a whole, like SettingsLoad()
+          for (uint32_t i = 0; i < SET_MAX; i++) {
+            random_text(text, 6);
+            LinearUpdateText(i, text);
+          }
+          memcpy(Settings->text_pool, linear_pool, settings_text_size);
+          SettingsTextIndexReset();
+        }
+        break;
+      default:
+        random_text(text, 12);
+        update(index, text, text);
+    }
+    if (!same()) { mismatch++; }
+  }
+  CHECK(0 == mismatch);
+  CHECK(overflows > 0);
+  printf("  %u overflows refused, pool %u/%u\n", overflows, GetSettingsTextLen(), settings_text_size);
+
+  printf("lookups of the last text\n");
+  const uint32_t loops = 1000000;
+  uint32_t sum = 0;
+  clock_t start = clock();
+  for (uint32_t n = 0; n < loops; n++) { sum += SettingsText(SET_MAX -1 - (n & 1))[0]; }
+  double indexed_ns = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / loops;
+  start = clock();
+  for (uint32_t n = 0; n < loops; n++) { sum -= LinearText(SET_MAX -1 - (n & 1))[0]; }
+  double linear_ns = (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / loops;
+  CHECK(0 == sum);
+  printf("  indexed %.1f ns, linear %.1f ns\n", indexed_ns, linear_ns);
+
+  printf("%u checks, %u failures\n", checks, failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+"""Writes the meter byte streams replayed by test-sml-decode.cpp
+
+Capture format, a sequence of bursts as read from the meter serial port:
+  4 bytes millis() when the first byte of the burst arrived, big endian
+  2 bytes length, big endian
+  length bytes received, the bytes of a burst follow each other at the line speed
+
+ehz-sml.cap   eHZ style SML push telegram every second, 9600 baud, with line noise between
+              telegrams and a truncated telegram
+d0-obis.cap   D0 optical interface OBIS telegram every 2 seconds, 9600 baud 7E1 read as 8N1
+              (parity bit set on some bytes)
+"""
+
+import random
+import struct
+
+random.seed(53)
+
+
+def burst(millis, data):
+    return struct.pack(">IH", millis, len(data)) + data
+
+
+# SML type length fields
+def tl(kind, data):
+    return bytes([kind | (len(data) + 1)]) + data
+
+
+def octets(data):
+    return tl(0x00, data)
+
+
+def unsigned(value, size):
+    return tl(0x60, value.to_bytes(size, "big"))
+
+
+def signed(value, size):
+    return tl(0x50, value.to_bytes(size, "big", signed=True))
+
+
+def sml_list(*items):
+    return bytes([0x70 | len(items)]) + b"".join(items)
+
+
+EMPTY = b"\x01"
+
+
+def entry(obis, unit, scaler, value):
+    # SML_ListEntry: objName, status, valTime, unit, scaler, value, valueSignature
+    status = unsigned(0x0182, 3) if obis.endswith(b"\x08\x00\xff") else EMPTY
+    return sml_list(octets(obis), status, EMPTY, unit, scaler, value, EMPTY)
+
+
+def crc16_x25(data):
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = (crc >> 1) ^ 0x8408 if crc & 1 else crc >> 1
+    return crc ^ 0xFFFF
+
+
+def sml_message(transaction, body):
+    # SML_Message: transactionId, groupNo, abortOnError, messageBody, crc16, endOfSmlMsg
+    message = b"\x76" + octets(transaction) + unsigned(0, 1) + unsigned(0, 1) + body
+    return message + tl(0x60, crc16_x25(message).to_bytes(2, "big")) + b"\x00"
+
+
+SERVER_ID = bytes.fromhex("0a01454d4800005f3a29")
+
+
+def sml_telegram(sequence, energy_in, energy_out, power):
+    open_response = sml_list(unsigned(0x0101, 3), EMPTY, EMPTY, octets(b"\x00" + sequence.to_bytes(4, "big")),
+                             octets(SERVER_ID), EMPTY, EMPTY)
+    values = sml_list(
+        entry(bytes.fromhex("8181c78203ff"), EMPTY, EMPTY, octets(b"EMH")),
+        entry(bytes.fromhex("0100000009ff"), EMPTY, EMPTY, octets(SERVER_ID)),
+        entry(bytes.fromhex("0100010800ff"), unsigned(0x1e, 1), signed(-1, 1), unsigned(energy_in, 8)),
+        entry(bytes.fromhex("0100020800ff"), unsigned(0x1e, 1), signed(-1, 1), unsigned(energy_out, 8)),
+        entry(bytes.fromhex("0100100700ff"), unsigned(0x1b, 1), signed(0, 1), signed(power, 4)),
+    )
+    list_response = sml_list(EMPTY, octets(SERVER_ID), octets(b"\x00"), EMPTY, values, EMPTY, EMPTY)
+    data = b"\x1b\x1b\x1b\x1b\x01\x01\x01\x01"
+    data += sml_message(b"\x00\x01" + sequence.to_bytes(2, "big"), sml_list(unsigned(0x0101, 3), open_response))
+    data += sml_message(b"\x00\x02" + sequence.to_bytes(2, "big"), sml_list(unsigned(0x0701, 3), list_response))
+    data += sml_message(b"\x00\x03" + sequence.to_bytes(2, "big"), sml_list(unsigned(0x0201, 3), sml_list(EMPTY)))
+    pad = (4 - len(data) % 4) % 4
+    data += b"\x00" * pad + b"\x1b\x1b\x1b\x1b\x1a" + bytes([pad])
+    return data + crc16_x25(data).to_bytes(2, "big")
+
+
+def ehz():
+    out = b""
+    energy_in = 123456789                        # 0.1 Wh
+    energy_out = 4567890
+    millis = 1000
+    for sequence in range(90):
+        power = int(1500 + 1200 * random.random()) - (3000 if 40 <= sequence < 55 else 0)
+        if power >= 0:
+            energy_in += power * 10 // 3600
+        else:
+            energy_out -= power * 10 // 3600
+        telegram = sml_telegram(sequence, energy_in, energy_out, power)
+        if sequence == 30:
+            telegram = telegram[:150]            # Meter interrupted
+        if sequence % 7 == 3:
+            telegram = bytes(random.randrange(256) for _ in range(random.randrange(1, 40))) + telegram
+        out += burst(millis, telegram)
+        millis += 1000 + random.randrange(-20, 20)
+    return out
+
+
+def parity7e1(data):
+    return bytes(b | 0x80 if bin(b).count("1") & 1 else b for b in data)
+
+
+def d0():
+    out = b""
+    energy_in = 12345.6789
+    energy_out = 123.4560
+    millis = 700
+    for sequence in range(45):
+        power = 300 + 2500 * random.random()
+        energy_in += power * 2 / 3600000
+        lines = [
+            "/ESY5Q3DA1004 V3.04",
+            "",
+            "1-0:0.0.0*255(1ESY1160000342)",
+            "1-0:1.8.0*255(%013.4f*kWh)" % energy_in,
+            "1-0:2.8.0*255(%013.4f*kWh)" % energy_out,
+            "1-0:21.7.255*255(%011.2f*W)" % (power / 3),
+            "1-0:1.7.255*255(%011.2f*W)" % power,
+            "1-0:96.5.5*255(82)",
+            "0-0:96.1.255*255(1ESY1160000342)",
+            "!",
+        ]
+        telegram = ("\r\n".join(lines) + "\r\n").encode()
+        out += burst(millis, parity7e1(telegram))
+        millis += 2000 + random.randrange(-30, 30)
+    return out
+
+
+with open("ehz-sml.cap", "wb") as f:
+    f.write(ehz())
+with open("d0-obis.cap", "wb") as f:
+    f.write(d0())
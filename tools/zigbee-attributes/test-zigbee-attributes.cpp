@@ -0,0 +1,203 @@
+// Host test of the Zigbee attribute lookup by id and by name against the linear scan
+//
+// Z_PostProcess, Z_strings, the generated Z_PostProcess_by_id / Z_PostProcess_by_name indexes and
+// Z_PostProcessFindId() / Z_PostProcessFindName() are taken unchanged from
+// tasmota/tasmota_xdrv_driver/xdrv_23_zigbee_5_converters.ino and xdrv_23_zigbee_5__constants.ino.
+// Every attribute of the table is looked up by cluster/attribute and by name, in mixed case, with
+// its own cluster, with other clusters and with any cluster, together with keys that are not in the
+// table. Every indexed lookup must return the same entry as the linear scan it replaced, which
+// finds the first match in table order.
+//
+// Z=../../tasmota/tasmota_xdrv_driver
+// sed -n '/^enum Z_DataTypes {/,/^};/p' $Z/xdrv_23_zigbee_5_converters.ino > zigbee_attributes.inc
+// sed -n '/^enum Z_Alarm_Type {/,/^};/p' $Z/xdrv_23_zigbee_2_devices.ino >> zigbee_attributes.inc
+// sed -n '/^const char Z_strings\[\] PROGMEM =/,/^};/p' $Z/xdrv_23_zigbee_5__constants.ino >> zigbee_attributes.inc
+// sed -n '/^#define Z_POSTPROCESS_LEN/,/^const uint16_t Z_PostProcess_by_name/p' $Z/xdrv_23_zigbee_5__constants.ino | head -n -1 >> zigbee_attributes.inc
+// sed -n '/^const uint16_t Z_PostProcess_by_name/,/^};/p' $Z/xdrv_23_zigbee_5__constants.ino >> zigbee_attributes.inc
+// sed -n '/^typedef struct Z_AttributeConverter {/,/^uint8_t ClusterToCx/p' $Z/xdrv_23_zigbee_5_converters.ino | head -n -1 >> zigbee_attributes.inc
+// sed -n '/^enum Cm_multiplier_nibble {/,/^};/p' $Z/xdrv_23_zigbee_5_converters.ino >> zigbee_attributes.inc
+// sed -n '/^const Z_AttributeConverter Z_PostProcess\[\] PROGMEM = {/,/^typedef union ZCLHeaderFrameControl_t/p' $Z/xdrv_23_zigbee_5_converters.ino | head -n -1 > zigbee_find.inc
+// g++ -O2 test-zigbee-attributes.cpp -o test-zigbee-attributes && ./test-zigbee-attributes
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <time.h>
+#include <stddef.h>
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define strcasecmp_P strcasecmp
+#define strncpy_P strncpy
+#define nitems(_a) (sizeof((_a)) / sizeof((_a)[0]))
+
+#include "zigbee_attributes.inc"
+
+#undef Z_MAPPING
+#define Z_MAPPING(c,a) 0              // Z_Data classes are not needed for lookups
+#define Z_(s) Zo_ ## s
+
+#include "zigbee_find.inc"
+
+static uint32_t checks = 0;
+static uint32_t failures = 0;
+
+#define CHECK(cond) do { checks++; if (!(cond)) { failures++; printf("  FAIL %s:%d %s\n", __FILE__, __LINE__, #cond); } } while (0)
+
+/*********************************************************************************************\
+ * Linear scans as before the indexes
+\*********************************************************************************************/
+
+int32_t LinearFindId(uint16_t cluster, uint16_t attr_id) {
+  for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
+    const Z_AttributeConverter *converter = &Z_PostProcess[i];
+    uint16_t conv_cluster = CxToCluster(pgm_read_byte(&converter->cluster_short));
+    uint16_t conv_attr_id = pgm_read_word(&converter->attribute);
+    if ((conv_cluster == cluster) && (conv_attr_id == attr_id)) { return i; }
+  }
+  return -1;
+}
+
+int32_t LinearFindName(const char * name, uint16_t cluster = 0xFFFF) {
+  if ((nullptr == name) || (0 == name[0])) { return -1; }
+  for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
+    const Z_AttributeConverter *converter = &Z_PostProcess[i];
+    if (0 == pgm_read_word(&converter->name_offset)) { continue; }
+    if (0 == strcasecmp_P(name, Z_strings + pgm_read_word(&converter->name_offset))) {
+      if ((0xFFFF == cluster) || (CxToCluster(pgm_read_byte(&converter->cluster_short)) == cluster)) { return i; }
+    }
+  }
+  return -1;
+}
+
+/*********************************************************************************************\
+ * Equivalence
+\*********************************************************************************************/
+
+static uint32_t seed = 12345;
+
+static uint32_t random32(void) {
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+static void mixcase(char * name) {
+  for (char * p = name; *p; p++) {
+    if (random32() & 1) { *p = isupper(*p) ? tolower(*p) : toupper(*p); }
+  }
+}
+
+static uint32_t lookups = 0;
+
+static void same_id(uint16_t cluster, uint16_t attr_id) {
+  CHECK(Z_PostProcessFindId(cluster, attr_id) == LinearFindId(cluster, attr_id));
+  lookups++;
+}
+
+static void same_name(const char * name, uint16_t cluster) {
+  CHECK(Z_PostProcessFindName(name, cluster) == LinearFindName(name, cluster));
+  CHECK(Z_PostProcessFindName(name) == LinearFindName(name));
+  lookups += 2;
+}
+
+static void compare(void) {
+  uint32_t before = failures;
+  uint32_t duplicates = 0;
+  for (uint32_t i = 0; i < nitems(Z_PostProcess); i++) {
+    uint16_t cluster = CxToCluster(Z_PostProcess[i].cluster_short);
+    uint16_t attr_id = Z_PostProcess[i].attribute;
+    same_id(cluster, attr_id);
+    same_id(cluster, attr_id + 1);
+    same_id(cluster, attr_id - 1);
+    if (LinearFindId(cluster, attr_id) != (int32_t)i) { duplicates++; }
+    if (0 == Z_PostProcess[i].name_offset) { continue; }
+    char name[48];
+    strcpy(name, Z_strings + Z_PostProcess[i].name_offset);
+    same_name(name, cluster);
+    mixcase(name);
+    same_name(name, cluster);
+    same_name(name, CxToCluster(random32() % nitems(Cx_cluster)));
+    same_name(name, 0x1234);
+    strcat(name, "x");                                                  // longer and shorter names sort next to it
+    same_name(name, 0xFFFF);
+    name[strlen(name) - 2] = 0;
+    same_name(name, 0xFFFF);
+  }
+  for (uint32_t i = 0; i < nitems(Cx_cluster); i++) {                   // misses and the 0xFFFF entries
+    uint16_t cluster = CxToCluster(i);
+    same_id(cluster, 0xFFFF);
+    for (uint32_t j = 0; j < 20; j++) { same_id(cluster, random32()); }
+  }
+  same_id(0x1234, 0x0000);
+  same_id(0xFFFF, 0xFFFF);
+  same_name("", 0xFFFF);
+  CHECK(-1 == Z_PostProcessFindName(nullptr));
+  same_name("NoSuchAttribute", 0xFFFF);
+  same_name("0", 0xFFFF);
+  same_name("zzzz", 0xFFFF);
+  printf("  %u entries, %u lookups, %u ids with an earlier entry, %s\n", (uint32_t)nitems(Z_PostProcess), lookups, duplicates,
+    (failures == before) ? "same as linear scan" : "MISMATCH");
+}
+
+/*********************************************************************************************\
+ * Timing
+\*********************************************************************************************/
+
+const uint32_t ROUNDS = 2000;
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static volatile int32_t sink;
+
+static void bench(void) {
+  const uint32_t n = nitems(Z_PostProcess);
+  uint16_t cluster[n];
+  uint16_t attr_id[n];
+  const char * name[n];
+  uint32_t names = 0;
+  for (uint32_t i = 0; i < n; i++) {
+    cluster[i] = CxToCluster(Z_PostProcess[i].cluster_short);
+    attr_id[i] = Z_PostProcess[i].attribute;
+    if (Z_PostProcess[i].name_offset) { name[names++] = Z_strings + Z_PostProcess[i].name_offset; }
+  }
+  double t = now_ns();
+  for (uint32_t r = 0; r < ROUNDS; r++) { for (uint32_t i = 0; i < n; i++) { sink += LinearFindId(cluster[i], attr_id[i]); } }
+  double id_linear = (now_ns() - t) / (ROUNDS * n);
+  t = now_ns();
+  for (uint32_t r = 0; r < ROUNDS; r++) { for (uint32_t i = 0; i < n; i++) { sink += Z_PostProcessFindId(cluster[i], attr_id[i]); } }
+  double id_indexed = (now_ns() - t) / (ROUNDS * n);
+
+  t = now_ns();
+  for (uint32_t r = 0; r < ROUNDS; r++) { for (uint32_t i = 0; i < names; i++) { sink += LinearFindName(name[i]); } }
+  double name_linear = (now_ns() - t) / (ROUNDS * names);
+  t = now_ns();
+  for (uint32_t r = 0; r < ROUNDS; r++) { for (uint32_t i = 0; i < names; i++) { sink += Z_PostProcessFindName(name[i]); } }
+  double name_indexed = (now_ns() - t) / (ROUNDS * names);
+
+  printf("  %-14s linear %6.1f ns, indexed %5.1f ns, %5.1fx\n", "by id", id_linear, id_indexed, id_linear / id_indexed);
+  printf("  %-14s linear %6.1f ns, indexed %5.1f ns, %5.1fx\n", "by name", name_linear, name_indexed, name_linear / name_indexed);
+}
+
+int main(int argc, char* argv[]) {
+  printf("indexes\n");
+  bool valid = Z_PostProcessIndexValid();
+  CHECK(valid);                                                         // else lookups use the linear scan and prove nothing
+  printf("  generated indexes %s\n", valid ? "in sync with Z_PostProcess" : "STALE");
+
+  printf("equivalence\n");
+  compare();
+
+  printf("lookup time, all entries\n");
+  bench();
+
+  printf("%u checks, %u failures\n", checks, failures);
+  return failures ? 1 : 0;
+}
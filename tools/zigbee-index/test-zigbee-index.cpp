@@ -0,0 +1,260 @@
+// Host test of the Zigbee device hash index against the linear scan
+//
+// Z_DeviceIndex is taken unchanged from tasmota/tasmota_xdrv_driver/xdrv_23_zigbee_2_devices.ino and
+// xdrv_23_zigbee_2a_devices_impl.ino, with the real LList. 500 synthetic devices are looked up by short
+// address, long address and friendly name, including misses, case variants, shared keys, renames and
+// readdressing. Every indexed lookup must return the same device as the linear scan it replaced.
+//
+// sed -n '/^class Z_DeviceIndex {/,/^};/p' ../../tasmota/tasmota_xdrv_driver/xdrv_23_zigbee_2_devices.ino > zigbee_index.inc
+// sed -n '/^uint32_t Z_DeviceIndex::hashName/,/^\/\/ Scan all devices to find a corresponding shortaddr/p' ../../tasmota/tasmota_xdrv_driver/xdrv_23_zigbee_2a_devices_impl.ino | head -n -2 >> zigbee_index.inc
+// g++ -O2 -I../../lib/default/TasmotaLList/src test-zigbee-index.cpp -o test-zigbee-index && ./test-zigbee-index
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <time.h>
+#include "LList.h"
+
+const uint32_t DEVICES = 500;
+const uint32_t ROUNDS = 200;
+
+struct Z_Device {
+  uint64_t    longaddr = 0;
+  char *      friendlyName = nullptr;
+  uint16_t    shortaddr = 0;
+};
+
+#include "zigbee_index.inc"
+
+static uint32_t checks = 0;
+static uint32_t failures = 0;
+
+#define CHECK(cond) do { checks++; if (!(cond)) { failures++; printf("  FAIL %s:%d %s\n", __FILE__, __LINE__, #cond); } } while (0)
+
+/*********************************************************************************************\
+ * Lookups as in Z_Devices, indexed with the linear scan as fallback, and the linear scan alone
+\*********************************************************************************************/
+
+LList<Z_Device> devices;
+Z_DeviceIndex index_;
+
+Z_Device * LinearShortAddr(uint16_t shortaddr);
+Z_Device * LinearLongAddr(uint64_t longaddr);
+Z_Device * LinearFriendlyName(const char * name);
+
+Z_Device * IndexShortAddr(uint16_t shortaddr) {
+  if (index_.ready(devices)) { return index_.findShortAddr(shortaddr); }
+  return LinearShortAddr(shortaddr);
+}
+
+Z_Device * IndexLongAddr(uint64_t longaddr) {
+  if (!longaddr) { return nullptr; }
+  if (index_.ready(devices)) { return index_.findLongAddr(longaddr); }
+  return LinearLongAddr(longaddr);
+}
+
+Z_Device * IndexFriendlyName(const char * name) {
+  if ((!name) || (0 == name[0])) { return nullptr; }
+  if (index_.ready(devices)) { return index_.findFriendlyName(name); }
+  return LinearFriendlyName(name);
+}
+
+Z_Device * LinearShortAddr(uint16_t shortaddr) {
+  for (auto & elem : devices) {
+    if (elem.shortaddr == shortaddr) { return &elem; }
+  }
+  return nullptr;
+}
+
+Z_Device * LinearLongAddr(uint64_t longaddr) {
+  if (!longaddr) { return nullptr; }
+  for (auto & elem : devices) {
+    if (elem.longaddr == longaddr) { return &elem; }
+  }
+  return nullptr;
+}
+
+Z_Device * LinearFriendlyName(const char * name) {
+  if ((!name) || (0 == name[0])) { return nullptr; }
+  for (auto & elem : devices) {
+    if (elem.friendlyName) {
+      if (strcasecmp(elem.friendlyName, name) == 0) { return &elem; }
+    }
+  }
+  return nullptr;
+}
+
+/*********************************************************************************************\
+ * Synthetic devices
+\*********************************************************************************************/
+
+static uint64_t seed = 0x2545F4914F6CDD1DULL;
+
+static uint64_t random64(void) {
+  seed ^= seed << 13;
+  seed ^= seed >> 7;
+  seed ^= seed << 17;
+  return seed;
+}
+
+static void rename(Z_Device & device, const char * name) {
+  free(device.friendlyName);
+  device.friendlyName = name ? strdup(name) : nullptr;
+}
+
+static void create(uint32_t i) {
+  Z_Device & device = devices.addToLast();
+  device.shortaddr = random64();
+  device.longaddr = (i % 10 == 9) ? 0 : (0x00124B0000000000ULL | (random64() & 0xFFFFFFFFFF));   // some devices only have a short address
+  if (i % 7 != 6) {                                                      // some devices have no name
+    char name[24];
+    if (i % 50 == 49) {
+      snprintf(name, sizeof(name), "Shared_%u", i / 100);               // two devices with the same name, the first one wins
+    } else {
+      snprintf(name, sizeof(name), "Sensor_%03u", i);
+    }
+    rename(device, name);
+  }
+  index_.add(&device);
+}
+
+static void mixcase(char * name) {
+  for (char * p = name; *p; p++) {
+    if (random64() & 1) { *p = isupper(*p) ? tolower(*p) : toupper(*p); }
+  }
+}
+
+static Z_Device & pick(void) {
+  return *devices.at(random64() % devices.length());
+}
+
+static void compare(const char * phase) {
+  uint32_t before = failures;
+  for (auto & elem : devices) {
+    CHECK(IndexShortAddr(elem.shortaddr) == LinearShortAddr(elem.shortaddr));
+    CHECK(IndexLongAddr(elem.longaddr) == LinearLongAddr(elem.longaddr));
+    if (elem.friendlyName) {
+      char name[32];
+      strcpy(name, elem.friendlyName);
+      mixcase(name);
+      CHECK(IndexFriendlyName(name) == LinearFriendlyName(name));
+    }
+  }
+  for (uint32_t i = 0; i < DEVICES; i++) {                               // misses and random keys
+    uint16_t shortaddr = random64();
+    uint64_t longaddr = 0x00124B0000000000ULL | (random64() & 0xFFFFFFFFFF);
+    char name[24];
+    snprintf(name, sizeof(name), "Sensor_%03u", (uint32_t)(random64() % (2 * DEVICES)));
+    CHECK(IndexShortAddr(shortaddr) == LinearShortAddr(shortaddr));
+    CHECK(IndexLongAddr(longaddr) == LinearLongAddr(longaddr));
+    CHECK(IndexFriendlyName(name) == LinearFriendlyName(name));
+  }
+  CHECK(nullptr == IndexFriendlyName(""));
+  CHECK(nullptr == IndexLongAddr(0));
+  printf("  %-26s %u devices, %s\n", phase, (uint32_t)devices.length(), (failures == before) ? "same as linear scan" : "MISMATCH");
+}
+
+/*********************************************************************************************\
+ * Timing
+\*********************************************************************************************/
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static volatile uintptr_t sink;
+
+static void bench(void) {
+  const uint32_t n = devices.length();
+  uint16_t * shortaddr = new uint16_t[n];
+  uint64_t * longaddr = new uint64_t[n];
+  char ** name = new char*[n];
+  uint32_t names = 0;
+  uint32_t i = 0;
+  for (auto & elem : devices) {
+    shortaddr[i] = elem.shortaddr;
+    longaddr[i] = elem.longaddr ? elem.longaddr : 1;
+    if (elem.friendlyName) { name[names++] = elem.friendlyName; }
+    i++;
+  }
+  struct {
+    const char * key;
+    double linear;
+    double indexed;
+  } result[3] = { { "short address" }, { "long address" }, { "friendly name" } };
+
+  double t = now_ns();
+  for (uint32_t r = 0; r < ROUNDS; r++) { for (i = 0; i < n; i++) { sink += (uintptr_t) LinearShortAddr(shortaddr[i]); } }
+  result[0].linear = (now_ns() - t) / (ROUNDS * n);
+  t = now_ns();
+  for (uint32_t r = 0; r < ROUNDS; r++) { for (i = 0; i < n; i++) { sink += (uintptr_t) IndexShortAddr(shortaddr[i]); } }
+  result[0].indexed = (now_ns() - t) / (ROUNDS * n);
+
+  t = now_ns();
+  for (uint32_t r = 0; r < ROUNDS; r++) { for (i = 0; i < n; i++) { sink += (uintptr_t) LinearLongAddr(longaddr[i]); } }
+  result[1].linear = (now_ns() - t) / (ROUNDS * n);
+  t = now_ns();
+  for (uint32_t r = 0; r < ROUNDS; r++) { for (i = 0; i < n; i++) { sink += (uintptr_t) IndexLongAddr(longaddr[i]); } }
+  result[1].indexed = (now_ns() - t) / (ROUNDS * n);
+
+  t = now_ns();
+  for (uint32_t r = 0; r < ROUNDS; r++) { for (i = 0; i < names; i++) { sink += (uintptr_t) LinearFriendlyName(name[i]); } }
+  result[2].linear = (now_ns() - t) / (ROUNDS * names);
+  t = now_ns();
+  for (uint32_t r = 0; r < ROUNDS; r++) { for (i = 0; i < names; i++) { sink += (uintptr_t) IndexFriendlyName(name[i]); } }
+  result[2].indexed = (now_ns() - t) / (ROUNDS * names);
+
+  for (auto & res : result) {
+    printf("  %-14s linear %8.1f ns, indexed %6.1f ns, %6.1fx\n", res.key, res.linear, res.indexed, res.linear / res.indexed);
+  }
+  delete[] shortaddr;
+  delete[] longaddr;
+  delete[] name;
+}
+
+int main(int argc, char* argv[]) {
+  printf("equivalence\n");
+  for (uint32_t i = 0; i < 40; i++) { create(i); }
+  compare("40 devices added");
+  for (uint32_t i = 40; i < DEVICES; i++) {
+    create(i);
+    if (i % 97 == 0) { compare("growing"); }
+  }
+  compare("500 devices added");
+
+  for (uint32_t i = 0; i < 50; i++) {                                    // renames, as ZbName
+    char name[24];
+    snprintf(name, sizeof(name), "Renamed_%u", (uint32_t)(random64() % 30));
+    rename(pick(), (i % 5 == 4) ? nullptr : name);
+    index_.invalidate();
+  }
+  compare("after renames");
+
+  for (uint32_t i = 0; i < 50; i++) {                                    // new short address after rejoin
+    pick().shortaddr = random64();
+    index_.invalidate();
+  }
+  compare("after readdressing");
+
+  for (uint32_t i = 0; i < 50; i++) {                                    // removals, as ZbForget
+    Z_Device & device = pick();
+    rename(device, nullptr);
+    devices.remove(&device);
+    index_.invalidate();
+  }
+  compare("after removals");
+  for (uint32_t i = DEVICES; i < DEVICES + 50; i++) { create(i); }
+  compare("after new devices");
+
+  printf("lookup time, %u devices\n", (uint32_t)devices.length());
+  bench();
+
+  for (auto & elem : devices) { rename(elem, nullptr); }
+  printf("%u checks, %u failures\n", checks, failures);
+  return failures ? 1 : 0;
+}